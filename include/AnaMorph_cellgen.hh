@@ -92,8 +92,15 @@ class AnaMorph_cellgen : private CLApplication {
         bool                force_meshing;
         bool                meshing_individual_surfaces;
 
+        MeshFileFormat      mesh_format;
+
         bool                meshing_flush;
         uint32_t            meshing_flush_face_limit;
+        uint32_t            meshing_flush_mem_limit;
+
+        uint32_t            meshing_nthreads;
+        bool                meshing_parallel_trees;
+        bool                meshing_parallel_cells;
 
         uint32_t            meshing_n_soma_refs;
         double              scale_radius;
@@ -124,6 +131,14 @@ class AnaMorph_cellgen : private CLApplication {
         double              pp_hc_beta;
         uint32_t            pp_hc_maxiter;
 
+        bool                pp_decimate;
+        uint32_t            pp_decimate_faces;
+
+        bool                pp_seams;
+        uint32_t            pp_seams_k;
+
+        uint32_t            pp_nthreads;
+
                             AnaMorph_cellgen(AnaMorph_cellgen const &) = delete;
                             AnaMorph_cellgen(AnaMorph_cellgen const &&) = delete;
         AnaMorph_cellgen   &operator=(AnaMorph_cellgen const &) = delete;
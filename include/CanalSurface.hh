@@ -269,6 +269,44 @@ class LinearRadiusInterpolatorDomain {
 };
 #endif
 
+/* spine curve samples used by CanalSurface::generateMesh(): center, radius and render frame vectors (py, pz) of all
+ * circles 0, .., n of the mesh, where circle 0 is located at t0 and circle n at t1. the samples depend only on the
+ * canal surface and the parameters stored below, but neither on the angular offset phi_0 nor on the mesh, so they can
+ * be computed ahead of time (e.g. on another thread) with CanalSurface::computeMeshFrames(). */
+template <typename R>
+struct CanalSurfaceMeshFrames {
+    uint32_t                n_phi_segments;
+    R                       triangle_height_factor;
+    Vec3<R>                 rvec;
+    R                       arclen_dt;
+    bool                    preserve_crease_edges;
+
+    std::vector<Vec3<R>>    p, py, pz;
+    std::vector<R>          r;
+
+    CanalSurfaceMeshFrames()
+    : n_phi_segments(0), triangle_height_factor(0), rvec(0, 0, 0), arclen_dt(0), preserve_crease_edges(false)
+    {}
+
+    bool
+    matches(
+        uint32_t            _n_phi_segments,
+        R const            &_triangle_height_factor,
+        Vec3<R> const      &_rvec,
+        R const            &_arclen_dt,
+        bool                _preserve_crease_edges) const
+    {
+        return (
+                !this->p.empty() &&
+                this->n_phi_segments            == _n_phi_segments &&
+                this->triangle_height_factor    == _triangle_height_factor &&
+                this->rvec                      == _rvec &&
+                this->arclen_dt                 == _arclen_dt &&
+                this->preserve_crease_edges     == _preserve_crease_edges
+            );
+    }
+};
+
 /*! @brief Canal Surface Class
  *
  * detailed Canal Surface class description */
@@ -354,7 +392,17 @@ class CanalSurface {
         RadF                            getRadiusFunctor() const;
         void                            setRadiusFunctor(RadF const &radius_functor);
 
-        /* mesh generation methods, templated with mesh template parameters  */
+        /* compute spine curve samples for generateMesh(), which can be passed to generateMesh() subsequently. */
+        void                            computeMeshFrames(
+                                            uint32_t                                                nphisegments,
+                                            R                                                       triangle_height_factor,
+                                            Vec3<R>                                                 rvec,
+                                            R const                                                &arclen_dt,
+                                            bool                                                    preserve_crease_edges,
+                                            CanalSurfaceMeshFrames<R>                              &frames) const;
+
+        /* mesh generation methods, templated with mesh template parameters. if frames is given and matches the
+         * given parameters, the precomputed spine curve samples are used. */
         template <typename Tm, typename Tv, typename Tf>
         void                            generateMesh(
                                             Mesh<Tm, Tv, Tf, R>                                    &M,
@@ -372,7 +420,8 @@ class CanalSurface {
                                                     typename Mesh<Tm, Tv, Tf, R>::vertex_iterator
                                                 >                                                  *end_circle_its          = NULL,
                                             typename Mesh<Tm, Tv, Tf, R>::vertex_iterator          *closing_vertex_it       = NULL,
-                                            bool                                                    preserve_crease_edges   = false) const ;
+                                            bool                                                    preserve_crease_edges   = false,
+                                            CanalSurfaceMeshFrames<R> const                        *frames                  = NULL) const ;
 };
 
 #if 0
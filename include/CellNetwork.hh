@@ -165,6 +165,10 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                 /* protected members */
                 std::list<CellSection>      sections;
 
+                /* type id of the derived vertex type (NeuronVertexTypes), fixed by the leaf constructors. the type
+                 * predicates below read it directly, which spares the iterators a virtual call per element. */
+                uint32_t                    type_tag;
+
             protected:
                 /* protected constructor */
                                                 NeuronVertex(
@@ -527,6 +531,9 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                  * Graph::Edge::{v_src, v_dst} */
                 NeuronVertex               *v_neuron_src, *v_neuron_dst;
 
+                /* type id of the derived edge type (NeuronEdgeTypes), see NeuronVertex::type_tag */
+                uint32_t                    type_tag;
+
             protected:
                 /* protected constructor */
                                             NeuronEdge(
@@ -933,8 +940,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
             bool
             operator()(NeuronVertex const &v) const
             {
-                /* call polymorph getType() method to extract derived type id */
-                uint32_t vtype = v.getType();
+                /* read type tag instead of calling polymorph getType() */
+                uint32_t vtype = v.type_tag;
 
                 return (vtype == AXON_VERTEX || vtype == DENDRITE_VERTEX);
             }
@@ -944,8 +951,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
             bool
             operator()(NeuronVertex const &v) const
             {
-                /* call polymorph getType() method to extract derived type id */
-                return (v.getType() == SOMA_VERTEX);
+                /* read type tag instead of calling polymorph getType() */
+                return (v.type_tag == SOMA_VERTEX);
             }
         } isSomaVertex;
 
@@ -953,8 +960,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
             bool
             operator()(NeuronVertex const &v) const
             {
-                /* call polymorph getType() method to extract derived type id */
-                return (v.getType() == AXON_VERTEX);
+                /* read type tag instead of calling polymorph getType() */
+                return (v.type_tag == AXON_VERTEX);
             }
         } isAxonVertex;
 
@@ -962,8 +969,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
             bool
             operator()(NeuronVertex const &v) const
             {
-                /* call polymorph getType() method to extract derived type id */
-                return (v.getType() == DENDRITE_VERTEX);
+                /* read type tag instead of calling polymorph getType() */
+                return (v.type_tag == DENDRITE_VERTEX);
             }
         } isDendriteVertex;
 
@@ -980,8 +987,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
             bool
             operator()(NeuronEdge const &e) const
             {
-                /* call polymorph getType() method to extract derived type id */
-                return (e.getType() == AXON_ROOT_EDGE || e.getType() == DENDRITE_ROOT_EDGE);
+                /* read type tag instead of calling polymorph getType() */
+                return (e.type_tag == AXON_ROOT_EDGE || e.type_tag == DENDRITE_ROOT_EDGE);
             }
         } isNeuriteRootEdge;
 
@@ -989,8 +996,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
             bool
             operator()(NeuronEdge const &e) const
             {
-                /* call polymorph getType() method to extract derived type id */
-                return (e.getType() == AXON_ROOT_EDGE);
+                /* read type tag instead of calling polymorph getType() */
+                return (e.type_tag == AXON_ROOT_EDGE);
             }
         } isAxonRootEdge;
 
@@ -998,8 +1005,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
             bool
             operator()(NeuronEdge const &e) const
             {
-                /* call polymorph getType() method to extract derived type id */
-                return (e.getType() == DENDRITE_ROOT_EDGE);
+                /* read type tag instead of calling polymorph getType() */
+                return (e.type_tag == DENDRITE_ROOT_EDGE);
             }
         } isDendriteRootEdge;
 
@@ -1007,8 +1014,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
             bool
             operator()(NeuronEdge const &e) const
             {
-                /* call polymorph getType() method to extract derived type id */
-                uint32_t etype = e.getType();
+                /* read type tag instead of calling polymorph getType() */
+                uint32_t etype = e.type_tag;
 
                 return (etype == AXON_SEGMENT || etype == DENDRITE_SEGMENT);
             }
@@ -1018,8 +1025,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
             bool
             operator()(NeuronEdge const &e) const
             {
-                /* call polymorph getType() method to extract derived type id */
-                return (e.getType() == AXON_SEGMENT);
+                /* read type tag instead of calling polymorph getType() */
+                return (e.type_tag == AXON_SEGMENT);
             }
         } isAxonSegment;
 
@@ -1027,11 +1034,92 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
             bool
             operator()(NeuronEdge const &e) const
             {
-                /* call polymorph getType() method to extract derived type id */
-                return (e.getType() == DENDRITE_SEGMENT);
+                /* read type tag instead of calling polymorph getType() */
+                return (e.type_tag == DENDRITE_SEGMENT);
             }
         } isDendriteSegment;
 
+        /* compile-time dispatch of "is v / e of (derived) type T" on the type tag, used by the templated traversals.
+         * the unused pointer argument only selects the overload, e.g. matchesType(v, (NeuriteVertex const *)NULL). */
+        static bool
+        matchesType(NeuronVertex const &v, NeuronVertex const *)
+        {
+            return true;
+        }
+
+        static bool
+        matchesType(NeuronVertex const &v, SomaVertex const *)
+        {
+            return (v.type_tag == SOMA_VERTEX);
+        }
+
+        static bool
+        matchesType(NeuronVertex const &v, NeuriteVertex const *)
+        {
+            return (v.type_tag == AXON_VERTEX || v.type_tag == DENDRITE_VERTEX);
+        }
+
+        static bool
+        matchesType(NeuronVertex const &v, AxonVertex const *)
+        {
+            return (v.type_tag == AXON_VERTEX);
+        }
+
+        static bool
+        matchesType(NeuronVertex const &v, DendriteVertex const *)
+        {
+            return (v.type_tag == DENDRITE_VERTEX);
+        }
+
+        static bool
+        matchesType(NeuronEdge const &e, NeuronEdge const *)
+        {
+            return true;
+        }
+
+        static bool
+        matchesType(NeuronEdge const &e, NeuriteRootEdge const *)
+        {
+            return (e.type_tag == AXON_ROOT_EDGE || e.type_tag == DENDRITE_ROOT_EDGE);
+        }
+
+        static bool
+        matchesType(NeuronEdge const &e, AxonRootEdge const *)
+        {
+            return (e.type_tag == AXON_ROOT_EDGE);
+        }
+
+        static bool
+        matchesType(NeuronEdge const &e, DendriteRootEdge const *)
+        {
+            return (e.type_tag == DENDRITE_ROOT_EDGE);
+        }
+
+        static bool
+        matchesType(NeuronEdge const &e, NeuriteSegment const *)
+        {
+            return (e.type_tag == AXON_SEGMENT || e.type_tag == DENDRITE_SEGMENT);
+        }
+
+        static bool
+        matchesType(NeuronEdge const &e, AxonSegment const *)
+        {
+            return (e.type_tag == AXON_SEGMENT);
+        }
+
+        static bool
+        matchesType(NeuronEdge const &e, DendriteSegment const *)
+        {
+            return (e.type_tag == DENDRITE_SEGMENT);
+        }
+
+        /* statistics of the euclidean distances of all unordered pairs of positions. rows of the (upper triangular)
+         * distance matrix are processed in fixed blocks on up to nthreads threads without storing the matrix. */
+        static void                                 getPairwiseDistanceStat(
+                                                        std::vector<Vec3<R>> const &positions,
+                                                        Aux::Stat::RunningStat<R>  &dist_stat,
+                                                        uint32_t                    nthreads);
+
     /* public declarations of iterators / accessors */
     public:
         /* forward declaration of CellNetworkAccessor */
@@ -1100,6 +1188,20 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                     this->network   = network;
                 }
 
+                /* all elements of the internal vertex / edge maps of a CellNetwork are of DelegatorType (NeuronVertex /
+                 * NeuronEdge) by construction, so the down-cast to the type the predicates operate on is static. the
+                 * actual derived type is identified by the type tag read in pred. */
+                static DelegatorType *
+                delegator(InternalIteratorType const &it)
+                {
+#ifdef __DEBUG__
+                    if (!dynamic_cast<DelegatorType *>(BaseType::getPtr(it))) {
+                        throw("CellNetwork::CellNetworkIterator::delegator(): failed to down-cast base type to delegator type. internal logic error.");
+                    }
+#endif
+                    return static_cast<DelegatorType *>(BaseType::getPtr(it));
+                }
+
             public:
                 CellNetworkIterator(CellNetworkIterator const &x)
             	/* call Graph::GraphIterator constructor in initializer list */
@@ -1129,27 +1231,17 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                 {
                     /* check if this->int_it is already this->int_ds->end(). throw in case */
                     if (this->int_it != this->int_ds->end()) {
-                        DelegatorType *dp;
-
                         /* increment internal iterator at least once */
                         ++this->int_it;
 
-                        /* while iterator hasn't reached end() */
+                        /* while iterator hasn't reached end(): if type tag matches, return, otherwise increment the
+                         * internal iterator and restart the loop */
                         while (this->int_it != this->int_ds->end()) {
-                            /* down-cast to delegator type, throw if downcast fails. */
-                            dp = dynamic_cast<DelegatorType *>(BaseType::getPtr(this->int_it));
-                            if (dp) {
-                                /* if type matches, return, otherwise increment the internal iterator
-                                 * and restart the loop if end() hasn't been reached yet */
-                                if ( this->pred->operator()(*dp) ) {
-                                    break;
-                                }
-                                else {
-                                    ++this->int_it;
-                                }
+                            if ( this->pred->operator()(*CellNetworkIterator::delegator(this->int_it)) ) {
+                                break;
                             }
                             else {
-                                throw("CellNetwork::CellNetworkIterator::operator++(): failed to down-cast base type to delegator type. internal logic error.");
+                                ++this->int_it;
                             }
                         }
                         return (*this);
@@ -1183,8 +1275,6 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                 CellNetworkIterator &
                 operator--()
                 {
-                    DelegatorType *dp;
-
                     /* check un-decremented version of iterator against begin(), decrement _before_ the loop body to be
                      * able to deal with begin() as well (necessary since there are no relational operators such as <=
                      * in this case) */
@@ -1192,17 +1282,10 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                         /* decrement iterator before loop body */
                         --this->int_it;
 
-                        /* down-cast to delegator type, throw() if downcast fails. */
-                        dp = dynamic_cast<DelegatorType *>(BaseType::getPtr(this->int_it));
-                        if (dp) {
-                            /* if type matches, return, otherwise decrement the internal iterator
-                             * and restart the loop if end() hasn't been reached yet */
-                            if ( this->pred->operator()(*dp) ) {
-                                return (*this);
-                            }
-                        }
-                        else {
-                            throw("CellNetwork::CellNetworkIterator::operator-- failed to down-cast base type to delegator type. internal logic error.");
+                        /* if type tag matches, return, otherwise decrement the internal iterator and restart the loop
+                         * if begin() hasn't been reached yet */
+                        if ( this->pred->operator()(*CellNetworkIterator::delegator(this->int_it)) ) {
+                            return (*this);
                         }
                     }
                     /* int_it is not this->int_ds->begin() and the type does not match. throw out of range exception */
@@ -1243,16 +1326,14 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                 ValueType *
                 operator->() const
                 {
-                    /* directly down-cast base type to value type */
-                    ValueType   *vp = dynamic_cast<ValueType *>(BaseType::getPtr(this->int_it)); 
-
-                    /* if cast has been successful, return ValueType pointer, otherwise throw(). */
-                    if (vp) {
-                        return vp;
-                    }
-                    else {
+                    /* int_it only ever rests on elements accepted by pred, whose type tag identifies the derived
+                     * type => static down-cast is safe. the checked dynamic_cast is kept for debug builds. */
+#ifdef __DEBUG__
+                    if (!dynamic_cast<ValueType *>(BaseType::getPtr(this->int_it))) {
                         throw("CellNetworkIterator::operator->(): down-casting to value type failed. internal logic error.");
                     }
+#endif
+                    return static_cast<ValueType *>(BaseType::getPtr(this->int_it));
                 }
 
                 CellNetwork *
@@ -1272,8 +1353,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                 NeuronVertex,
                 typename Graph<Tn, Tv, Te>::Vertex,
                 NeuronVertex,
-                std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>,
-                typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>::iterator,
+                typename Graph<Tn, Tv, Te>::VertexMapType,
+                typename Graph<Tn, Tv, Te>::VertexMapType::iterator,
                 NeuronVertexPred
             > 
         {
@@ -1283,8 +1364,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                           NeuronVertex,
                           typename Graph<Tn, Tv, Te>::Vertex,
                           NeuronVertex,
-                          std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>,
-                          typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>::iterator,
+                          typename Graph<Tn, Tv, Te>::VertexMapType,
+                          typename Graph<Tn, Tv, Te>::VertexMapType::iterator,
                           NeuronVertexPred
                       >()
                 {
@@ -1292,13 +1373,13 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
 
                 neuron_iterator(
                     CellNetwork                                                                            *C,
-                    typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>::iterator    it)
+                    typename Graph<Tn, Tv, Te>::VertexMapType::iterator    it)
                         : CellNetworkIterator<
                               NeuronVertex,
                               typename Graph<Tn, Tv, Te>::Vertex,
                               NeuronVertex,
-                              std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>,
-                              typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>::iterator,
+                              typename Graph<Tn, Tv, Te>::VertexMapType,
+                              typename Graph<Tn, Tv, Te>::VertexMapType::iterator,
                               NeuronVertexPred
                           >(C, &(C->V), it, &(C->isNeuronVertex) )
                 {
@@ -1309,8 +1390,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                               NeuronVertex,
                               typename Graph<Tn, Tv, Te>::Vertex,
                               NeuronVertex,
-                              std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>,
-                              typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>::iterator,
+                              typename Graph<Tn, Tv, Te>::VertexMapType,
+                              typename Graph<Tn, Tv, Te>::VertexMapType::iterator,
                               NeuronVertexPred
                           >(x)
                 {
@@ -1360,8 +1441,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                 const NeuronVertex,
                 typename Graph<Tn, Tv, Te>::Vertex,
                 NeuronVertex,
-                std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>,
-                typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>::const_iterator,
+                typename Graph<Tn, Tv, Te>::VertexMapType,
+                typename Graph<Tn, Tv, Te>::VertexMapType::const_iterator,
                 NeuronVertexPred
             > 
         {
@@ -1372,13 +1453,13 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
 
                 neuron_const_iterator(
                     CellNetwork                                                                                *C,
-                    typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>::const_iterator  it)
+                    typename Graph<Tn, Tv, Te>::VertexMapType::const_iterator  it)
                         : CellNetworkIterator<
                               const NeuronVertex,
                               typename Graph<Tn, Tv, Te>::Vertex,
                               NeuronVertex,
-                              std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>,
-                              typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>::const_iterator,
+                              typename Graph<Tn, Tv, Te>::VertexMapType,
+                              typename Graph<Tn, Tv, Te>::VertexMapType::const_iterator,
                               NeuronVertexPred
                           >(C, &(C->V), it, &(C->isNeuronVertex) )
                 {
@@ -1389,8 +1470,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                               const NeuronVertex,
                               typename Graph<Tn, Tv, Te>::Vertex,
                               NeuronVertex,
-                              std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>,
-                              typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>::const_iterator,
+                              typename Graph<Tn, Tv, Te>::VertexMapType,
+                              typename Graph<Tn, Tv, Te>::VertexMapType::const_iterator,
                               NeuronVertexPred
                           >(x)
                 {
@@ -1451,8 +1532,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                 SomaVertex,
                 typename Graph<Tn, Tv, Te>::Vertex,
                 NeuronVertex,
-                std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>,
-                typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>::iterator,
+                typename Graph<Tn, Tv, Te>::VertexMapType,
+                typename Graph<Tn, Tv, Te>::VertexMapType::iterator,
                 SomaVertexPred
             > 
         {
@@ -1462,8 +1543,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                             SomaVertex,
                             typename Graph<Tn, Tv, Te>::Vertex,
                             NeuronVertex,
-                            std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>,
-                            typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>::iterator,
+                            typename Graph<Tn, Tv, Te>::VertexMapType,
+                            typename Graph<Tn, Tv, Te>::VertexMapType::iterator,
                             SomaVertexPred
                     >()
                 {
@@ -1471,13 +1552,13 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
 
                 soma_iterator(
                     CellNetwork                                                                            *C,
-                    typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>::iterator    it)
+                    typename Graph<Tn, Tv, Te>::VertexMapType::iterator    it)
                         : CellNetworkIterator<
                             SomaVertex,
                             typename Graph<Tn, Tv, Te>::Vertex,
                             NeuronVertex,
-                            std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>,
-                            typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>::iterator,
+                            typename Graph<Tn, Tv, Te>::VertexMapType,
+                            typename Graph<Tn, Tv, Te>::VertexMapType::iterator,
                             SomaVertexPred
                         >(C, &(C->V), it, &(C->isSomaVertex) )
                 {
@@ -1488,8 +1569,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                             SomaVertex,
                             typename Graph<Tn, Tv, Te>::Vertex,
                             NeuronVertex,
-                            std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>,
-                            typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>::iterator,
+                            typename Graph<Tn, Tv, Te>::VertexMapType,
+                            typename Graph<Tn, Tv, Te>::VertexMapType::iterator,
                             SomaVertexPred
                         >(x)
                 {
@@ -1505,8 +1586,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                 const SomaVertex,
                 typename Graph<Tn, Tv, Te>::Vertex,
                 NeuronVertex,
-                std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>,
-                typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>::const_iterator,
+                typename Graph<Tn, Tv, Te>::VertexMapType,
+                typename Graph<Tn, Tv, Te>::VertexMapType::const_iterator,
                 SomaVertexPred
             > 
         {
@@ -1517,13 +1598,13 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
 
                 soma_const_iterator(
                     CellNetwork                                                                                *C,
-                    typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>::const_iterator  it)
+                    typename Graph<Tn, Tv, Te>::VertexMapType::const_iterator  it)
                         : CellNetworkIterator<
                                 const SomaVertex,
                                 typename Graph<Tn, Tv, Te>::Vertex,
                                 NeuronVertex,
-                                std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>,
-                                typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>::const_iterator,
+                                typename Graph<Tn, Tv, Te>::VertexMapType,
+                                typename Graph<Tn, Tv, Te>::VertexMapType::const_iterator,
                                 SomaVertexPred
                         >(C, &(C->V), it, &(C->isSomaVertex) )
                 {
@@ -1534,8 +1615,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                                 const SomaVertex,
                                 typename Graph<Tn, Tv, Te>::Vertex,
                                 NeuronVertex,
-                                std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>,
-                                typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>::const_iterator,
+                                typename Graph<Tn, Tv, Te>::VertexMapType,
+                                typename Graph<Tn, Tv, Te>::VertexMapType::const_iterator,
                                 SomaVertexPred
                         >(x)
                 {
@@ -1562,8 +1643,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                 NeuriteVertex,
                 typename Graph<Tn, Tv, Te>::Vertex,
                 NeuronVertex,
-                std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>,
-                typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>::iterator,
+                typename Graph<Tn, Tv, Te>::VertexMapType,
+                typename Graph<Tn, Tv, Te>::VertexMapType::iterator,
                 NeuriteVertexPred
             > 
         {
@@ -1573,8 +1654,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                             NeuriteVertex,
                             typename Graph<Tn, Tv, Te>::Vertex,
                             NeuronVertex,
-                            std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>,
-                            typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>::iterator,
+                            typename Graph<Tn, Tv, Te>::VertexMapType,
+                            typename Graph<Tn, Tv, Te>::VertexMapType::iterator,
                             NeuriteVertexPred
                       >()
                 {
@@ -1582,13 +1663,13 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
 
                 neurite_iterator(
                     CellNetwork                                                                            *C,
-                    typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>::iterator    it)
+                    typename Graph<Tn, Tv, Te>::VertexMapType::iterator    it)
                         : CellNetworkIterator<
                             NeuriteVertex,
                             typename Graph<Tn, Tv, Te>::Vertex,
                             NeuronVertex,
-                            std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>,
-                            typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>::iterator,
+                            typename Graph<Tn, Tv, Te>::VertexMapType,
+                            typename Graph<Tn, Tv, Te>::VertexMapType::iterator,
                             NeuriteVertexPred
                         >(C, &(C->V), it, &(C->isNeuriteVertex) )
                 {
@@ -1599,8 +1680,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                             NeuriteVertex,
                             typename Graph<Tn, Tv, Te>::Vertex,
                             NeuronVertex,
-                            std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>,
-                            typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>::iterator,
+                            typename Graph<Tn, Tv, Te>::VertexMapType,
+                            typename Graph<Tn, Tv, Te>::VertexMapType::iterator,
                             NeuriteVertexPred
                         >(x)
                 {
@@ -1634,8 +1715,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                 const NeuriteVertex,
                 typename Graph<Tn, Tv, Te>::Vertex,
                 NeuronVertex,
-                std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>,
-                typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>::const_iterator,
+                typename Graph<Tn, Tv, Te>::VertexMapType,
+                typename Graph<Tn, Tv, Te>::VertexMapType::const_iterator,
                 NeuriteVertexPred
             > 
         {
@@ -1646,13 +1727,13 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
 
                 neurite_const_iterator(
                     CellNetwork                                                                                *C,
-                    typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>::const_iterator  it)
+                    typename Graph<Tn, Tv, Te>::VertexMapType::const_iterator  it)
                         : CellNetworkIterator<
                                 const NeuriteVertex,
                                 typename Graph<Tn, Tv, Te>::Vertex,
                                 NeuronVertex,
-                                std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>,
-                                typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>::const_iterator,
+                                typename Graph<Tn, Tv, Te>::VertexMapType,
+                                typename Graph<Tn, Tv, Te>::VertexMapType::const_iterator,
                                 NeuriteVertexPred
                           >(C, &(C->V), it, &(C->isNeuriteVertex) )
                 {
@@ -1663,8 +1744,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                                 const NeuriteVertex,
                                 typename Graph<Tn, Tv, Te>::Vertex,
                                 NeuronVertex,
-                                std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>,
-                                typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>::const_iterator,
+                                typename Graph<Tn, Tv, Te>::VertexMapType,
+                                typename Graph<Tn, Tv, Te>::VertexMapType::const_iterator,
                                 NeuriteVertexPred
                           >(x)
                 {
@@ -1709,8 +1790,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                 AxonVertex,
                 typename Graph<Tn, Tv, Te>::Vertex,
                 NeuronVertex,
-                std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>,
-                typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>::iterator,
+                typename Graph<Tn, Tv, Te>::VertexMapType,
+                typename Graph<Tn, Tv, Te>::VertexMapType::iterator,
                 AxonVertexPred
             > 
         {
@@ -1720,8 +1801,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                             AxonVertex,
                             typename Graph<Tn, Tv, Te>::Vertex,
                             NeuronVertex,
-                            std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>,
-                            typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>::iterator,
+                            typename Graph<Tn, Tv, Te>::VertexMapType,
+                            typename Graph<Tn, Tv, Te>::VertexMapType::iterator,
                             AxonVertexPred
                       >()
                 {
@@ -1729,13 +1810,13 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
 
                 axon_iterator(
                     CellNetwork                                                                            *C,
-                    typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>::iterator    it)
+                    typename Graph<Tn, Tv, Te>::VertexMapType::iterator    it)
                         : CellNetworkIterator<
                             AxonVertex,
                             typename Graph<Tn, Tv, Te>::Vertex,
                             NeuronVertex,
-                            std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>,
-                            typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>::iterator,
+                            typename Graph<Tn, Tv, Te>::VertexMapType,
+                            typename Graph<Tn, Tv, Te>::VertexMapType::iterator,
                             AxonVertexPred
                         >(C, &(C->V), it, &(C->isAxonVertex) )
                 {
@@ -1746,8 +1827,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                             AxonVertex,
                             typename Graph<Tn, Tv, Te>::Vertex,
                             NeuronVertex,
-                            std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>,
-                            typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>::iterator,
+                            typename Graph<Tn, Tv, Te>::VertexMapType,
+                            typename Graph<Tn, Tv, Te>::VertexMapType::iterator,
                             AxonVertexPred
                         >(x)
                 {
@@ -1763,8 +1844,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                 const AxonVertex,
                 typename Graph<Tn, Tv, Te>::Vertex,
                 NeuronVertex,
-                std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>,
-                typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>::const_iterator,
+                typename Graph<Tn, Tv, Te>::VertexMapType,
+                typename Graph<Tn, Tv, Te>::VertexMapType::const_iterator,
                 AxonVertexPred
             > 
         {
@@ -1775,13 +1856,13 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
 
                 axon_const_iterator(
                     CellNetwork                                                                                *C,
-                    typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>::const_iterator  it)
+                    typename Graph<Tn, Tv, Te>::VertexMapType::const_iterator  it)
                         : CellNetworkIterator<
                                 const AxonVertex,
                                 typename Graph<Tn, Tv, Te>::Vertex,
                                 NeuronVertex,
-                                std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>,
-                                typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>::const_iterator,
+                                typename Graph<Tn, Tv, Te>::VertexMapType,
+                                typename Graph<Tn, Tv, Te>::VertexMapType::const_iterator,
                                 AxonVertexPred
                           >(C, &(C->V), it, &(C->isAxonVertex) )
                 {
@@ -1792,8 +1873,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                                 const AxonVertex,
                                 typename Graph<Tn, Tv, Te>::Vertex,
                                 NeuronVertex,
-                                std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>,
-                                typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>::const_iterator,
+                                typename Graph<Tn, Tv, Te>::VertexMapType,
+                                typename Graph<Tn, Tv, Te>::VertexMapType::const_iterator,
                                 AxonVertexPred
                           >(x)
                 {
@@ -1820,8 +1901,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                 DendriteVertex,
                 typename Graph<Tn, Tv, Te>::Vertex,
                 NeuronVertex,
-                std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>,
-                typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>::iterator,
+                typename Graph<Tn, Tv, Te>::VertexMapType,
+                typename Graph<Tn, Tv, Te>::VertexMapType::iterator,
                 DendriteVertexPred
             > 
         {
@@ -1831,8 +1912,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                             DendriteVertex,
                             typename Graph<Tn, Tv, Te>::Vertex,
                             NeuronVertex,
-                            std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>,
-                            typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>::iterator,
+                            typename Graph<Tn, Tv, Te>::VertexMapType,
+                            typename Graph<Tn, Tv, Te>::VertexMapType::iterator,
                             DendriteVertexPred
                       >()
                 {
@@ -1840,13 +1921,13 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
 
                 dendrite_iterator(
                     CellNetwork                                                                            *C,
-                    typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>::iterator    it)
+                    typename Graph<Tn, Tv, Te>::VertexMapType::iterator    it)
                         : CellNetworkIterator<
                             DendriteVertex,
                             typename Graph<Tn, Tv, Te>::Vertex,
                             NeuronVertex,
-                            std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>,
-                            typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>::iterator,
+                            typename Graph<Tn, Tv, Te>::VertexMapType,
+                            typename Graph<Tn, Tv, Te>::VertexMapType::iterator,
                             DendriteVertexPred
                         >(C, &(C->V), it, &(C->isDendriteVertex) )
                 {
@@ -1857,8 +1938,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                             DendriteVertex,
                             typename Graph<Tn, Tv, Te>::Vertex,
                             NeuronVertex,
-                            std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>,
-                            typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>::iterator,
+                            typename Graph<Tn, Tv, Te>::VertexMapType,
+                            typename Graph<Tn, Tv, Te>::VertexMapType::iterator,
                             DendriteVertexPred
                         >(x)
                 {
@@ -1874,8 +1955,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                 const DendriteVertex,
                 typename Graph<Tn, Tv, Te>::Vertex,
                 NeuronVertex,
-                std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>,
-                typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>::const_iterator,
+                typename Graph<Tn, Tv, Te>::VertexMapType,
+                typename Graph<Tn, Tv, Te>::VertexMapType::const_iterator,
                 DendriteVertexPred
             > 
         {
@@ -1886,13 +1967,13 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
 
                 dendrite_const_iterator(
                     CellNetwork                                                                                *C,
-                    typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>::const_iterator  it)
+                    typename Graph<Tn, Tv, Te>::VertexMapType::const_iterator  it)
                         : CellNetworkIterator<
                             const DendriteVertex,
                             typename Graph<Tn, Tv, Te>::Vertex,
                             NeuronVertex,
-                            std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>,
-                            typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>::const_iterator,
+                            typename Graph<Tn, Tv, Te>::VertexMapType,
+                            typename Graph<Tn, Tv, Te>::VertexMapType::const_iterator,
                             DendriteVertexPred
                         >(C, &(C->V), it, &(C->isDendriteVertex) )
                 {
@@ -1903,8 +1984,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                         const DendriteVertex,
                         typename Graph<Tn, Tv, Te>::Vertex,
                         NeuronVertex,
-                        std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>,
-                        typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>::const_iterator,
+                        typename Graph<Tn, Tv, Te>::VertexMapType,
+                        typename Graph<Tn, Tv, Te>::VertexMapType::const_iterator,
                         DendriteVertexPred
                     >(x)
                 {
@@ -1935,8 +2016,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                 NeuronEdge,
                 typename Graph<Tn, Tv, Te>::Edge,
                 NeuronEdge,
-                std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
-                typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator,
+                typename Graph<Tn, Tv, Te>::EdgeMapType,
+                typename Graph<Tn, Tv, Te>::EdgeMapType::iterator,
                 NeuronEdgePred
             > 
         {
@@ -1946,8 +2027,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                         NeuronEdge,
                         typename Graph<Tn, Tv, Te>::Edge,
                         NeuronEdge,
-                        std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
-                        typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator,
+                        typename Graph<Tn, Tv, Te>::EdgeMapType,
+                        typename Graph<Tn, Tv, Te>::EdgeMapType::iterator,
                         NeuronEdgePred
                       >()
                 {
@@ -1955,13 +2036,13 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
 
                 neuron_edge_iterator(
                     CellNetwork                                                                        *C,
-                    typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator  it)
+                    typename Graph<Tn, Tv, Te>::EdgeMapType::iterator  it)
                         :   CellNetworkIterator<
                                 NeuronEdge,
                                 typename Graph<Tn, Tv, Te>::Edge,
                                 NeuronEdge,
-                                std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
-                                typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator,
+                                typename Graph<Tn, Tv, Te>::EdgeMapType,
+                                typename Graph<Tn, Tv, Te>::EdgeMapType::iterator,
                                 NeuronEdgePred
                             >(C, &(C->E), it, &(C->isNeuronEdge) )
                 {
@@ -1972,8 +2053,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                                 NeuronEdge,
                                 typename Graph<Tn, Tv, Te>::Edge,
                                 NeuronEdge,
-                                std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
-                                typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator,
+                                typename Graph<Tn, Tv, Te>::EdgeMapType,
+                                typename Graph<Tn, Tv, Te>::EdgeMapType::iterator,
                                 NeuronEdgePred
                             >(x)
                 {
@@ -2040,8 +2121,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                 const NeuronEdge,
                 typename Graph<Tn, Tv, Te>::Edge,
                 NeuronEdge,
-                std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
-                typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::const_iterator,
+                typename Graph<Tn, Tv, Te>::EdgeMapType,
+                typename Graph<Tn, Tv, Te>::EdgeMapType::const_iterator,
                 NeuronEdgePred
             > 
         {
@@ -2052,13 +2133,13 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
 
                 neuron_edge_const_iterator(
                     CellNetwork                                                                                *C,
-                    typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::const_iterator    it)
+                    typename Graph<Tn, Tv, Te>::EdgeMapType::const_iterator    it)
                         : CellNetworkIterator<
                             const NeuronEdge,
                             typename Graph<Tn, Tv, Te>::Edge,
                             NeuronEdge,
-                            std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
-                            typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::const_iterator,
+                            typename Graph<Tn, Tv, Te>::EdgeMapType,
+                            typename Graph<Tn, Tv, Te>::EdgeMapType::const_iterator,
                             NeuronEdgePred
                         >(C, &(C->E), it, &(C->isNeuronEdge) )
                 {
@@ -2069,8 +2150,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                             const NeuronEdge,
                             typename Graph<Tn, Tv, Te>::Edge,
                             NeuronEdge,
-                            std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
-                            typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::const_iterator,
+                            typename Graph<Tn, Tv, Te>::EdgeMapType,
+                            typename Graph<Tn, Tv, Te>::EdgeMapType::const_iterator,
                             NeuronEdgePred
                         >(x)
                 {
@@ -2140,8 +2221,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                 NeuriteRootEdge,
                 typename Graph<Tn, Tv, Te>::Edge,
                 NeuronEdge,
-                std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
-                typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator,
+                typename Graph<Tn, Tv, Te>::EdgeMapType,
+                typename Graph<Tn, Tv, Te>::EdgeMapType::iterator,
                 NeuriteRootEdgePred
             > 
         {
@@ -2151,8 +2232,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                         NeuriteRootEdge,
                         typename Graph<Tn, Tv, Te>::Edge,
                         NeuronEdge,
-                        std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
-                        typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator,
+                        typename Graph<Tn, Tv, Te>::EdgeMapType,
+                        typename Graph<Tn, Tv, Te>::EdgeMapType::iterator,
                         NeuriteRootEdgePred
                       >()
                 {
@@ -2160,13 +2241,13 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
 
                 neurite_rootedge_iterator(
                     CellNetwork                                                                        *C,
-                    typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator  it)
+                    typename Graph<Tn, Tv, Te>::EdgeMapType::iterator  it)
                         :   CellNetworkIterator<
                                 NeuriteRootEdge,
                                 typename Graph<Tn, Tv, Te>::Edge,
                                 NeuronEdge,
-                                std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
-                                typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator,
+                                typename Graph<Tn, Tv, Te>::EdgeMapType,
+                                typename Graph<Tn, Tv, Te>::EdgeMapType::iterator,
                                 NeuriteRootEdgePred
                             >(C, &(C->E), it, &(C->isNeuriteRootEdge) )
                 {
@@ -2177,8 +2258,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                                 NeuriteRootEdge,
                                 typename Graph<Tn, Tv, Te>::Edge,
                                 NeuronEdge,
-                                std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
-                                typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator,
+                                typename Graph<Tn, Tv, Te>::EdgeMapType,
+                                typename Graph<Tn, Tv, Te>::EdgeMapType::iterator,
                                 NeuriteRootEdgePred
                             >(x)
                 {
@@ -2212,8 +2293,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                 const NeuriteRootEdge,
                 typename Graph<Tn, Tv, Te>::Edge,
                 NeuronEdge,
-                std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
-                typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::const_iterator,
+                typename Graph<Tn, Tv, Te>::EdgeMapType,
+                typename Graph<Tn, Tv, Te>::EdgeMapType::const_iterator,
                 NeuriteRootEdgePred
             > 
         {
@@ -2224,13 +2305,13 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
 
                 neurite_rootedge_const_iterator(
                     CellNetwork                                                                                *C,
-                    typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::const_iterator    it)
+                    typename Graph<Tn, Tv, Te>::EdgeMapType::const_iterator    it)
                         : CellNetworkIterator<
                             const NeuriteRootEdge,
                             typename Graph<Tn, Tv, Te>::Edge,
                             NeuronEdge,
-                            std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
-                            typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::const_iterator,
+                            typename Graph<Tn, Tv, Te>::EdgeMapType,
+                            typename Graph<Tn, Tv, Te>::EdgeMapType::const_iterator,
                             NeuriteRootEdgePred
                         >(C, &(C->E), it, &(C->isNeuriteRootEdge) )
                 {
@@ -2241,8 +2322,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                             const NeuriteRootEdge,
                             typename Graph<Tn, Tv, Te>::Edge,
                             NeuronEdge,
-                            std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
-                            typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::const_iterator,
+                            typename Graph<Tn, Tv, Te>::EdgeMapType,
+                            typename Graph<Tn, Tv, Te>::EdgeMapType::const_iterator,
                             NeuriteRootEdgePred
                         >(x)
                 {
@@ -2287,8 +2368,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                 AxonRootEdge,
                 typename Graph<Tn, Tv, Te>::Edge,
                 NeuronEdge,
-                std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
-                typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator,
+                typename Graph<Tn, Tv, Te>::EdgeMapType,
+                typename Graph<Tn, Tv, Te>::EdgeMapType::iterator,
                 AxonRootEdgePred
             > 
         {
@@ -2298,8 +2379,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                         AxonRootEdge,
                         typename Graph<Tn, Tv, Te>::Edge,
                         NeuronEdge,
-                        std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
-                        typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator,
+                        typename Graph<Tn, Tv, Te>::EdgeMapType,
+                        typename Graph<Tn, Tv, Te>::EdgeMapType::iterator,
                         AxonRootEdgePred
                       >()
                 {
@@ -2307,13 +2388,13 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
 
                 axon_rootedge_iterator(
                     CellNetwork                                                                        *C,
-                    typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator  it)
+                    typename Graph<Tn, Tv, Te>::EdgeMapType::iterator  it)
                         :   CellNetworkIterator<
                                 AxonRootEdge,
                                 typename Graph<Tn, Tv, Te>::Edge,
                                 NeuronEdge,
-                                std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
-                                typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator,
+                                typename Graph<Tn, Tv, Te>::EdgeMapType,
+                                typename Graph<Tn, Tv, Te>::EdgeMapType::iterator,
                                 AxonRootEdgePred
                             >(C, &(C->E), it, &(C->isAxonRootEdge) )
                 {
@@ -2324,8 +2405,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                                 AxonRootEdge,
                                 typename Graph<Tn, Tv, Te>::Edge,
                                 NeuronEdge,
-                                std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
-                                typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator,
+                                typename Graph<Tn, Tv, Te>::EdgeMapType,
+                                typename Graph<Tn, Tv, Te>::EdgeMapType::iterator,
                                 AxonRootEdgePred
                             >(x)
                 {
@@ -2341,8 +2422,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                 const AxonRootEdge,
                 typename Graph<Tn, Tv, Te>::Edge,
                 NeuronEdge,
-                std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
-                typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::const_iterator,
+                typename Graph<Tn, Tv, Te>::EdgeMapType,
+                typename Graph<Tn, Tv, Te>::EdgeMapType::const_iterator,
                 AxonRootEdgePred
             > 
         {
@@ -2353,13 +2434,13 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
 
                 axon_rootedge_const_iterator(
                     CellNetwork                                                                                *C,
-                    typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::const_iterator    it)
+                    typename Graph<Tn, Tv, Te>::EdgeMapType::const_iterator    it)
                         : CellNetworkIterator<
                               const AxonRootEdge,
                               typename Graph<Tn, Tv, Te>::Edge,
                               NeuronEdge,
-                              std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
-                              typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::const_iterator,
+                              typename Graph<Tn, Tv, Te>::EdgeMapType,
+                              typename Graph<Tn, Tv, Te>::EdgeMapType::const_iterator,
                               AxonRootEdgePred
                           >(C, &(C->E), it, &(C->isAxonRootEdge) )
                 {
@@ -2370,8 +2451,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                               const AxonRootEdge,
                               typename Graph<Tn, Tv, Te>::Edge,
                               NeuronEdge,
-                              std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
-                              typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::const_iterator,
+                              typename Graph<Tn, Tv, Te>::EdgeMapType,
+                              typename Graph<Tn, Tv, Te>::EdgeMapType::const_iterator,
                               AxonRootEdgePred
                           >(x)
                 {
@@ -2398,8 +2479,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                 DendriteRootEdge,
                 typename Graph<Tn, Tv, Te>::Edge,
                 NeuronEdge,
-                std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
-                typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator,
+                typename Graph<Tn, Tv, Te>::EdgeMapType,
+                typename Graph<Tn, Tv, Te>::EdgeMapType::iterator,
                 DendriteRootEdgePred
             > 
         {
@@ -2409,8 +2490,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                         DendriteRootEdge,
                         typename Graph<Tn, Tv, Te>::Edge,
                         NeuronEdge,
-                        std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
-                        typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator,
+                        typename Graph<Tn, Tv, Te>::EdgeMapType,
+                        typename Graph<Tn, Tv, Te>::EdgeMapType::iterator,
                         DendriteRootEdgePred
                       >()
                 {
@@ -2418,13 +2499,13 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
 
                 dendrite_rootedge_iterator(
                     CellNetwork                                                                        *C,
-                    typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator  it)
+                    typename Graph<Tn, Tv, Te>::EdgeMapType::iterator  it)
                         :   CellNetworkIterator<
                                 DendriteRootEdge,
                                 typename Graph<Tn, Tv, Te>::Edge,
                                 NeuronEdge,
-                                std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
-                                typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator,
+                                typename Graph<Tn, Tv, Te>::EdgeMapType,
+                                typename Graph<Tn, Tv, Te>::EdgeMapType::iterator,
                                 DendriteRootEdgePred
                             >(C, &(C->E), it, &(C->isDendriteRootEdge) )
                 {
@@ -2435,8 +2516,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                                 DendriteRootEdge,
                                 typename Graph<Tn, Tv, Te>::Edge,
                                 NeuronEdge,
-                                std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
-                                typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator,
+                                typename Graph<Tn, Tv, Te>::EdgeMapType,
+                                typename Graph<Tn, Tv, Te>::EdgeMapType::iterator,
                                 DendriteRootEdgePred
                             >(x)
                 {
@@ -2452,8 +2533,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                 const DendriteRootEdge,
                 typename Graph<Tn, Tv, Te>::Edge,
                 NeuronEdge,
-                std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
-                typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::const_iterator,
+                typename Graph<Tn, Tv, Te>::EdgeMapType,
+                typename Graph<Tn, Tv, Te>::EdgeMapType::const_iterator,
                 DendriteRootEdgePred
             > 
         {
@@ -2464,13 +2545,13 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
 
                 dendrite_rootedge_const_iterator(
                     CellNetwork                                                                                *C,
-                    typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::const_iterator    it)
+                    typename Graph<Tn, Tv, Te>::EdgeMapType::const_iterator    it)
                         : CellNetworkIterator<
                               const DendriteRootEdge,
                               typename Graph<Tn, Tv, Te>::Edge,
                               NeuronEdge,
-                              std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
-                              typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::const_iterator,
+                              typename Graph<Tn, Tv, Te>::EdgeMapType,
+                              typename Graph<Tn, Tv, Te>::EdgeMapType::const_iterator,
                               DendriteRootEdgePred
                           >(C, &(C->E), it, &(C->isDendriteRootEdge) )
                 {
@@ -2481,8 +2562,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                               const DendriteRootEdge,
                               typename Graph<Tn, Tv, Te>::Edge,
                               NeuronEdge,
-                              std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
-                              typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::const_iterator,
+                              typename Graph<Tn, Tv, Te>::EdgeMapType,
+                              typename Graph<Tn, Tv, Te>::EdgeMapType::const_iterator,
                               DendriteRootEdgePred
                           >(x)
                 {
@@ -2509,8 +2590,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                 NeuriteSegment,
                 typename Graph<Tn, Tv, Te>::Edge,
                 NeuronEdge,
-                std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
-                typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator,
+                typename Graph<Tn, Tv, Te>::EdgeMapType,
+                typename Graph<Tn, Tv, Te>::EdgeMapType::iterator,
                 NeuriteSegmentPred
             > 
         {
@@ -2520,8 +2601,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                         NeuriteSegment,
                         typename Graph<Tn, Tv, Te>::Edge,
                         NeuronEdge,
-                        std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
-                        typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator,
+                        typename Graph<Tn, Tv, Te>::EdgeMapType,
+                        typename Graph<Tn, Tv, Te>::EdgeMapType::iterator,
                         NeuriteSegmentPred
                       >()
                 {
@@ -2529,13 +2610,13 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
 
                 neurite_segment_iterator(
                     CellNetwork                                                                        *C,
-                    typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator  it)
+                    typename Graph<Tn, Tv, Te>::EdgeMapType::iterator  it)
                         :   CellNetworkIterator<
                                 NeuriteSegment,
                                 typename Graph<Tn, Tv, Te>::Edge,
                                 NeuronEdge,
-                                std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
-                                typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator,
+                                typename Graph<Tn, Tv, Te>::EdgeMapType,
+                                typename Graph<Tn, Tv, Te>::EdgeMapType::iterator,
                                 NeuriteSegmentPred
                             >(C, &(C->E), it, &(C->isNeuriteSegment) )
                 {
@@ -2546,8 +2627,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                                 NeuriteSegment,
                                 typename Graph<Tn, Tv, Te>::Edge,
                                 NeuronEdge,
-                                std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
-                                typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator,
+                                typename Graph<Tn, Tv, Te>::EdgeMapType,
+                                typename Graph<Tn, Tv, Te>::EdgeMapType::iterator,
                                 NeuriteSegmentPred
                             >(x)
                 {
@@ -2598,8 +2679,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                 const NeuriteSegment,
                 typename Graph<Tn, Tv, Te>::Edge,
                 NeuronEdge,
-                std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
-                typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::const_iterator,
+                typename Graph<Tn, Tv, Te>::EdgeMapType,
+                typename Graph<Tn, Tv, Te>::EdgeMapType::const_iterator,
                 NeuriteSegmentPred
             > 
         {
@@ -2610,13 +2691,13 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
 
                 neurite_segment_const_iterator(
                     CellNetwork                                                                                *C,
-                    typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::const_iterator    it)
+                    typename Graph<Tn, Tv, Te>::EdgeMapType::const_iterator    it)
                         : CellNetworkIterator<
                             const NeuriteSegment,
                             typename Graph<Tn, Tv, Te>::Edge,
                             NeuronEdge,
-                            std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
-                            typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::const_iterator,
+                            typename Graph<Tn, Tv, Te>::EdgeMapType,
+                            typename Graph<Tn, Tv, Te>::EdgeMapType::const_iterator,
                             NeuriteSegmentPred
                         >(C, &(C->E), it, &(C->isNeuriteSegment) )
                 {
@@ -2627,8 +2708,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                             const NeuriteSegment,
                             typename Graph<Tn, Tv, Te>::Edge,
                             NeuronEdge,
-                            std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
-                            typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::const_iterator,
+                            typename Graph<Tn, Tv, Te>::EdgeMapType,
+                            typename Graph<Tn, Tv, Te>::EdgeMapType::const_iterator,
                             NeuriteSegmentPred
                         >(x)
                 {
@@ -2682,8 +2763,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                 AxonSegment,
                 typename Graph<Tn, Tv, Te>::Edge,
                 NeuronEdge,
-                std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
-                typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator,
+                typename Graph<Tn, Tv, Te>::EdgeMapType,
+                typename Graph<Tn, Tv, Te>::EdgeMapType::iterator,
                 AxonSegmentPred
             > 
         {
@@ -2693,8 +2774,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                         AxonSegment,
                         typename Graph<Tn, Tv, Te>::Edge,
                         NeuronEdge,
-                        std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
-                        typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator,
+                        typename Graph<Tn, Tv, Te>::EdgeMapType,
+                        typename Graph<Tn, Tv, Te>::EdgeMapType::iterator,
                         AxonSegmentPred
                       >()
                 {
@@ -2702,13 +2783,13 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
 
                 axon_segment_iterator(
                     CellNetwork                                                                        *C,
-                    typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator  it)
+                    typename Graph<Tn, Tv, Te>::EdgeMapType::iterator  it)
                         :   CellNetworkIterator<
                                 AxonSegment,
                                 typename Graph<Tn, Tv, Te>::Edge,
                                 NeuronEdge,
-                                std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
-                                typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator,
+                                typename Graph<Tn, Tv, Te>::EdgeMapType,
+                                typename Graph<Tn, Tv, Te>::EdgeMapType::iterator,
                                 AxonSegmentPred
                             >(C, &(C->E), it, &(C->isAxonSegment) )
                 {
@@ -2719,8 +2800,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                                 AxonSegment,
                                 typename Graph<Tn, Tv, Te>::Edge,
                                 NeuronEdge,
-                                std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
-                                typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator,
+                                typename Graph<Tn, Tv, Te>::EdgeMapType,
+                                typename Graph<Tn, Tv, Te>::EdgeMapType::iterator,
                                 AxonSegmentPred
                             >(x)
                 {
@@ -2736,8 +2817,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                 const AxonSegment,
                 typename Graph<Tn, Tv, Te>::Edge,
                 NeuronEdge,
-                std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
-                typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::const_iterator,
+                typename Graph<Tn, Tv, Te>::EdgeMapType,
+                typename Graph<Tn, Tv, Te>::EdgeMapType::const_iterator,
                 AxonSegmentPred
             > 
         {
@@ -2748,13 +2829,13 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
 
                 axon_segment_const_iterator(
                     CellNetwork                                                                                *C,
-                    typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::const_iterator    it)
+                    typename Graph<Tn, Tv, Te>::EdgeMapType::const_iterator    it)
                         : CellNetworkIterator<
                             const AxonSegment,
                             typename Graph<Tn, Tv, Te>::Edge,
                             NeuronEdge,
-                            std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
-                            typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::const_iterator,
+                            typename Graph<Tn, Tv, Te>::EdgeMapType,
+                            typename Graph<Tn, Tv, Te>::EdgeMapType::const_iterator,
                             AxonSegmentPred
                         >(C, &(C->E), it, &(C->isAxonSegment) )
                 {
@@ -2765,8 +2846,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                             const AxonSegment,
                             typename Graph<Tn, Tv, Te>::Edge,
                             NeuronEdge,
-                            std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
-                            typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::const_iterator,
+                            typename Graph<Tn, Tv, Te>::EdgeMapType,
+                            typename Graph<Tn, Tv, Te>::EdgeMapType::const_iterator,
                             AxonSegmentPred
                         >(x)
                 {
@@ -2793,8 +2874,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                 DendriteSegment,
                 typename Graph<Tn, Tv, Te>::Edge,
                 NeuronEdge,
-                std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
-                typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator,
+                typename Graph<Tn, Tv, Te>::EdgeMapType,
+                typename Graph<Tn, Tv, Te>::EdgeMapType::iterator,
                 DendriteSegmentPred
             > 
         {
@@ -2804,8 +2885,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                         DendriteSegment,
                         typename Graph<Tn, Tv, Te>::Edge,
                         NeuronEdge,
-                        std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
-                        typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator,
+                        typename Graph<Tn, Tv, Te>::EdgeMapType,
+                        typename Graph<Tn, Tv, Te>::EdgeMapType::iterator,
                         DendriteSegmentPred
                       >()
                 {
@@ -2813,13 +2894,13 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
 
                 dendrite_segment_iterator(
                     CellNetwork                                                                        *C,
-                    typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator  it)
+                    typename Graph<Tn, Tv, Te>::EdgeMapType::iterator  it)
                         :   CellNetworkIterator<
                                 DendriteSegment,
                                 typename Graph<Tn, Tv, Te>::Edge,
                                 NeuronEdge,
-                                std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
-                                typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator,
+                                typename Graph<Tn, Tv, Te>::EdgeMapType,
+                                typename Graph<Tn, Tv, Te>::EdgeMapType::iterator,
                                 DendriteSegmentPred
                             >(C, &(C->E), it, &(C->isDendriteSegment) )
                 {
@@ -2830,8 +2911,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                                 DendriteSegment,
                                 typename Graph<Tn, Tv, Te>::Edge,
                                 NeuronEdge,
-                                std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
-                                typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator,
+                                typename Graph<Tn, Tv, Te>::EdgeMapType,
+                                typename Graph<Tn, Tv, Te>::EdgeMapType::iterator,
                                 DendriteSegmentPred
                             >(x)
                 {
@@ -2847,8 +2928,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                 const DendriteSegment,
                 typename Graph<Tn, Tv, Te>::Edge,
                 NeuronEdge,
-                std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
-                typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::const_iterator,
+                typename Graph<Tn, Tv, Te>::EdgeMapType,
+                typename Graph<Tn, Tv, Te>::EdgeMapType::const_iterator,
                 DendriteSegmentPred
             > 
         {
@@ -2859,13 +2940,13 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
 
                 dendrite_segment_const_iterator(
                     CellNetwork                                                                                *C,
-                    typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::const_iterator    it)
+                    typename Graph<Tn, Tv, Te>::EdgeMapType::const_iterator    it)
                         : CellNetworkIterator<
                             const DendriteSegment,
                             typename Graph<Tn, Tv, Te>::Edge,
                             NeuronEdge,
-                            std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
-                            typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::const_iterator,
+                            typename Graph<Tn, Tv, Te>::EdgeMapType,
+                            typename Graph<Tn, Tv, Te>::EdgeMapType::const_iterator,
                             DendriteSegmentPred
                         >(C, &(C->E), it, &(C->isDendriteSegment) )
                 {
@@ -2876,8 +2957,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                             const DendriteSegment,
                             typename Graph<Tn, Tv, Te>::Edge,
                             NeuronEdge,
-                            std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
-                            typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::const_iterator,
+                            typename Graph<Tn, Tv, Te>::EdgeMapType,
+                            typename Graph<Tn, Tv, Te>::EdgeMapType::const_iterator,
                             DendriteSegmentPred
                         >(x)
                 {
@@ -2902,7 +2983,7 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
             NeuronEdge,
             typename Graph<Tn, Tv, Te>::Edge,
             NeuronEdge,
-            std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
+            typename Graph<Tn, Tv, Te>::EdgeMapType,
             NeuronEdgePred
         > neuron_edge_iteartor;
 
@@ -2910,7 +2991,7 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
             NeuriteSegment,
             typename Graph<Tn, Tv, Te>::Edge,
             NeuronEdge,
-            std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
+            typename Graph<Tn, Tv, Te>::EdgeMapType,
             NeuriteSegmentPred
         > neurite_segment_iterator;
 
@@ -2922,7 +3003,7 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
          *
          * it relies and depends on the internally used data structure for vertices / edges
          *
-         *      std::map<uint32_t, {Vertex, Edge, Soma, NeuriteSegment, ...}PointerType>
+         *      Graph::{Vertex,Edge}MapType, i.e. DenseIdMap<{Vertex, Edge, Soma, NeuriteSegment, ...}PointerType>
          *
          * it contains the code shared between all accessors for specific vertex / edge types. since
          * explicit down-casting should be avoided as far as possible, an individual accessor will
@@ -3006,7 +3087,7 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                 NeuronVertex,
                 typename Graph<Tn, Tv, Te>::Vertex,
                 NeuronVertex,
-                std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>,
+                typename Graph<Tn, Tv, Te>::VertexMapType,
                 NeuronVertexPred,
                 neuron_iterator,
                 neuron_const_iterator,
@@ -3035,7 +3116,7 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                 NeuriteVertex,
                 typename Graph<Tn, Tv, Te>::Vertex,
                 NeuronVertex,
-                std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>,
+                typename Graph<Tn, Tv, Te>::VertexMapType,
                 NeuriteVertexPred,
                 neurite_iterator,
                 neurite_const_iterator,
@@ -3065,7 +3146,7 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                 SomaVertex,
                 typename Graph<Tn, Tv, Te>::Vertex,
                 NeuronVertex,
-                std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>,
+                typename Graph<Tn, Tv, Te>::VertexMapType,
                 SomaVertexPred,
                 soma_iterator,
                 soma_const_iterator,
@@ -3100,7 +3181,7 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                 AxonVertex,
                 typename Graph<Tn, Tv, Te>::Vertex,
                 NeuronVertex,
-                std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>,
+                typename Graph<Tn, Tv, Te>::VertexMapType,
                 AxonVertexPred,
                 axon_iterator,
                 axon_const_iterator,
@@ -3136,7 +3217,7 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                 DendriteVertex,
                 typename Graph<Tn, Tv, Te>::Vertex,
                 NeuronVertex,
-                std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>,
+                typename Graph<Tn, Tv, Te>::VertexMapType,
                 DendriteVertexPred,
                 dendrite_iterator,
                 dendrite_const_iterator,
@@ -3177,7 +3258,7 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                 NeuronEdge,
                 typename Graph<Tn, Tv, Te>::Edge,
                 NeuronEdge,
-                std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
+                typename Graph<Tn, Tv, Te>::EdgeMapType,
                 NeuronEdgePred,
                 neuron_edge_iterator,
                 neuron_edge_const_iterator,
@@ -3207,7 +3288,7 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                 NeuriteRootEdge,
                 typename Graph<Tn, Tv, Te>::Edge,
                 NeuronEdge,
-                std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
+                typename Graph<Tn, Tv, Te>::EdgeMapType,
                 NeuriteRootEdgePred,
                 neurite_rootedge_iterator,
                 neurite_rootedge_const_iterator,
@@ -3247,7 +3328,7 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                 AxonRootEdge,
                 typename Graph<Tn, Tv, Te>::Edge,
                 NeuronEdge,
-                std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
+                typename Graph<Tn, Tv, Te>::EdgeMapType,
                 AxonRootEdgePred,
                 axon_rootedge_iterator,
                 axon_rootedge_const_iterator,
@@ -3281,7 +3362,7 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                 DendriteRootEdge,
                 typename Graph<Tn, Tv, Te>::Edge,
                 NeuronEdge,
-                std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
+                typename Graph<Tn, Tv, Te>::EdgeMapType,
                 DendriteRootEdgePred,
                 dendrite_rootedge_iterator,
                 dendrite_rootedge_const_iterator,
@@ -3316,7 +3397,7 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                 NeuriteSegment,
                 typename Graph<Tn, Tv, Te>::Edge,
                 NeuronEdge,
-                std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
+                typename Graph<Tn, Tv, Te>::EdgeMapType,
                 NeuriteSegmentPred,
                 neurite_segment_iterator,
                 neurite_segment_const_iterator,
@@ -3363,7 +3444,7 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                 AxonSegment,
                 typename Graph<Tn, Tv, Te>::Edge,
                 NeuronEdge,
-                std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
+                typename Graph<Tn, Tv, Te>::EdgeMapType,
                 AxonSegmentPred,
                 axon_segment_iterator,
                 axon_segment_const_iterator,
@@ -3395,7 +3476,7 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                 DendriteSegment,
                 typename Graph<Tn, Tv, Te>::Edge,
                 NeuronEdge,
-                std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
+                typename Graph<Tn, Tv, Te>::EdgeMapType,
                 DendriteSegmentPred,
                 dendrite_segment_iterator,
                 dendrite_segment_const_iterator,
@@ -3455,6 +3536,15 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
         Vec3<R>                                     global_coordinate_displacement;
         R                                           global_coordinate_scaling_factor;
 
+        /* memoized integral and chordal depths of all neurite sub-trees, indexed by vertex id, see
+         * getNeuriteSubTreeDepths(). valid if neurite_subtree_depths_valid is set and the topology version of the
+         * graph still equals neurite_subtree_depths_version. */
+        std::vector<std::pair<uint32_t, R>>         neurite_subtree_depths;
+        bool                                        neurite_subtree_depths_valid;
+        uint64_t                                    neurite_subtree_depths_version;
+
+        void                                        computeNeuriteSubTreeDepths();
+
     /* "access declaration", achieved with using delcarations in C++11, to make vertex / edge accessor from Graph<Tn,
      * Tv, Te> private to the public: it must not be possible to insert generic Graph::Vertex into a cell network */
     /*
@@ -3643,9 +3733,44 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                                                         bool                                          (&edge_termination_pred)(EdgeType const &e),
 #endif
 
+        /* templated fast path of the above traversal: predicates and visitors are taken by type and can thus be
+         * inlined, and nothing is materialized into lists.
+         *
+         *  -   vertex_pred(NeuronVertex const &) / edge_pred(NeuronEdge const &) restrict the traversal as above.
+         *
+         *  -   vertex_visitor(VertexType &v, R dist) is called once for each reached vertex of type VertexType, with
+         *      dist = d(vstart, v) along the traversal. returning false terminates the traversal.
+         *
+         *  -   edge_visitor(EdgeType &e) is called once for each traversed edge of type EdgeType whose neighbour
+         *      vertex is of type VertexType.
+         *
+         *  -   if parents is not NULL, it is resized to the vertex id range and (*parents)[id] receives the vertex
+         *      from which the vertex with the given id has been reached, NULL for vstart and unreached vertices. paths
+         *      are thereby recorded as parent pointers instead of copying a path list per vertex. */
+        template <
+            typename VertexType,
+            typename EdgeType,
+            typename VertexPred,
+            typename EdgePred,
+            typename VertexVisitor,
+            typename EdgeVisitor
+        >
+        void                                        traverseBreadthFirst(
+                                                        neuron_iterator                 vstart_it,
+                                                        bool const                     &directed,
+                                                        VertexPred const               &vertex_pred,
+                                                        EdgePred const                 &edge_pred,
+                                                        VertexVisitor                 &&vertex_visitor,
+                                                        EdgeVisitor                   &&edge_visitor,
+                                                        std::vector<NeuronVertex *>    *parents = NULL,
+                                                        int32_t                         tid_arg = -1);
+
         /* get both integral depth (graph-theoretic depth) and chord-depth (chord-length of longest path to a neurite
-         * leaf) of neurite sub-tree rooted in neurite vertex n_it */
+         * leaf) of neurite sub-tree rooted in neurite vertex n_it. the depths of all neurite vertices are computed in a
+         * single post-order pass on first use and looked up afterwards, until the topology of the network changes or
+         * invalidateNeuriteSubTreeDepths() is called, which NeuriteVertex::setPosition() does. */
         std::pair<uint32_t, R>                      getNeuriteSubTreeDepths(neurite_iterator n_it);
+        void                                        invalidateNeuriteSubTreeDepths();
 
         /* get directed path and path lengths from vertex u to v */
         void                                        getDirectedPath(
@@ -3661,8 +3786,12 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                                                         std::list<NeuriteVertex *>     &reachable_neurite_vertices,
                                                         std::list<NeuriteSegment *>    &reachable_neurite_segments);
 
-        /* statistical methods */
-        CellNetworkStatistics                       computeStatistics() const;
+        /* statistical methods. computeStatistics() computes all fields but the morphological diameter in one pass over
+         * the neuron vertices and one over the neurite segments, both in fixed blocks on up to nthreads threads,
+         * followed by the pairwise vertex distances, again on up to nthreads threads. per-block results are combined
+         * in block order, so the result does not depend on nthreads. the segment statistics are defined as in
+         * getNeuriteSegmentLengthStat() and getNeuriteSegmentAngleStat() below. */
+        CellNetworkStatistics                       computeStatistics(uint32_t nthreads = 1) const;
 
         R                                           getTotalNeuriteTreeLength() const;
 
@@ -3670,10 +3799,11 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
         R                                           getMorphologicalDiameter(soma_iterator s_it);
 
         void                                        getNeuronVerticesDistanceStat(
-                                                        R  &v_dist_min,
-                                                        R  &v_dist_max,
-                                                        R  &v_dist_avg,
-                                                        R  &v_dist_sigma) const;
+                                                        R          &v_dist_min,
+                                                        R          &v_dist_max,
+                                                        R          &v_dist_avg,
+                                                        R          &v_dist_sigma,
+                                                        uint32_t    nthreads = 1) const;
 
         void                                        getNeuronVerticesCoordinateStat(
                                                         R  &v_xmin,
@@ -3709,6 +3839,9 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                                                         R  &ns_radius_ratio_avg,
                                                         R  &ns_radius_ratio_sigma) const;
 
+        /* length and reduced length of all neurite segments. the reduced length of a segment (u, v) is its length
+         * minus the radii of u and v, i.e. the length of the part of the segment that is not covered by the spheres
+         * around its end vertices. it is negative for segments whose end spheres overlap. */
         void                                        getNeuriteSegmentLengthStat(
                                                         R  &ns_len_min,
                                                         R  &ns_len_max,
@@ -3720,6 +3853,10 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                                                         R  &ns_rlen_avg,
                                                         R  &ns_rlen_sigma) const;
 
+        /* angles between all neurite segments (u, v) and the segment (p, u) to the unique parent p of u, which may be
+         * a soma. NeuriteSegment::getAngle() is undefined if u has no unique parent, such segments are skipped and do
+         * not contribute to the statistic. in a network that passes checkTopology(), every neurite vertex has a
+         * unique parent (for neurite root vertices: their soma), so segments are only skipped in malformed networks. */
         void                                        getNeuriteSegmentAngleStat(
                                                         R  &ns_angle_min,
                                                         R  &ns_angle_max,
@@ -0,0 +1,221 @@
+/*
+ * This file is part of
+ *
+ * AnaMorph: a framework for geometric modelling, consistency analysis and surface
+ * mesh generation of anatomically reconstructed neuron morphologies.
+ * 
+ * Copyright (c) 2013-2017: G-CSC, Goethe University Frankfurt - Queisser group
+ * Author: Konstantin Mörschel
+ * 
+ * AnaMorph is free software: Redistribution and use in source and binary forms,
+ * with or without modification, are permitted under the terms of the
+ * GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works:
+ * "Based on AnaMorph (https://github.com/NeuroBox3D/AnaMorph)."
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works:
+ * "Based on AnaMorph (https://github.com/NeuroBox3D/AnaMorph)."
+ *
+ * (3) Neither the name "AnaMorph" nor the names of its contributors may be
+ * used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * (4) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Mörschel K, Breit M, Queisser G. Generating neuron geometries for detailed
+ *   three-dimensional simulations using AnaMorph. Neuroinformatics (2017)"
+ * "Grein S, Stepniewski M, Reiter S, Knodel MM, Queisser G.
+ *   1D-3D hybrid modelling – from multi-compartment models to full resolution
+ *   models in space and time. Frontiers in Neuroinformatics 8, 68 (2014)"
+ * "Breit M, Stepniewski M, Grein S, Gottmann P, Reinhardt L, Queisser G.
+ *   Anatomically detailed and large-scale simulations studying synapse loss
+ *   and synchrony using NeuroBox. Frontiers in Neuroanatomy 10 (2016)"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU Lesser General Public License for more details.
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef DENSE_ID_MAP_HH
+#define DENSE_ID_MAP_HH
+
+#include <vector>
+#include <utility>
+#include <iterator>
+#include <memory>
+
+#include "common.hh"
+
+/* map from ids to pointers of type T for ids drawn from a dense range, as handed out by IdQueue, which reuses freed
+ * ids smallest first. the value of id i is stored in slot i of a vector, so find(), insert() and erase() take constant
+ * (amortized) time and iteration walks the slots in increasing id order, skipping unused ones. NULL marks unused ids,
+ * so NULL can't be stored.
+ *
+ * the interface is the subset of std::map used for the element storage of Graph, with the same iterator guarantees:
+ * iterators are (container, id) pairs into a separately allocated block of slots, so they remain valid when other
+ * elements are inserted or erased, end() is never invalidated, and swap() carries iterators along with the elements.
+ * unlike std::map, the value type is std::pair<uint32_t, T>, whose id must not be changed through an iterator. */
+template <typename T>
+class DenseIdMap {
+    public:
+        typedef uint32_t                key_type;
+        typedef T                       mapped_type;
+        typedef std::pair<uint32_t, T>  value_type;
+
+    private:
+        /* slots and number of used slots */
+        struct Slots {
+            std::vector<value_type>     v;
+            size_t                      n;
+        };
+
+        /* slot index of end() */
+        static size_t const             npos = ~(size_t)0;
+
+        std::unique_ptr<Slots>          s;
+
+        /* index of the first used slot >= j, npos if there is none */
+        size_t                          firstUsed(size_t j) const;
+
+    public:
+        template <
+            typename ValueType,
+            typename SlotsType
+        >
+        class Iterator : public std::iterator<std::bidirectional_iterator_tag, ValueType>
+        {
+            friend class DenseIdMap<T>;
+            template <typename, typename> friend class Iterator;
+
+            private:
+                SlotsType              *s;
+                size_t                  i;
+
+                Iterator(SlotsType *s, size_t i)
+                : s(s), i(i)
+                {}
+
+            public:
+                Iterator()
+                : s(NULL), i(DenseIdMap::npos)
+                {}
+
+                /* allow implicit conversion of iterator to const_iterator */
+                template <typename V, typename S>
+                Iterator(Iterator<V, S> const &x)
+                : s(x.s), i(x.i)
+                {}
+
+                inline Iterator &
+                operator++()
+                {
+                    size_t const n = this->s->v.size();
+                    for (this->i++; this->i < n && !this->s->v[this->i].second; this->i++);
+                    if (this->i >= n) {
+                        this->i = DenseIdMap::npos;
+                    }
+                    return (*this);
+                }
+
+                inline Iterator
+                operator++(int)
+                {
+                    Iterator tmp(*this);
+                    this->operator++();
+                    return tmp;
+                }
+
+                /* decrementing end() yields the element with the largest id */
+                inline Iterator &
+                operator--()
+                {
+                    size_t j = (this->i == DenseIdMap::npos) ? this->s->v.size() : this->i;
+                    while (j > 0 && !this->s->v[--j].second);
+                    this->i = j;
+                    return (*this);
+                }
+
+                inline Iterator
+                operator--(int)
+                {
+                    Iterator tmp(*this);
+                    this->operator--();
+                    return tmp;
+                }
+
+                inline bool
+                operator==(Iterator const &x) const
+                {
+                    return (this->s == x.s && this->i == x.i);
+                }
+
+                inline bool
+                operator!=(Iterator const &x) const
+                {
+                    return !(this->operator==(x));
+                }
+
+                inline ValueType &
+                operator*() const
+                {
+                    return this->s->v[this->i];
+                }
+
+                inline ValueType *
+                operator->() const
+                {
+                    return &(this->s->v[this->i]);
+                }
+        };
+
+        typedef Iterator<value_type, Slots>                 iterator;
+        typedef Iterator<value_type const, Slots const>     const_iterator;
+        typedef std::reverse_iterator<iterator>             reverse_iterator;
+        typedef std::reverse_iterator<const_iterator>       const_reverse_iterator;
+
+                                        DenseIdMap();
+                                        DenseIdMap(DenseIdMap const &x);
+        DenseIdMap                     &operator=(DenseIdMap const &x);
+
+        iterator                        begin();
+        iterator                        end();
+        const_iterator                  begin() const;
+        const_iterator                  end() const;
+        reverse_iterator                rbegin();
+        reverse_iterator                rend();
+        const_reverse_iterator          rbegin() const;
+        const_reverse_iterator          rend() const;
+
+        bool                            empty() const;
+        size_t                          size() const;
+        void                            clear();
+        void                            swap(DenseIdMap &x);
+
+        iterator                        find(uint32_t id);
+        const_iterator                  find(uint32_t id) const;
+        size_t                          count(uint32_t id) const;
+        /* throws std::out_of_range if id is not contained, as std::map::at() */
+        T                              &at(uint32_t id);
+        T const                        &at(uint32_t id) const;
+
+        /* insert x.second under id x.first, unless the id is already taken. returns an iterator to the element with id
+         * x.first and whether x has been inserted. */
+        std::pair<iterator, bool>       insert(value_type const &x);
+
+        /* erase the element it refers to, returns an iterator to the element with the next larger id */
+        iterator                        erase(const_iterator it);
+        size_t                          erase(uint32_t id);
+};
+
+/* include header for template implementation */
+#include "../tsrc/DenseIdMap_impl.hh"
+
+#endif
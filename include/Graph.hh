@@ -49,6 +49,7 @@
 
 #include "common.hh"
 #include "IdQueue.hh"
+#include "DenseIdMap.hh"
 #include "Octree.hh"
 
 enum graph_error_types {
@@ -266,6 +267,11 @@ class Graph {
         typedef Graph<Tg, Tv, Te>::Vertex *      VertexPointerType;    
         typedef Graph<Tg, Tv, Te>::Edge *        EdgePointerType;    
 
+        /* id -> element maps. ids are handed out by the id queues, which reuse freed ids smallest first, so they are
+         * stored densely in id-indexed vectors. */
+        typedef DenseIdMap<VertexPointerType>   VertexMapType;
+        typedef DenseIdMap<EdgePointerType>     EdgeMapType;
+
     public:
         /* NOTE: typdefs are not treated as full types by either the standard or compilers. for
          * more type safety, declare vertex_iterator as template specialization of GraphIterator
@@ -274,14 +280,14 @@ class Graph {
         typedef
             GraphIterator<
                 Vertex,
-                std::map<uint32_t, VertexPointerType >
+                VertexMapType
             >   vertex_iterator;
         */
 
         class   vertex_iterator :
             public GraphIterator<
                 Graph<Tg, Tv, Te>::Vertex,
-                typename std::map<uint32_t, VertexPointerType>::iterator
+                typename VertexMapType::iterator
             >
         {
             public:
@@ -291,7 +297,7 @@ class Graph {
 
                 vertex_iterator(
                     Graph<Tg, Tv, Te>                                          *g,
-                    typename std::map<uint32_t, VertexPointerType >::iterator   it)
+                    typename VertexMapType::iterator   it)
                 {
                     this->graph     = g;
                     this->int_it    = it;
@@ -301,7 +307,7 @@ class Graph {
                 vertex_iterator(const vertex_iterator &x)
                     : GraphIterator<
                         Graph<Tg, Tv, Te>::Vertex,
-                        typename std::map<uint32_t, VertexPointerType>::iterator
+                        typename VertexMapType::iterator
                       >()
                 {
                     this->graph     = x.graph;
@@ -316,7 +322,7 @@ class Graph {
         class   vertex_const_iterator :
             public GraphIterator<
                 const Graph<Tg, Tv, Te>::Vertex,
-                typename std::map<uint32_t, VertexPointerType >::const_iterator
+                typename VertexMapType::const_iterator
             >
         {
             public:
@@ -326,7 +332,7 @@ class Graph {
 
                 vertex_const_iterator(
                     Graph<Tg, Tv, Te>                                                  *g,
-                    typename std::map<uint32_t, VertexPointerType >::const_iterator     it)
+                    typename VertexMapType::const_iterator     it)
                 {
                     this->graph     = g;
                     this->int_it    = it;
@@ -336,7 +342,7 @@ class Graph {
                 vertex_const_iterator(const vertex_const_iterator &x)
                     :  GraphIterator<
                         const Graph<Tg, Tv, Te>::Vertex,
-                        typename std::map<uint32_t, VertexPointerType>::const_iterator
+                        typename VertexMapType::const_iterator
                     > ()
                 {
                     this->graph     = x.graph;
@@ -349,7 +355,7 @@ class Graph {
                 vertex_const_iterator(const vertex_iterator &x)
                     :  GraphIterator<
                         const Graph<Tg, Tv, Te>::Vertex,
-                        typename std::map<uint32_t, VertexPointerType>::const_iterator
+                        typename VertexMapType::const_iterator
                     > ()
                 {
                     this->graph     = x.graph;
@@ -368,14 +374,14 @@ class Graph {
         /*
         typedef GraphIterator<
                 Edge,
-                std::map<uint32_t, EdgePointerType >
+                EdgeMapType
             > edge_iterator;
         */
 
         class   edge_iterator :
             public GraphIterator<
                 Graph<Tg, Tv, Te>::Edge,
-                typename std::map<uint32_t, EdgePointerType>::iterator
+                typename EdgeMapType::iterator
             >
         {
             public:
@@ -385,7 +391,7 @@ class Graph {
 
                 edge_iterator(
                     Graph<Tg, Tv, Te>                                          *g,
-                    typename std::map<uint32_t, EdgePointerType >::iterator     it)
+                    typename EdgeMapType::iterator     it)
                 {
                     this->graph     = g;
                     this->int_it    = it;
@@ -395,7 +401,7 @@ class Graph {
                 edge_iterator(const edge_iterator &x)
                     :  GraphIterator<
                         Graph<Tg, Tv, Te>::Edge,
-                        typename std::map<uint32_t, EdgePointerType>::iterator
+                        typename EdgeMapType::iterator
                     > ()
                 {
                     this->graph     = x.graph;
@@ -410,7 +416,7 @@ class Graph {
         class edge_const_iterator :
             public GraphIterator<
                 const Graph<Tg, Tv, Te>::Edge,
-                typename std::map<uint32_t, EdgePointerType>::const_iterator
+                typename EdgeMapType::const_iterator
             >
         {
             public:
@@ -420,7 +426,7 @@ class Graph {
 
                 edge_const_iterator(
                     Graph<Tg, Tv, Te>                                              *g,
-                    typename std::map<uint32_t, EdgePointerType >::const_iterator   it)
+                    typename EdgeMapType::const_iterator   it)
                 {
                     this->graph     = g;
                     this->int_it    = it;
@@ -430,7 +436,7 @@ class Graph {
                 edge_const_iterator(const edge_const_iterator &x)
                     : GraphIterator<
                         const Graph<Tg, Tv, Te>::Edge,
-                        typename std::map<uint32_t, EdgePointerType>::const_iterator
+                        typename EdgeMapType::const_iterator
                     > ()
                 {
                     this->graph     = x.graph;
@@ -443,7 +449,7 @@ class Graph {
                 edge_const_iterator(const edge_iterator &x)
                     : GraphIterator<
                         const Graph<Tg, Tv, Te>::Edge,
-                        typename std::map<uint32_t, EdgePointerType>::const_iterator
+                        typename EdgeMapType::const_iterator
                     > ()
                 {
                     this->graph     = x.graph;
@@ -486,13 +492,13 @@ class Graph {
 
             protected:
                 Graph<Tg, Tv, Te>                  *graph;
-                typename std::map<
-                    uint32_t,
-                    VertexPointerType >::iterator   g_vit;
+                typename VertexMapType::iterator    g_vit;
 
                 uint32_t                            blocked : 1,  current_traversal_id : 23, traversal_state : 8;
 
-                std::list<Edge *>                   in_edges, out_edges;
+                /* incident edges, sorted by id. vertex degrees in cell networks are tiny, so contiguous vectors beat
+                 * node-based lists for both traversal and memory footprint. */
+                std::vector<Edge *>                 in_edges, out_edges;
 
                 /* protected ctors */
                                                     Vertex();
@@ -518,7 +524,7 @@ class Graph {
                 Tv                                  vertex_data;
 
                 /* static getPtr() method required by iterator */
-                static Vertex *                     getPtr(typename std::map<uint32_t, VertexPointerType >::const_iterator const &it);
+                static Vertex *                     getPtr(typename VertexMapType::const_iterator const &it);
 
                 uint32_t
                 id() const
@@ -542,13 +548,27 @@ class Graph {
                 uint32_t
                 indeg() const
                 {
-                    return (this->getInNeighbours().size());
+                    return (this->in_edges.size());
                 }
 
                 uint32_t
                 outdeg() const
                 {
-                    return (this->getOutNeighbours().size());
+                    return (this->out_edges.size());
+                }
+
+                /* read-only access to the id-sorted incident edges without copying them into a list, intended for
+                 * tight traversal loops. */
+                std::vector<Edge *> const &
+                inEdges() const
+                {
+                    return (this->in_edges);
+                }
+
+                std::vector<Edge *> const &
+                outEdges() const
+                {
+                    return (this->out_edges);
                 }
 
                 bool
@@ -689,10 +709,7 @@ class Graph {
 
             protected:
                 Graph<Tg, Tv, Te>                  *graph;
-                typename std::map<
-                    uint32_t,
-                    EdgePointerType
-                >::iterator                         g_eit;
+                typename EdgeMapType::iterator      g_eit;
 
                 Vertex                             *v_src, *v_dst;
                 uint32_t                            blocked : 1,  current_traversal_id : 23, traversal_state : 8;
@@ -718,7 +735,7 @@ class Graph {
                 Te                                  edge_data;
 
                 /* static getPtr() method required by iterator */
-                static Edge *                       getPtr(typename std::map<uint32_t, EdgePointerType >::const_iterator const &it);
+                static Edge *                       getPtr(typename EdgeMapType::const_iterator const &it);
 
                 uint32_t                            id() const;
                 edge_iterator                       iterator() const;
@@ -861,15 +878,13 @@ class Graph {
         /* data object of template type Tg */
         Tg                                  graph_data;
 
-        /* vertex and face maps */
-        std::map<
-                uint32_t,
-                VertexPointerType
-            >                               V;
-        std::map<
-                uint32_t,
-                EdgePointerType
-            >                               E;
+        /* vertex and edge maps */
+        VertexMapType                       V;
+        EdgeMapType                         E;
+
+        /* incremented by every method that inserts, erases or reconnects vertices or edges, see
+         * getTopologyVersion() */
+        uint64_t                            topology_version;
 
         /* globally reset the traversal states of all vertices and faces to TRAV_UNSEEN and reset
          * the traversal id queue. */
@@ -883,38 +898,26 @@ class Graph {
          * all topological information inside the given vertex are erased (incident edges), the edge insertion method
          * takes two ids along with the pointer to verify that the allocated edge is indeed topologically intact. */
         std::pair<
-                typename std::map<uint32_t, VertexPointerType>::iterator,
+                typename VertexMapType::iterator,
                 bool
             >                               protectedVertexInsert(Vertex *v);
 
         std::pair<
-                typename std::map<uint32_t, EdgePointerType>::iterator,
+                typename EdgeMapType::iterator,
                 bool
             >                               protectedEdgeInsert(
                                                 Edge       *e,
                                                 uint32_t    v_src_id,
                                                 uint32_t    v_dst_id);
 
-        /* protected static methods to extract internal std::map<..,..> iterators from Graph::{vertex,edge}_iterators */
-        static typename std::map<
-                uint32_t,
-                VertexPointerType
-            >::const_iterator               getInternalIterator(vertex_const_iterator const &it);
+        /* protected static methods to extract internal map iterators from Graph::{vertex,edge}_iterators */
+        static typename VertexMapType::const_iterator   getInternalIterator(vertex_const_iterator const &it);
 
-        static typename std::map<
-                uint32_t,
-                VertexPointerType
-            >::iterator                     getInternalIterator(vertex_iterator const &it);
+        static typename VertexMapType::iterator         getInternalIterator(vertex_iterator const &it);
 
-        static typename std::map<
-                uint32_t,
-                EdgePointerType
-            >::const_iterator               getInternalIterator(edge_const_iterator const &it);
+        static typename EdgeMapType::const_iterator     getInternalIterator(edge_const_iterator const &it);
 
-        static typename std::map<
-                uint32_t,
-                EdgePointerType
-            >::iterator                     getInternalIterator(edge_iterator const &it);
+        static typename EdgeMapType::iterator           getInternalIterator(edge_iterator const &it);
 
     public:
         /* Graph public interface */
@@ -958,6 +961,11 @@ class Graph {
 
         uint32_t                            getFreshTraversalId();
 
+        /* topology version: changes whenever vertices or edges are inserted, erased or reconnected (or ids are
+         * renumbered), so that information derived from the topology can be cached and validated by comparing
+         * versions. */
+        uint64_t                            getTopologyVersion() const;
+
         /* append another graph: add vertices / faces and offset indices. not that no topological connection
          * between (this) graph and the appended graph is performed, it simply computes the union of two
          * distinct graphes inside one object. note also that the old ids (and of course all
@@ -62,6 +62,11 @@ class IdQueue {
         void        clear(uint32_t smallest_id = 0);
         uint32_t    getId();
         void        freeId(uint32_t id);
+
+        /* hand out n consecutive fresh ids [first, first + n) at once. this is possible if and only if no id larger
+         * than the next fresh id has been freed, in which case n calls to getId() would yield exactly these ids. if
+         * not, false is returned and the queue remains unchanged. */
+        bool        getIdRange(uint32_t n, uint32_t &first);
         
 };
 
@@ -0,0 +1,115 @@
+/*
+ * This file is part of
+ *
+ * AnaMorph: a framework for geometric modelling, consistency analysis and surface
+ * mesh generation of anatomically reconstructed neuron morphologies.
+ * 
+ * Copyright (c) 2013-2017: G-CSC, Goethe University Frankfurt - Queisser group
+ * Author: Konstantin Mörschel
+ * 
+ * AnaMorph is free software: Redistribution and use in source and binary forms,
+ * with or without modification, are permitted under the terms of the
+ * GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works:
+ * "Based on AnaMorph (https://github.com/NeuroBox3D/AnaMorph)."
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works:
+ * "Based on AnaMorph (https://github.com/NeuroBox3D/AnaMorph)."
+ *
+ * (3) Neither the name "AnaMorph" nor the names of its contributors may be
+ * used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * (4) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Mörschel K, Breit M, Queisser G. Generating neuron geometries for detailed
+ *   three-dimensional simulations using AnaMorph. Neuroinformatics (2017)"
+ * "Grein S, Stepniewski M, Reiter S, Knodel MM, Queisser G.
+ *   1D-3D hybrid modelling – from multi-compartment models to full resolution
+ *   models in space and time. Frontiers in Neuroinformatics 8, 68 (2014)"
+ * "Breit M, Stepniewski M, Grein S, Gottmann P, Reinhardt L, Queisser G.
+ *   Anatomically detailed and large-scale simulations studying synapse loss
+ *   and synchrony using NeuroBox. Frontiers in Neuroanatomy 10 (2016)"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU Lesser General Public License for more details.
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LINEAR_BVH_HH
+#define LINEAR_BVH_HH
+
+#include <vector>
+#include <utility>
+
+#include "common.hh"
+#include "BoundingBox.hh"
+
+/* linear bounding volume hierarchy over a static set of elements of type T, each of which is given with an axis-aligned
+ * bounding box. the elements are ordered along a Z-order curve by the 63-bit Morton codes of their bounding box
+ * centres (21 bits per axis, quantized relative to a scene bounding box), which are sorted with an LSD radix sort
+ * that runs on multiple threads for large inputs. runs of at most leaf_size consecutive elements form the leaves,
+ * which are then combined pairwise level by level into a complete binary tree. all node bounding boxes are stored in
+ * one flat array, and children are addressed implicitly, so neither construction nor queries allocate per-node
+ * memory.
+ *
+ * the hierarchy does not track its elements: if any bounding box changes, the hierarchy has to be rebuilt. */
+template <typename T, typename R>
+class LinearBVH {
+    private:
+        uint32_t                        leaf_size;
+
+        /* elements and their bounding boxes in Morton order */
+        std::vector<T>                  items;
+        std::vector<BoundingBox<R>>     item_bbs;
+
+        /* node bounding boxes of all levels, leaf level first. level l occupies indices
+         * [ level_offsets[l], level_offsets[l + 1] ), the children of node i on level l > 0 are nodes 2i and 2i + 1 on
+         * level l - 1, the elements of leaf i are elements [ i * leaf_size, (i + 1) * leaf_size ). */
+        std::vector<BoundingBox<R>>     nodes;
+        std::vector<size_t>             level_offsets;
+
+        static uint64_t                 expandBits21(uint64_t x);
+        static void                     radixSort(
+                                            std::vector<uint64_t>  &keys,
+                                            std::vector<uint32_t>  &perm,
+                                            uint32_t                nthreads);
+
+    public:
+                                        LinearBVH(uint32_t leaf_size = 8);
+
+        void                            clear();
+        bool                            empty() const;
+        size_t                          size() const;
+
+        /* number of bytes allocated by the hierarchy */
+        size_t                          memoryFootprint() const;
+
+        /* build the hierarchy for the given elements. scene_bb is used to quantize the bounding box centres and should
+         * contain all of them, centres outside are clamped. nthreads is an upper bound on the number of threads used
+         * for sorting, which are only used if the input is sufficiently large. */
+        void                            build(
+                                            std::vector<std::pair<T, BoundingBox<R>>> const    &elements,
+                                            BoundingBox<R> const                               &scene_bb,
+                                            uint32_t                                            nthreads = 1);
+
+        /* call f(e) for every element e whose stored bounding box intersects search_box (as defined by
+         * BoundingBox::operator&&()). elements are reported in Morton order, each at most once. */
+        template <typename F>
+        void                            query(
+                                            BoundingBox<R> const   &search_box,
+                                            F                      &&f) const;
+};
+
+/* include header for template implementation */
+#include "../tsrc/LinearBVH_impl.hh"
+
+#endif
@@ -51,7 +51,7 @@
 #include "Vec3.hh"
 #include "BoundingBox.hh"
 #include "IdQueue.hh"
-#include "Octree.hh"
+#include "LinearBVH.hh"
 
 enum mesh_error_types {
     MESH_NOERROR,
@@ -77,6 +77,23 @@ struct MeshEx : public std::runtime_error {
 struct MeshEx_OutOfRange : public MeshEx {
 };
 
+/* mesh file formats, see Mesh::writeFile(). ply and stl files are binary (little endian). */
+enum MeshFileFormat {
+    MESH_FILE_OBJ,
+    MESH_FILE_PLY,
+    MESH_FILE_STL
+};
+
+inline const char *
+meshFileExtension(MeshFileFormat format)
+{
+    switch (format) {
+        case MESH_FILE_PLY: return "ply";
+        case MESH_FILE_STL: return "stl";
+        default:            return "obj";
+    }
+}
+
 template<
     typename    Tm,
     typename    Tv,
@@ -518,7 +535,7 @@ class Mesh {
                     VertexPointerType >::iterator   m_vit;
 
                 Vec3<R>                             position;
-                uint32_t                            current_traversal_id : 23, traversal_state : 8;
+                uint32_t                            current_traversal_id : 23, traversal_state : 8, seam : 1;
                 Tv                                  data;
 
                 std::list<Vertex *>                 adjacent_vertices;
@@ -697,6 +714,13 @@ class Mesh {
 
                 bool                                isIsolated() const;
                 bool                                isManifold() const;
+
+                /* seam flag: set by MeshAlg::RedBlueUnion() and related algorithms on the corner vertices of the
+                 * intersection polygon, along which the two input meshes have been joined. the faces incident to
+                 * seam vertices are the faces created near the seam. the flag is preserved by
+                 * Mesh::moveAppend() and mesh checkpoints, newly created vertices are not seam vertices. */
+                bool                                isSeam() const;
+                void                                setSeam(bool seam);
         };
 
         /* forward declaration of FaceAccessor */
@@ -996,25 +1020,6 @@ class Mesh {
 
 
     private:
-        /* structs used for the template types of the employed Octree */
-        struct
-        Mesh_OctreeInfo {
-        };
-
-        struct
-        Mesh_OctreeNodeInfo {
-            Vec3<R>                 cube_min, cube_max;
-            std::list<Face *>       face_list;
-            std::list<Vertex *>     vertex_list;
-        };
-
-        struct
-        Mesh_OctreeIsecNodeInfo {
-            Vec3<R>                 cube_min, cube_max;
-            std::list<Face *>       A_facelist;
-            std::list<Face *>       B_facelist;
-        };
-
         /* id queues */
         IdQueue                             V_idq;
         IdQueue                             F_idq;
@@ -1033,45 +1038,100 @@ class Mesh {
         /* data object of template type Tm */
         Tm                                  data;
 
-        /* bounding box and octree */
+        /* bounding box and linear bounding volume hierarchies for faces and vertices, which are rebuilt by
+         * updateSpatialIndex() whenever spatial_index_updated has been reset by a modifying operation. */
         BoundingBox<R>                      bb;
-        Octree<
-                Mesh_OctreeInfo,
-                Mesh_OctreeNodeInfo,
-                R
-            >                              *O;
-        bool                                octree_updated;
-
-        static void
-        partitionOctree(
-            Octree<Mesh_OctreeInfo, Mesh_OctreeNodeInfo, R>    &O,
-            const Mesh<Tm, Tv, Tf, R>                          &m,
-            OctreeNode<Mesh_OctreeNodeInfo>                    *n,
-            std::list<Face *>                                  &rec_facelist,
-            std::list<Vertex *>                                &rec_vertexlist,
-            uint32_t                                            rec_depth,
-            uint32_t                                            max_elements,
-            uint32_t                                            max_rec_depth);
-
-        void
-        findOctreeRecursive(
-            Octree<Mesh_OctreeInfo, Mesh_OctreeNodeInfo, R>    *O,
-            OctreeNode<Mesh_OctreeNodeInfo>                    *n,
-            Vec3<R>                                             aabb_min,
-            Vec3<R>                                             aabb_max,
-            std::list<Vertex *>                                *vertex_list,
-            std::list<Face *>                                  *face_list);
-
-        void
-        getOctreeLeafCubes(
-            Octree<Mesh_OctreeInfo, Mesh_OctreeNodeInfo, R>    *O,
-            OctreeNode<Mesh_OctreeNodeInfo>                    *n,
-            std::list<std::pair<Vec3<R>, Vec3<R>>>             *cube_list);
+        LinearBVH<Face *, R>                face_bvh;
+        LinearBVH<Vertex *, R>              vertex_bvh;
+        bool                                spatial_index_updated;
+
+        /* number of threads used when the hierarchies are rebuilt on demand by the location routines, see
+         * setSpatialIndexThreads(). */
+        uint32_t                            spatial_index_nthreads;
+
+        /* incremental maintenance of face_bvh between rebuilds. while face_bvh_tracked is set, every face erased or
+         * modified since the last rebuild is contained in bvh_stale_faces, whose entries in face_bvh are ignored.
+         * every existing face inserted or modified since then is mapped to the serial of the level holding its
+         * current entry by bvh_changed_faces, 0 if it is still pending. pending faces are collected into a new level
+         * before a face query, and levels are merged with their predecessor as long as they are at least as large,
+         * so that there are logarithmically many. once the recorded changes outnumber half of face_bvh, tracking is
+         * dropped and face_bvh is rebuilt on the next query. changes of vertex positions through Vertex::pos() are
+         * not tracked, as for the hierarchies themselves. */
+        struct FaceBVHLevel {
+            uint32_t                        serial;
+            std::vector<Face *>             faces;
+            LinearBVH<Face *, R>            bvh;
+        };
+
+        bool                                face_bvh_tracked;
+        std::set<Face *>                    bvh_stale_faces;
+        std::map<Face *, uint32_t>          bvh_changed_faces;
+        std::vector<Face *>                 bvh_pending_faces;
+        std::vector<FaceBVHLevel>           bvh_levels;
+        uint32_t                            bvh_next_serial;
+
+        void                                bvhFaceChanged(Face *f);
+        void                                bvhFaceErased(Face *f);
+        void                                bvhDropTracking();
+        void                                bvhUpdateLevels();
+
+        /* call f(face) for every face whose current bounding box intersects search_box, using face_bvh and its
+         * levels, which are rebuilt / updated as necessary. */
+        template <typename FaceCallback>
+        void                                queryFaces(
+                                                BoundingBox<R> const   &search_box,
+                                                FaceCallback          &&f);
 
         /* globally reset the traversal states of all vertices and faces to TRAV_UNSEEN and reset
          * the traversal id queue. */
         void                                resetTraversalStates();
 
+        /* undo journal. while a checkpoint is set, the state of every vertex / face that existed at the time of the
+         * checkpoint is recorded the first time it is touched, and all newly inserted vertices / faces are recorded.
+         * erased vertices / faces that existed at the checkpoint are not deallocated but only detached from the
+         * internal maps, so that rollback() can re-attach the very same objects under their original ids. */
+        struct JournalVertexRecord {
+            uint32_t                        id;
+            bool                            erased;
+            std::list<Vertex *>             adjacent_vertices;
+            std::list<Face *>               incident_faces;
+        };
+
+        struct JournalFaceRecord {
+            uint32_t                        id;
+            bool                            erased;
+            bool                            quad;
+            std::array<Vertex *, 4>         vertices;
+        };
+
+        bool                                journal_active;
+        IdQueue                             journal_V_idq;
+        IdQueue                             journal_F_idq;
+        std::set<Vertex *>                  journal_inserted_vertices;
+        std::set<Face *>                    journal_inserted_faces;
+        std::map<
+                Vertex *,
+                JournalVertexRecord
+            >                               journal_vertex_records;
+        std::map<
+                Face *,
+                JournalFaceRecord
+            >                               journal_face_records;
+
+        /* replace all contents by the vertices and faces parsed from a mesh file, see readFromObjFile(). */
+        void                                buildFromFileData(Aux::File::ObjData &data);
+
+        /* record state of v / f before its first modification since the checkpoint */
+        void                                journalVertex(Vertex *v);
+        void                                journalFace(Face *f);
+        void                                journalInsertedVertex(Vertex *v);
+        void                                journalInsertedFace(Face *f);
+        /* called on erase. return true iff the object must be kept alive for rollback() instead of being deleted */
+        bool                                journalRetainVertex(Vertex *v);
+        bool                                journalRetainFace(Face *f);
+        /* delete all retained objects and clear the journal */
+        void                                journalDiscard();
+
     public:
         /* Mesh public interface */
 
@@ -1100,12 +1160,67 @@ class Mesh {
         uint32_t                            numVertices() const;
         uint32_t                            numEdges() const;
         uint32_t                            numFaces() const;
-        uint32_t                            numObtuseTriangles() const;
-        R                                   getTotalArea() const;
-        R                                   getTotalVolume() const;
-        void                                getAvgAspectRatio(R &ar_avg, R &ar_sigma, R *ar_max = NULL, R *ar_min = NULL) const;
+        uint32_t                            numObtuseTriangles(uint32_t nthreads = 1) const;
+        R                                   getTotalArea(uint32_t nthreads = 1) const;
+        R                                   getTotalVolume(uint32_t nthreads = 1) const;
+        void                                getAvgAspectRatio(
+                                                R          &ar_avg,
+                                                R          &ar_sigma,
+                                                R          *ar_max      = NULL,
+                                                R          *ar_min      = NULL,
+                                                uint32_t    nthreads    = 1) const;
         BoundingBox<R>                      getBoundingBox() const;
 
+        /* structure-of-arrays snapshot of the corner positions of all triangles in face id order: c[i][d][j] is
+         * coordinate d of corner i of triangle j. */
+        struct TriPositions {
+            std::array<std::array<std::vector<R>, 3>, 3>    c;
+
+            size_t                          size() const { return this->c[0][0].size(); }
+        };
+
+        /* selection of metrics computed by computeTriQuality(). fields of TriQuality belonging to metrics that have
+         * not been selected are left undefined. */
+        enum TriQualityMetrics {
+            TRI_AREA            = 1,
+            TRI_VOLUME          = 2,
+            TRI_OBTUSE          = 4,
+            TRI_ASPECT_RATIO    = 8,
+            TRI_ALL             = 15
+        };
+
+        /* quality metrics of a set of triangles. volume is the signed volume enclosed by the triangles, ar_sigma the
+         * bessel-corrected standard deviation of the aspect ratios. */
+        struct TriQuality {
+            R                               area;
+            R                               volume;
+            R                               ar_avg, ar_sigma, ar_min, ar_max;
+            uint32_t                        nobtuse;
+        };
+
+        /* take a snapshot of all triangle positions, throws for non-triangle faces */
+        void                                getTriPositionSnapshot(TriPositions &P) const;
+
+        /* compute the selected triangle quality metrics in one pass over a snapshot. triangles are processed in fixed
+         * blocks on up to nthreads threads and the block results are combined in block order, so the result does not
+         * depend on nthreads. callers that need several metrics should call getTriQuality() once instead of the
+         * single-metric getters above, each of which takes its own snapshot. */
+        static void                         computeTriQuality(
+                                                TriPositions const &P,
+                                                TriQuality         &q,
+                                                uint32_t            nthreads    = 1,
+                                                uint32_t            metrics     = TRI_ALL);
+        void                                getTriQuality(
+                                                TriQuality         &q,
+                                                uint32_t            nthreads    = 1,
+                                                uint32_t            metrics     = TRI_ALL) const;
+
+        /* estimated number of heap bytes held by the mesh: vertex and face objects, their map nodes, the adjacency
+         * list nodes, the bounding volume hierarchies and the undo journal. allocations are rounded up to typical
+         * malloc chunk sizes, adjacency list lengths are estimated from the number of faces, so that the estimate
+         * takes constant time and can be checked after every modification. */
+        size_t                              memoryFootprint() const;
+
         /* invert orientation of all faces */
         void                                invertOrientation();
 
@@ -1154,8 +1269,26 @@ class Mesh {
         /* delete all connected components containing isolated vertices or border edges */
         void                                deleteBorderCCsAndIsolatedVertices();
 
-        /* ----------------- location routines using the octree ----------------- */
-        void                                updateOctree();
+        /* ----------------- undo journal ----------------- */
+
+        /* set a checkpoint: all subsequent insertions and erasures of vertices / faces and all topological changes
+         * to existing ones are journaled. rollback() restores the mesh to the state at the checkpoint in time
+         * proportional to the amount of change, preserving ids of and pointers to all vertices / faces that existed
+         * at the checkpoint. the checkpoint remains set after rollback(). releaseCheckpoint() accepts all changes
+         * and stops journaling. note that vertex positions and data objects are not journaled, and that
+         * renumberConsecutively() and clearFaces() must not be called while a checkpoint is set. */
+        void                                checkpoint();
+        void                                rollback();
+        void                                releaseCheckpoint();
+        bool                                gotCheckpoint() const;
+
+        /* ----------------- location routines using the spatial index ----------------- */
+        /* rebuild the spatial index if necessary, sorting large meshes on up to nthreads threads. the location
+         * routines below rebuild it on demand with the number of threads set by setSpatialIndexThreads(), which
+         * defaults to 1, since meshes are commonly built and queried on worker threads. only meshes used by a single
+         * top-level thread should be given more. */
+        void                                updateSpatialIndex(uint32_t nthreads = 1);
+        void                                setSpatialIndexThreads(uint32_t nthreads);
         void                                findVertices(
                                                 BoundingBox<R> const   &search_box,
                                                 std::list<Vertex *>    &vertex_list);
@@ -1308,8 +1441,42 @@ class Mesh {
         void                                checkInternalConsistency() const;
 
         /* -----------------  I/O  ----------------- */
-        void                                readFromObjFile(const char *filename);
-        void                                writeObjFile(const char *jobname);
+        /* read mesh from obj file, replacing all contents. the file is parsed on up to nthreads threads, see
+         * Aux::File::readObjFile(). */
+        void                                readFromObjFile(
+                                                const char     *filename,
+                                                uint32_t        nthreads    = 1);
+
+        /* write mesh to "<jobname>.obj". lines are formatted on up to nthreads threads, coordinates are written with
+         * the given number of digits after the decimal point (printf "%+.<precision>e"). */
+        void                                writeObjFile(
+                                                const char     *jobname,
+                                                uint32_t        nthreads    = 1,
+                                                uint32_t        precision   = 10);
+
+        /* read mesh from binary ply / stl file, replacing all contents. see Aux::File::readPlyFile() and
+         * Aux::File::readStlFile(). */
+        void                                readFromPlyFile(const char *filename);
+        void                                readFromStlFile(const char *filename);
+
+        /* write mesh to binary "<jobname>.ply" / "<jobname>.stl". records are encoded on up to nthreads threads.
+         * stl files store triangles only, quads are split along their 0-2 diagonal. */
+        void                                writePlyFile(
+                                                const char     *jobname,
+                                                uint32_t        nthreads    = 1);
+        void                                writeStlFile(
+                                                const char     *jobname,
+                                                uint32_t        nthreads    = 1);
+
+        /* read from / write to "<jobname>.<ext>" in the given format, see meshFileExtension(). */
+        void                                readFromFile(
+                                                const char     *jobname,
+                                                MeshFileFormat  format,
+                                                uint32_t        nthreads    = 1);
+        void                                writeFile(
+                                                const char     *jobname,
+                                                MeshFileFormat  format,
+                                                uint32_t        nthreads    = 1);
 
 
         /* NOTE: In the C++11 standard, nested classes are automatically "friends" of the containing
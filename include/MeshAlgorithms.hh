@@ -257,7 +257,10 @@ namespace MeshAlg {
     /* for two given meshes X and Y, get pairs of potentially intersecting edges (from X, Y) / faces
      * (from Y, X) using a modified Octree-like construction and traversal.  an Octree is implicitly
      * constructed, but not stored, since it is not needed. instead, two lists given per reference
-     * are filled with all (unique) result pairs in the process. */
+     * are filled with all (unique) result pairs in the process. only the faces of the larger mesh that overlap the
+     * bounding box of the smaller mesh are considered, so the cost of merging a small mesh into a large one is
+     * proportional to the local complexity of the large mesh. with nthreads > 1, the octree recursion is split into
+     * concurrent tasks and the result lists are sorted in parallel. the result does not depend on nthreads. */
     template <typename Tm, typename Tv, typename Tf, typename R>
     void 
     getPotentiallyIntersectingEdgeFacePairs(
@@ -266,9 +269,11 @@ namespace MeshAlg {
         std::vector<EdgeFacePair<Mesh<Tm, Tv, Tf, R> > >&  X_edges_Y_faces_candidates,
         std::vector<EdgeFacePair<Mesh<Tm, Tv, Tf, R> > >&  Y_edges_X_faces_candidates,
         uint32_t                                    max_components      = 128,
-        uint32_t                                    max_recursion_depth = 7);
+        uint32_t                                    max_recursion_depth = 7,
+        uint32_t                                    nthreads            = 1);
 
-    /* red blue union algorithm and specializations for set operations */
+    /* red blue union algorithm and specializations for set operations. nthreads is the number of threads used for the
+     * computation of potentially intersecting edge / face pairs (see above), the result does not depend on it. */
     template <typename Tm, typename Tv, typename Tf, typename TR>
     void 
     RedBlueAlgorithm(
@@ -278,7 +283,8 @@ namespace MeshAlg {
         const bool                                         &keep_blue_outside_part,
         std::vector<
                 typename Mesh<Tm, Tv, Tf, TR>::vertex_iterator
-            >                                              *blue_update_its = NULL);
+            >                                              *blue_update_its = NULL,
+        uint32_t                                            nthreads        = 1);
 
     template <typename Tm, typename Tv, typename Tf, typename TR>
     void
@@ -287,7 +293,8 @@ namespace MeshAlg {
         Mesh<Tm, Tv, Tf, TR>                               &B,
         std::vector<
                 typename Mesh<Tm, Tv, Tf, TR>::vertex_iterator
-            >                                              *blue_update_its = NULL);
+            >                                              *blue_update_its = NULL,
+        uint32_t                                            nthreads        = 1);
     
     template <typename Tm, typename Tv, typename Tf, typename TR>
     void
@@ -296,7 +303,8 @@ namespace MeshAlg {
         Mesh<Tm, Tv, Tf, TR>                               &B,
         std::vector<
                 typename Mesh<Tm, Tv, Tf, TR>::vertex_iterator
-            >                                              *blue_update_its = NULL);
+            >                                              *blue_update_its = NULL,
+        uint32_t                                            nthreads        = 1);
 
     template <typename Tm, typename Tv, typename Tf, typename TR>
     void
@@ -305,10 +313,24 @@ namespace MeshAlg {
         Mesh<Tm, Tv, Tf, TR>                               &B,
         std::vector<
                 typename Mesh<Tm, Tv, Tf, TR>::vertex_iterator
-            >                                              *blue_update_its = NULL);
+            >                                              *blue_update_its = NULL,
+        uint32_t                                            nthreads        = 1);
 
     
-    /* greedy edge collapse post-processing */
+    /* seam-local post-processing: get the ids of all faces in the k-ring around the faces incident to the given seam
+     * vertices (see Mesh::Vertex::isSeam()) in ascending order. the 0-ring consists of the faces incident to the seam
+     * vertices, every further ring of the faces sharing a vertex with the previous one. ids of vertices that are not
+     * part of M are ignored. the result can be passed as region to the post-processing algorithms below. */
+    template <typename Tm, typename Tv, typename Tf, typename R>
+    void
+    getSeamRegion(
+        Mesh<Tm, Tv, Tf, R>            &M,
+        std::vector<uint32_t> const    &seam_vertex_ids,
+        uint32_t                        k,
+        std::vector<uint32_t>          &region);
+
+    /* greedy edge collapse post-processing. if region is not NULL, it holds the ascending ids of the only triangles
+     * considered for processing. */
     template <typename Tm, typename Tv, typename Tf, typename R>
     void
     greedyEdgeCollapsePostProcessing(
@@ -316,7 +338,37 @@ namespace MeshAlg {
         R const                &alpha   = 1.75,
         R const                &lambda  = 0.125,
         R const                &mu      = 0.5,
-        uint32_t                d       = 15);
+        uint32_t                d       = 15,
+        std::vector<uint32_t> const *region = NULL);
+
+    /* parallel variant of greedyEdgeCollapsePostProcessing() with the same quality criteria. candidate triangles are
+     * processed in rounds: all candidates are evaluated on up to nthreads threads, then a maximal set of safe collapses
+     * with pairwise disjoint one-rings is selected in order of decreasing aspect ratio and collapsed, and only the
+     * triangles incident to the new vertices and the deferred candidates are re-evaluated in the next round. since
+     * collapses of one round are chosen by independence rather than strictly one after the other, the result differs
+     * in detail from the serial variant. region is handled as in the serial variant. */
+    template <typename Tm, typename Tv, typename Tf, typename R>
+    void
+    parallelGreedyEdgeCollapsePostProcessing(
+        Mesh<Tm, Tv, Tf, R>    &M,
+        R const                &alpha   = 1.75,
+        R const                &lambda  = 0.125,
+        R const                &mu      = 0.5,
+        uint32_t                d       = 15,
+        uint32_t                nthreads = 1,
+        std::vector<uint32_t> const *region = NULL);
+
+    /* quadric error metric (QEM) decimation: edges are collapsed in order of increasing quadric error, each to the
+     * position minimizing the summed face plane quadrics of its vertices, until the mesh has at most target_faces
+     * faces or the next collapse would exceed max_error. collapses are performed with Mesh::collapseTriEdge() and
+     * hence only if topologically safe. collapses that would flip the orientation of a surrounding triangle are
+     * rejected. */
+    template <typename Tm, typename Tv, typename Tf, typename R>
+    void
+    quadricErrorDecimation(
+        Mesh<Tm, Tv, Tf, R>    &M,
+        uint32_t                target_faces,
+        R const                &max_error = Aux::Numbers::inf<R>());
 
     /* smoothing algorithms */
     template <typename Tm, typename Tv, typename Tf, typename R>
@@ -326,15 +378,20 @@ namespace MeshAlg {
         R const                &lambda,
         uint32_t                maxiter);
 
+    /* HC Laplacian smoothing. the sweeps of every iteration run on up to nthreads threads on a CSR copy of the
+     * adjacency, the result does not depend on nthreads. if region is not NULL, only the vertices of the faces with
+     * the given ascending ids are moved, all other vertices are kept fixed. */
     template <typename Tm, typename Tv, typename Tf, typename R>
     void
     HCLaplacianSmoothing(
         Mesh<Tm, Tv, Tf, R>    &M,
         R const                &alpha   = 0.4,
         R const                &beta    = 0.7,
-        uint32_t                maxiter = 100);
+        uint32_t                maxiter = 100,
+        uint32_t                nthreads = 1,
+        std::vector<uint32_t> const *region = NULL);
 
-    /* functions to allow partial flushing of a mesh to an obj file. NOTE: this does not provide paging functionality
+    /* functions to allow partial flushing of a mesh to a mesh file. NOTE: this does not provide paging functionality
      * that can be applied transparently by the user, i.e.: if a part of a mesh has been dumped, it is no longer part of
      * the mesh it came from and access to the respective mesh components is impossible as long as these have not been
      * explicitly reloaded from the file. 
@@ -349,7 +406,55 @@ namespace MeshAlg {
      * in order not to meddle with the internal structure (e.g. vertex / face numbering), the following methods have
      * been designed to take care of the vertex indexing / numbering issue. obj files vertex lines semantics do not
      * specify vertex indices, but number the vertices (represented as single lines each) consecutively in order of
-     * appearance. */
+     * appearance, and so do ply files. 
+     *
+     * partialFlush() removes all faces in face_list and all vertices that become isolated from M and numbers all
+     * flushed vertices that have not been flushed before consecutively, starting from in_last_flush_vertex_id. it then
+     * calls write() with the positions of these new vertices in flush id order, the flushed faces given by flush ids
+     * (UINT32_MAX as last id of triangles) and the flushed faces given by their vertices, which stay valid during the
+     * call only. write() may take over the contents of the vectors. */
+    template <typename Tm, typename Tv, typename Tf, typename R>
+    void
+    partialFlush(
+        Mesh<Tm, Tv, Tf, R>                                        &M,
+        std::list<typename Mesh<Tm, Tv, Tf, R>::Face *>            &face_list,
+        std::list<
+                std::pair<
+                    typename Mesh<Tm, Tv, Tf, R>::Vertex *,
+                    uint32_t
+                >
+            >                                                      &in_boundary_vertices,
+        uint32_t const                                             &in_last_flush_vertex_id,
+        std::list<
+                std::pair<
+                    typename Mesh<Tm, Tv, Tf, R>::Vertex *,
+                    uint32_t          
+                >
+            >                                                      &out_boundary_vertices,
+        uint32_t                                                   &out_last_flush_vertex_id,
+        std::function<
+                void(
+                    std::vector<Vec3<R>>                           &new_vertex_positions,
+                    std::vector<std::array<uint32_t, 4>>           &flush_faces,
+                    std::vector<
+                            std::array<typename Mesh<Tm, Tv, Tf, R>::Vertex *, 4>
+                        >                                          &flush_face_vertices)
+            > const                                                &write);
+
+    /* merge the new vertices and faces of a partialFlush() into the obj file *obj_file, which is replaced by a merged
+     * copy, see partialFlushToObjFile(). */
+    template <typename R>
+    void
+    appendToObjFile(
+        FILE                                                      **obj_file,
+        std::string const                                          &filename,
+        std::vector<Vec3<R>> const                                 &new_vertex_positions,
+        std::vector<std::array<uint32_t, 4>> const                 &flush_faces,
+        uint32_t                                                    nthreads,
+        uint32_t                                                    precision);
+
+    /* partialFlush() to an obj file. nthreads and precision are used for formatting the new lines as in
+     * Mesh::writeObjFile(). */
     template <typename Tm, typename Tv, typename Tf, typename R>
     void
     partialFlushToObjFile(
@@ -369,15 +474,47 @@ namespace MeshAlg {
                     uint32_t          
                 >
             >                                                      &out_boundary_vertices,
-        uint32_t                                                   &out_last_flush_vertex_id);
-
-    /* class storing information about the flushing process to ease use of the above function. used in conjunction with
-     * the wrapper overload of partialFlushToObjFile(..) below. */
+        uint32_t                                                   &out_last_flush_vertex_id,
+        uint32_t                                                    nthreads    = 1,
+        uint32_t                                                    precision   = 10);
+
+    /* class storing information about the flushing process to ease use of the above functions. used in conjunction
+     * with partialFlushToFile(..) below. obj files are written as described above. binary ply files are written
+     * incrementally: new vertices are appended to "<filename>.ply", new faces to the side file "<filename>_faces.tmp".
+     * binary stl files carry no vertices, all flushed faces are appended as triangles. finalize() completes the file:
+     * it appends the side file for ply and rewrites the fixed-length ply / stl header with the final counts.
+     *
+     * if startWriter() has been called, all file output is done by a background writer thread: partialFlushToFile()
+     * only detaches the flushed data from the mesh and queues it, so that the caller can continue meshing while the
+     * data is formatted and written. at most max_pending batches are queued, further calls block until the writer has
+     * caught up. errors of the writer thread are rethrown by the next partialFlushToFile() or finalize().
+     *
+     * if write_seams is set, the file indices of all flushed seam vertices (see Mesh::Vertex::isSeam()) are collected
+     * and written by finalize() to "<filename>_seams.txt", see Aux::File::writeIndexFile(). since stl files carry no
+     * vertex indices, no seam file is written for stl. */
     template<typename Tm, typename Tv, typename Tf, typename R>
-    class MeshObjFlushInfo {
+    class MeshFlushInfo {
+        private:
+            bool                                                    open;
+
+            std::thread                                             writer;
+            std::mutex                                              writer_mutex;
+            std::condition_variable                                 writer_cv;
+            std::deque<std::function<void()>>                       writer_jobs;
+            std::deque<size_t>                                      writer_job_bytes;
+            size_t                                                  writer_pending_bytes;
+            uint32_t                                                writer_max_pending;
+            bool                                                    writer_stop;
+            std::exception_ptr                                      writer_error;
+
+            void    writerLoop();
+            void    stopWriter();
+
         public:
             std::string     filename;
-            FILE *          obj_file; 
+            MeshFileFormat  format;
+            FILE *          file; 
+            FILE *          face_file;
             std::list<
                     std::pair<
                         typename Mesh<Tm, Tv, Tf, R>::Vertex *,
@@ -386,39 +523,52 @@ namespace MeshAlg {
                 >                                                   last_boundary_vertices;
             uint32_t                                                last_flush_vertex_id;
 
-            MeshObjFlushInfo()
-            : obj_file(NULL), last_flush_vertex_id(0)
-            {}
-
-            MeshObjFlushInfo(const std::string& _filename)
-            : filename(_filename), obj_file(NULL), last_flush_vertex_id(0)
-            {
-                this->obj_file  = fopen( (this->filename + ".obj").c_str(), "w");
-                if (!this->obj_file) {
-                    throw("MeshAlg::MeshObjFlushInfo::MeshObjFlushInfo(std:: string filemame): couldn't open given obj file for writing..\n");
-                }
-            }
-
-            void    
-            finalize()
-            {
-                if (this->obj_file) {
-                    fclose(this->obj_file);
-                }
-                this->filename = std::string();
-                this->last_boundary_vertices.clear();
-                this->last_flush_vertex_id = 0;
-            }
+            /* number of faces written so far (triangles for stl) */
+            uint32_t                                                nfaces;
+
+            /* number of threads used for formatting / encoding and number of digits after the decimal point for obj
+             * vertex coordinates, see Mesh::writeObjFile() */
+            uint32_t                                                nthreads;
+            uint32_t                                                precision;
+
+            /* collect and write seam vertex indices, file indices of seam vertices flushed so far */
+            bool                                                    write_seams;
+            std::vector<uint32_t>                                   seam_vertices;
+
+            MeshFlushInfo();
+            MeshFlushInfo(
+                std::string const  &_filename,
+                MeshFileFormat      _format = MESH_FILE_OBJ);
+           ~MeshFlushInfo();
+
+            bool    isOpen() const;
+            void    startWriter(uint32_t max_pending = 2);
+
+            /* run job on the writer thread if started, otherwise immediately. bytes is the amount of heap memory held
+             * by the job until it is done, see pendingBytes(). */
+            void    submit(std::function<void()> const &job, size_t bytes = 0);
+
+            /* heap memory held by jobs that are queued or running on the writer thread */
+            size_t  pendingBytes();
+
+            /* block until all submitted jobs are done. rethrows errors of the writer thread. */
+            void    waitForWriter();
+
+            void    finalize();
     };
 
+    /* former name of MeshFlushInfo from when only obj files could be flushed. its ctor still defaults to obj, the
+     * obj_file member is now called file. */
+    template<typename Tm, typename Tv, typename Tf, typename R>
+    using MeshObjFlushInfo = MeshFlushInfo<Tm, Tv, Tf, R>;
 
-    /* convenience wrapper function that takes care of everything, given only an initialized struct of type
-     * MeshObjFlushInfo */
+    /* convenience wrapper function that takes care of everything, given only an initialized object of type
+     * MeshFlushInfo */
     template <typename Tm, typename Tv, typename Tf, typename R>
     void
-    partialFlushToObjFile(
+    partialFlushToFile(
         Mesh<Tm, Tv, Tf, R>                                        &M,
-        MeshObjFlushInfo<Tm, Tv, Tf, R>                            &M_flush_info,
+        MeshFlushInfo<Tm, Tv, Tf, R>                               &M_flush_info,
         std::list<typename Mesh<Tm, Tv, Tf, R>::Face *>            &face_list);
 }
 
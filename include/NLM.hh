@@ -151,6 +151,20 @@ namespace NLM {
             }
     }; 
 
+    /* precomputed, mesh-independent part of the mesh of a neurite path: render vector and spine curve samples of all
+     * canal segments (see CanalSurfaceMeshFrames). valid is false if no render vector could be determined without
+     * random search, in which case nothing has been precomputed. for non-root paths, the frames of canal segment 0 are
+     * not precomputed, since its start radius is reduced depending on the merging attempt. */
+    template<typename R>
+    struct NeuritePathMeshFrames {
+        bool                                        valid;
+        Vec3<R>                                     render_vector;
+        CanalSurfaceMeshFrames<R>                   initial_cylinder_frames;
+        std::vector<CanalSurfaceMeshFrames<R>>      canal_segment_frames;
+
+        NeuritePathMeshFrames() : valid(false) {}
+    };
+
     /* NeuritePath class */
     template<typename R>
     class NeuritePath {
@@ -227,6 +241,17 @@ namespace NLM {
                                                         R lambda    = 0.01, // 0.01 corresponds to an angle of about 5 degrees
                                                         R mu        = 0.01) const;
 
+            /* precompute render vector and spine curve samples for the mesh generation methods below. thread-safe
+             * and deterministic: no random numbers are drawn, so frames.valid is false if the educated guess of
+             * findPermissibleRenderVector() fails. */
+            void                                    computeMeshFrames(
+                                                        uint32_t                                                n_phi_segments,
+                                                        R                                                       triangle_height_factor,
+                                                        R const                                                &arclen_dt,
+                                                        bool                                                    preserve_crease_edges,
+                                                        NeuritePathMeshFrames<R>                               &frames,
+                                                        R mu        = 0.01) const;
+
         /* mesh generation */
             template<typename Tm, typename Tv, typename Tf>
             void                                    generateInitialSegmentMesh(
@@ -242,7 +267,8 @@ namespace NLM {
                                                             >                                                  &end_circle_its,
                                                         typename Mesh<Tm, Tv, Tf, R>::vertex_iterator          &closing_vertex_it,
                                                         R const                                                &radius_reduction_factor,
-														bool                                                    preserve_crease_edges = false) const;
+														bool                                                    preserve_crease_edges = false,
+                                                        NeuritePathMeshFrames<R> const                         *frames = NULL) const;
 
             /// append only one segment of the tail mesh
             template <typename Tm, typename Tv, typename Tf>
@@ -258,7 +284,8 @@ namespace NLM {
                 bool& circle_offset_inOut,
                 std::vector<typename Mesh<Tm, Tv, Tf, R>::vertex_iterator>& circle_its_inOut,
                 typename Mesh<Tm, Tv, Tf, R>::vertex_iterator& circle_closing_vertex_it_inOut,
-                bool preserve_crease_edges
+                bool preserve_crease_edges,
+                NeuritePathMeshFrames<R> const* frames = NULL
             ) const;
 
 
@@ -281,7 +308,8 @@ namespace NLM {
                                                                 typename Mesh<Tm, Tv, Tf, R>::vertex_iterator
                                                             >                                                  *end_circle_its      = NULL,
                                                         typename Mesh<Tm, Tv, Tf, R>::vertex_iterator          *closing_vertex_it   = NULL,
-														bool                                                    preserve_crease_edges = false) const;
+														bool                                                    preserve_crease_edges = false,
+                                                        NeuritePathMeshFrames<R> const                         *frames = NULL) const;
                                                         
 
     };
@@ -121,8 +121,17 @@ class NLM_CellNetwork
                 >(NLM::NeuritePath<R> const &P)
             >           parametrization_algo;
 
+        MeshFileFormat  meshing_mesh_format;
         bool            meshing_flush;
         uint32_t        meshing_flush_face_limit;
+        uint32_t        meshing_flush_mem_limit;
+        bool            meshing_write_seams;
+
+        uint32_t        meshing_nthreads;
+        /* if both are set and the network falls apart into more than one cell cluster, cell-parallel meshing is used
+         * and meshing_parallel_trees is ignored with a warning. */
+        bool            meshing_parallel_trees;
+        bool            meshing_parallel_cells;
 
         uint32_t        meshing_n_soma_refs;
         uint32_t        meshing_canal_segment_n_phi_segments;
@@ -232,8 +241,15 @@ class NLM_CellNetwork
                     >(NLM::NeuritePath<R> const &P)
                 >           parametrization_algo;
 
+            MeshFileFormat  meshing_mesh_format;
             bool            meshing_flush;
             uint32_t        meshing_flush_face_limit;
+            uint32_t        meshing_flush_mem_limit;
+            bool            meshing_write_seams;
+
+            uint32_t        meshing_nthreads;
+            bool            meshing_parallel_trees;
+            bool            meshing_parallel_cells;
 
             uint32_t        meshing_n_soma_refs;
             uint32_t        meshing_canal_segment_n_phi_segments;
@@ -1049,6 +1065,31 @@ class NLM_CellNetwork
                                                                 >(NLM::NeuritePath<R> const &P)
                                                             >  const                       &parametrization_algorithm);
 
+        /* merge the mesh of neurite path P into M with RedBlueUnion, handling all recoverable RedBlue exceptions by
+         * splitting edges, re-randomizing and decreasing the start radius of P's initial segment as required. M is
+         * journaled (see Mesh::checkpoint()) while merging. if seed is true, M is expected to be empty: P's initial
+         * segment then becomes the first part of M and no merging is performed. P is usually the root path of a
+         * neurite, but may be any path whose subtree is meshed on its own (see renderCellNetwork()). rb_nthreads threads are used inside each RedBlueUnion call (see
+         * MeshAlg::getPotentiallyIntersectingEdgeFacePairs()). */
+        template <typename Tm, typename Tv, typename Tf>
+        void                                        meshNeuritePath(
+                                                        Mesh<Tm, Tv, Tf, R>                    &M,
+                                                        NLM::NeuritePath<R> const              &P,
+                                                        NLM::NeuritePathMeshFrames<R> const    *P_frames,
+                                                        bool                                    seed,
+                                                        uint32_t                                rb_nthreads = 1) const;
+
+        /* group the given bounding boxes into clusters of transitively intersecting boxes. clusters are ordered by their
+         * smallest box index and list their box indices in ascending order. */
+        static std::vector<std::vector<uint32_t>>   getBoundingBoxClusters(std::vector<BoundingBox<R>> const &bbs);
+
+        /* split all complex edges reported by a RedBlue algorithm call on red mesh M_red and blue mesh M_blue */
+        template <typename Tm, typename Tv, typename Tf>
+        static void                                 splitComplexEdges(
+                                                        Mesh<Tm, Tv, Tf, R>                    &M_red,
+                                                        Mesh<Tm, Tv, Tf, R>                    &M_blue,
+                                                        RedBlue_Ex_ComplexEdges<R> const       &complex_ex);
+
     public:
                                                     NLM_CellNetwork(std::string network_name);
                                                    ~NLM_CellNetwork();
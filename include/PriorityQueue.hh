@@ -50,12 +50,30 @@
 #include "common.hh"
 #include "IdQueue.hh"
 
+#include <unordered_map>
+
+/* indexed d-ary min-heap of (key, value) pairs with unique values. entries are ordered by (key, id), where id is
+ * drawn from an IdQueue on insertion and kept by changeKey(), so equal keys are resolved deterministically. the heap
+ * position of every value is kept in a hash map, which makes changeKey() a single sift operation. */
 template <typename Tkey, typename Tvalue>
 class PriorityQueue {
     private:
+        static const uint32_t                                                               d = 4;
+
+        struct Entry {
+            Tkey        key;
+            uint32_t    id;
+            Tvalue      value;
+        };
+
         IdQueue                                                                             idq;
-        std::map<std::pair<Tkey, uint32_t>, Tvalue>                                         Q;
-        std::map<Tvalue, typename std::map< std::pair<Tkey, uint32_t>, Tvalue>::iterator>   value_key_map;
+        std::vector<Entry>                                                                  heap;
+        std::unordered_map<Tvalue, size_t>                                                  position;
+
+        bool                        less(Entry const &x, Entry const &y) const;
+        void                        place(Entry const &e, size_t i);
+        void                        siftUp(size_t i);
+        void                        siftDown(size_t i);
 
     public:
         void                        insert(Tkey key, Tvalue value);
@@ -68,34 +86,100 @@ class PriorityQueue {
         void                        checkHeap();
 };
 
+template<typename Tkey, typename Tvalue>
+bool
+PriorityQueue<Tkey, Tvalue>::less(
+    Entry const    &x,
+    Entry const    &y) const
+{
+    return (x.key < y.key || (!(y.key < x.key) && x.id < y.id));
+}
+
+template<typename Tkey, typename Tvalue>
+void
+PriorityQueue<Tkey, Tvalue>::place(
+    Entry const    &e,
+    size_t          i)
+{
+    this->heap[i]               = e;
+    this->position[e.value]     = i;
+}
+
+template<typename Tkey, typename Tvalue>
+void
+PriorityQueue<Tkey, Tvalue>::siftUp(size_t i)
+{
+    Entry e = this->heap[i];
+    while (i > 0) {
+        size_t const parent = (i - 1) / d;
+        if (!this->less(e, this->heap[parent])) {
+            break;
+        }
+        this->place(this->heap[parent], i);
+        i = parent;
+    }
+    this->place(e, i);
+}
+
+template<typename Tkey, typename Tvalue>
+void
+PriorityQueue<Tkey, Tvalue>::siftDown(size_t i)
+{
+    size_t const    n = this->heap.size();
+    Entry           e = this->heap[i];
+
+    while (true) {
+        size_t const first = d * i + 1;
+        if (first >= n) {
+            break;
+        }
+
+        /* smallest child */
+        size_t const    last    = std::min(first + d, n);
+        size_t          c       = first;
+        for (size_t j = first + 1; j < last; j++) {
+            if (this->less(this->heap[j], this->heap[c])) {
+                c = j;
+            }
+        }
+
+        if (!this->less(this->heap[c], e)) {
+            break;
+        }
+        this->place(this->heap[c], i);
+        i = c;
+    }
+    this->place(e, i);
+}
+
 template<typename Tkey, typename Tvalue>
 void
 PriorityQueue<Tkey, Tvalue>::clear()
 {
-    this->Q.clear();
-    this->value_key_map.clear();
+    this->heap.clear();
+    this->position.clear();
 }
 
 template<typename Tkey, typename Tvalue>
 bool
 PriorityQueue<Tkey, Tvalue>::empty()
 {
-    return (this->Q.empty());
+    return (this->heap.empty());
 }
 
+/* values are unique: inserting a value that is already present changes its key. */
 template<typename Tkey, typename Tvalue>
 void
 PriorityQueue<Tkey, Tvalue>::insert(
     Tkey    key,
     Tvalue  value)
 {
-    typename std::map<std::pair<Tkey, uint32_t>, Tvalue>::iterator qit;
-
-    /* insert (key, value) pair and store iterator */
-    qit = Q.insert( std::pair< std::pair<Tkey, uint32_t>, Tvalue>( std::pair<Tkey, uint32_t>(key, idq.getId()), value )).first;
+    if (this->changeKey(value, key)) {
+        return;
+    }
 
-    /* associate key with iterator in value_key_map */
-    value_key_map.insert( std::pair<Tvalue, typename std::map< std::pair<Tkey, uint32_t>, Tvalue>::iterator> (value, qit) );
+    this->heap.push_back({ key, idq.getId(), value });
+    this->siftUp(this->heap.size() - 1);
 }
 
 template<typename Tkey, typename Tvalue>
@@ -110,21 +194,26 @@ template<typename Tkey, typename Tvalue>
 std::pair<Tkey, Tvalue>
 PriorityQueue<Tkey, Tvalue>::top()
 {
-    std::pair< std::pair<Tkey, uint32_t>, Tvalue>  p(Q.begin()->first, Q.begin()->second);
-    return (std::pair<Tkey, Tvalue>(p.first.first, p.second));
+    return (std::pair<Tkey, Tvalue>(this->heap[0].key, this->heap[0].value));
 }
 
 template<typename Tkey, typename Tvalue>
 void
 PriorityQueue<Tkey, Tvalue>::deleteMin()
 {
-    std::pair< std::pair<Tkey, uint32_t>, Tvalue>  p(Q.begin()->first, Q.begin()->second);
+    Entry const min = this->heap[0];
 
     /* free id */
-    idq.freeId(p.first.second);
+    idq.freeId(min.id);
+    this->position.erase(min.value);
 
-    Q.erase( Q.begin() );
-    value_key_map.erase(p.second);
+    /* move last entry to the root and restore the heap property */
+    Entry const last = this->heap.back();
+    this->heap.pop_back();
+    if (!this->heap.empty()) {
+        this->heap[0] = last;
+        this->siftDown(0);
+    }
 }
 
 template<typename Tkey, typename Tvalue>
@@ -133,30 +222,21 @@ PriorityQueue<Tkey, Tvalue>::changeKey(
         Tvalue  value,
         Tkey    new_key)
 {
-    uint32_t id;
-
-    auto it = value_key_map.find(value);
-    if ( it != value_key_map.end()) {
+    auto it = this->position.find(value);
+    if (it != this->position.end()) {
         debugl(1, "PriorityQueue()::changeKey(): value found => changing key..\n");
-        debugTabInc();
-
-        id          = it->second->first.second;
-        debugl(1, "id: %d\n", id);
-
-        /* erase old entry from q with obtained iterator. insert new entry into Q and save iterator */
-        debugl(1, "erasing iterator from key_value_map Q.\n");
-        Q.erase(it->second);
 
-        debugl(1, "re-inserting into Q with correct key.\n");
-        auto qpair  = Q.insert( { {new_key, id}, value } );
+        /* id is kept, entry moves up or down depending on the new key */
+        size_t const    i       = it->second;
+        Tkey const      old_key = this->heap[i].key;
 
-        debugl(1, "updating key in value_key_map.\n");
-        /* only key has changed, value is unaffected => use iterator it to update entry in value_key_map: overwrite the
-         * currently stored old iterator with qpair.first, which has been returned by the Q.insert(..) call above */
-        it->second  = qpair.first;
-
-        debugl(1, "done. returning..\n");
-        debugTabDec();
+        this->heap[i].key = new_key;
+        if (new_key < old_key) {
+            this->siftUp(i);
+        }
+        else {
+            this->siftDown(i);
+        }
         return true;
     }
     else {
@@ -165,27 +245,22 @@ PriorityQueue<Tkey, Tvalue>::changeKey(
     }
 }
 
-
 template<typename Tkey, typename Tvalue>
 void
 PriorityQueue<Tkey, Tvalue>::checkHeap()
 {
-    std::list<Tvalue>                                                                   Q_values, value_key_map_keys;
-    typename std::map<std::pair<Tkey, uint32_t>, Tvalue>::iterator                      qit;
-    typename std::map<uint32_t, typename std::map<Tkey, Tvalue>::iterator>::iterator    vit;
-
-    for (qit = Q.begin(); qit != Q.end(); ++qit) {
-        Q_values.push_back(qit->second.first);
-    }
-
-    for (vit = value_key_map.begin(); vit != value_key_map.end(); ++vit) {
-        value_key_map_keys.push_back(vit->first);
+    if (this->position.size() != this->heap.size()) {
+        throw("PriorityQueue::checkHeap(): position map size mismatch. internal logic error.");
     }
 
-    Q_values.sort();
-    value_key_map_keys.sort();
-    if (Q_values != value_key_map_keys) {
-        throw("PriorityQueue::checkHeap(): heap invariant violated. internal logic error.");
+    for (size_t i = 0; i < this->heap.size(); i++) {
+        auto it = this->position.find(this->heap[i].value);
+        if (it == this->position.end() || it->second != i) {
+            throw("PriorityQueue::checkHeap(): position map inconsistent. internal logic error.");
+        }
+        if (i > 0 && this->less(this->heap[i], this->heap[(i - 1) / d])) {
+            throw("PriorityQueue::checkHeap(): heap invariant violated. internal logic error.");
+        }
     }
 }
 
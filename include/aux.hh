@@ -81,6 +81,12 @@ namespace Aux {
     namespace Numbers {
         /* FIXME: convert to templates, use std::{sin,cos,sqrt, ..} template specialization wrappers for arithmetic */
         double  frand(double min, double max);
+
+        /* per-thread random streams: while a stream is set for the calling thread, frand() draws from a generator
+         * seeded with the given seed instead of std::rand(). this makes results of concurrently running computations
+         * reproducible independent of thread scheduling. */
+        void    frandSetThreadStream(uint32_t seed);
+        void    frandUnsetThreadStream();
         double  fmin3(double a, double b, double c);
         double  fmax3(double a, double b, double c);
         int     sign(int64_t d);
@@ -102,26 +108,25 @@ namespace Aux {
 #ifdef WITH_BOOST
             return boost::math::binomial_coefficient<R>(n, k);
 #else
-            static StaticVector<n+1, R> bicof;
-            static bool bicof_recompute = true;
-
-            /* indicate necessity to (re)compute more binomial coefficients by toggling flag if required n is
-             * larger than maximum precomputed one */
-            if (bicof_recompute)
+            /* computed once on first use. initialization of local statics is thread-safe, so concurrent meshing
+             * threads evaluating canal surfaces do not race here. */
+            static StaticVector<n+1, R> const bicof = [] () -> StaticVector<n+1, R>
             {
                 debugl(2, "initBinomialCoefficients(): ... \n");
 
                 /* fill in binomial coefficients */
-                bicof[0] = R(1);
+                StaticVector<n+1, R> c;
+                c[0] = R(1);
                 for (uint32_t i = 1; i < n; ++i)
-                    bicof[i] = floor(0.5 + exp(lgamma(n+1) - lgamma(i+1) - lgamma(n-i+1)));
+                    c[i] = floor(0.5 + exp(lgamma(n+1) - lgamma(i+1) - lgamma(n-i+1)));
 
-                bicof[n] = (R)1;
+                c[n] = (R)1;
 
                 debugl(2, "done.\n");
 
-                bicof_recompute = false;
-            }
+                return c;
+            }();
+
             return bicof[k];
             //return k < n+1 ? bicof[k] : (R)0;
 #endif
@@ -719,6 +724,238 @@ namespace Aux {
 
     namespace File {
         bool isEmpty(FILE *f);
+
+        /* fast number formatting for large text outputs. formatSci() writes x into buf exactly as printf("%+.*e",
+         * precision, x) would, formatUInt() as printf("%u", x). both return the number of characters written, without
+         * terminating zero, and require buf to hold at least 32 characters. */
+        size_t formatSci(char *buf, double x, uint32_t precision = 10);
+        size_t formatUInt(char *buf, uint32_t x);
+
+        /* copy src from its beginning to dst in large blocks, replacing the first line that equals delim (without the
+         * newline) by the output of insert(dst). returns false if no such line has been found. */
+        bool copyReplacingLine(
+            FILE                                   *src,
+            FILE                                   *dst,
+            const char                             *delim,
+            std::function<void(FILE *)> const      &insert);
+
+        /* read-only memory mapping of an entire file. files that can't be mapped (e.g. empty ones) are read into memory
+         * instead. */
+        class MappedFile {
+            private:
+                const char         *ptr;
+                size_t              len;
+                bool                mapped;
+                std::vector<char>   buf;
+
+                                    MappedFile(MappedFile const &);
+                MappedFile         &operator=(MappedFile const &);
+
+            public:
+                                    MappedFile();
+                                   ~MappedFile();
+
+                bool                open(const char *filename);
+                void                close();
+                const char         *data() const;
+                size_t              size() const;
+        };
+
+        /* contents of a mesh file: vertex positions, vertex normals and faces given by 0-based vertex indices, where
+         * the last index of triangles is UINT32_MAX. also used by readPlyFile() and readStlFile(), which never fill in
+         * normals. */
+        struct ObjData {
+            std::vector<std::array<double, 3>>      vertices;
+            std::vector<std::array<double, 3>>      normals;
+            std::vector<std::array<uint32_t, 4>>    faces;
+        };
+
+        /* parse the obj file filename into data. the file is mapped into memory and split into chunks of lines, which
+         * are parsed on up to nthreads threads: a first pass counts vertices, normals and faces per chunk, so that a
+         * second pass can parse every chunk directly into its range of the preallocated arrays. comments, object
+         * names and texture coordinates are skipped, any other unrecognized line causes an exception. returns false
+         * if the file can't be opened. */
+        bool readObjFile(
+            const char     *filename,
+            ObjData        &data,
+            uint32_t        nthreads = 1);
+
+        /* stream the obj file filename without storing its faces: all vertex positions are parsed into vertices,
+         * then face(chunk, f) is called for every face f in the format of ObjData::faces, after checking its
+         * indices. the file is split into chunks of lines of fixed size, independent of nthreads, which are
+         * processed on up to nthreads threads. face() is thus called concurrently for different chunks, but faces of
+         * one chunk are passed in file order from one thread at a time, so per-chunk results combined in chunk order
+         * don't depend on nthreads. begin(nfaces, nchunks) is called once before the first call of face(), chunk is
+         * always < nchunks. */
+        bool streamObjFile(
+            const char                                                         *filename,
+            std::vector<std::array<double, 3>>                                 &vertices,
+            std::function<void(size_t, uint32_t)> const                        &begin,
+            std::function<void(uint32_t, std::array<uint32_t, 4> const &)> const &face,
+            uint32_t                                                            nthreads = 1);
+
+        /* write n lines to f. format_line(i, buf) formats line i, including its newline, into buf, which holds
+         * max_line_len characters, and returns its length. lines are formatted block-wise into large buffers on up to
+         * nthreads threads and written in order with few fwrite() calls. format_line must not throw. */
+        template <typename F>
+        void
+        writeLines(
+            FILE       *f,
+            size_t      n,
+            size_t      max_line_len,
+            F const    &format_line,
+            uint32_t    nthreads = 1)
+        {
+            size_t const    block_len   = 16384;
+            size_t const    nblocks     = (n + block_len - 1) / block_len;
+            uint32_t const  nbuffers    = std::max<size_t>(1, std::min<size_t>(nthreads, nblocks));
+
+            std::vector<std::vector<char>>  buffers(nbuffers, std::vector<char>(block_len * max_line_len));
+            std::vector<size_t>             lengths(nbuffers);
+
+            auto formatBlock = [&] (size_t block, uint32_t b) -> void
+            {
+                char          *s    = buffers[b].data();
+                size_t const   last = std::min(n, (block + 1) * block_len);
+
+                for (size_t i = block * block_len; i < last; i++) {
+                    s += format_line(i, s);
+                }
+                lengths[b] = s - buffers[b].data();
+            };
+
+            /* format nbuffers consecutive blocks at once, then write them in order */
+            for (size_t block = 0; block < nblocks; block += nbuffers) {
+                uint32_t const nround = std::min<size_t>(nbuffers, nblocks - block);
+
+                std::vector<std::thread> threads;
+                for (uint32_t b = 1; b < nround; b++) {
+                    try {
+                        threads.push_back(std::thread(formatBlock, block + b, b));
+                    }
+                    catch (std::system_error &ex) {
+                        formatBlock(block + b, b);
+                    }
+                }
+                formatBlock(block, 0);
+                for (auto &t : threads) {
+                    t.join();
+                }
+
+                for (uint32_t b = 0; b < nround; b++) {
+                    if (fwrite(buffers[b].data(), 1, lengths[b], f) != lengths[b]) {
+                        throw("Aux::File::writeLines(): write error.");
+                    }
+                }
+            }
+        }
+
+        /* little-endian encoding and decoding of binary file fields, independent of the host byte order. */
+        inline bool
+        hostIsLittleEndian()
+        {
+            uint16_t const x = 1;
+            return *reinterpret_cast<const unsigned char *>(&x) == 1;
+        }
+
+        template <typename T>
+        inline size_t
+        putLE(char *dst, T const &x)
+        {
+            memcpy(dst, &x, sizeof(T));
+            if (!hostIsLittleEndian()) {
+                std::reverse(dst, dst + sizeof(T));
+            }
+            return sizeof(T);
+        }
+
+        template <typename T>
+        inline T
+        getLE(const char *src)
+        {
+            char b[sizeof(T)];
+            T    x;
+
+            memcpy(b, src, sizeof(T));
+            if (!hostIsLittleEndian()) {
+                std::reverse(b, b + sizeof(T));
+            }
+            memcpy(&x, b, sizeof(T));
+            return x;
+        }
+
+        /* binary mesh files. ply files are written as binary_little_endian 1.0 with double vertex coordinates and
+         * faces given by a uchar count and int indices, stl files as binary stl. both headers have a fixed length
+         * independent of the counts, so that a file can be written incrementally and its header rewritten in place
+         * with the final counts once all data is known. the format*() functions encode a single record into buf and
+         * return its length, suitable for writeLines(). */
+        size_t const plyHeaderLength = 512;
+        size_t const stlHeaderLength = 84;
+        size_t const plyVertexMaxLength = 24;
+        size_t const plyFaceMaxLength = 17;
+        size_t const stlTriangleLength = 50;
+
+        void    writePlyHeader(FILE *f, uint32_t nvertices, uint32_t nfaces);
+        void    writeStlHeader(FILE *f, uint32_t ntriangles);
+
+        size_t  formatPlyVertex(char *buf, double x, double y, double z);
+        size_t  formatPlyFace(char *buf, std::array<uint32_t, 4> const &ids);
+
+        /* stl triangle (p0, p1, p2) with normal computed from its positions. stl stores single precision only. */
+        template <typename R>
+        size_t
+        formatStlTriangle(
+            char           *buf,
+            Vec3<R> const  &p0,
+            Vec3<R> const  &p1,
+            Vec3<R> const  &p2)
+        {
+            Vec3<R>         n       = (p1 - p0).cross(p2 - p0);
+            R const         len     = n.len2();
+            Vec3<R> const  *pts[4]  = { &n, &p0, &p1, &p2 };
+            char           *s       = buf;
+
+            if (len > 0) {
+                n /= len;
+            }
+            for (uint32_t i = 0; i < 4; i++) {
+                for (uint32_t k = 0; k < 3; k++) {
+                    s += putLE<float>(s, (float)(*pts[i])[k]);
+                }
+            }
+            s += putLE<uint16_t>(s, 0);
+
+            return (s - buf);
+        }
+
+        /* parse a binary little endian ply file with triangle and quad faces into data. additional vertex and face
+         * properties are skipped. returns false if the file can't be opened. */
+        bool    readPlyFile(const char *filename, ObjData &data);
+
+        /* parse a binary stl file into data. stl files carry no connectivity, vertices are identified by their exact
+         * (single precision) positions. triangles that degenerate in the process are dropped. returns false if the
+         * file can't be opened. */
+        bool    readStlFile(const char *filename, ObjData &data);
+
+        /* write / read a list of indices as text file with one index per line. both return false if the file can't
+         * be opened, readIndexFile() throws on malformed lines. */
+        bool    writeIndexFile(const char *filename, std::vector<uint32_t> const &indices);
+        bool    readIndexFile(const char *filename, std::vector<uint32_t> &indices);
+
+        /* one compartment record of a NeuroMorpho.org SWC file: id, type, position, radius and parent id as given in
+         * the file, where parent_id is -1 for root compartments. */
+        struct SWCRecord {
+            uint32_t    id;
+            uint32_t    type;
+            double      x, y, z, r;
+            int32_t     parent_id;
+        };
+
+        /* parse the SWC file filename into records, in file order. the file is mapped into memory and tokenized in
+         * place. blank lines and comments are skipped, fields beyond the seventh are ignored and any other line that
+         * doesn't start with the seven fields of a record causes an exception. returns false if the file can't be
+         * opened. */
+        bool    readSWCFile(const char *filename, std::vector<SWCRecord> &records);
     }
 
     namespace Geometry {
@@ -1262,7 +1499,8 @@ namespace Aux {
             uint32_t                                    rec_depth,
             uint32_t                                    max_elements,
             uint32_t                                    max_rec_depth,
-            std::vector<std::pair<TA, TB>>             &candidate_pairs)
+            std::vector<std::pair<TA, TB>>             &candidate_pairs,
+            uint32_t                                    nthreads = 1)
         {
             typedef std::vector<std::pair<TA, BoundingBox<R>>> APairListType;
             typedef std::vector<std::pair<TB, BoundingBox<R>>> BPairListType;
@@ -1403,20 +1641,70 @@ namespace Aux {
                 }
 
                 /* clear facelists from current call, and free the memory */
+                size_t const nelements = A_list.size() + B_list.size();
                 APairListType().swap(A_list);
                 BPairListType().swap(B_list);
 
-                /* recursive calls for sub-boxes relevant to the intersection. */
+                std::vector<uint32_t> relevant_sub_boxes;
                 for (i = 0; i < 8; i++) {
                     if (A_sub_box_relevant[i] && B_sub_box_relevant[i]) {
+                        relevant_sub_boxes.push_back(i);
+                    }
+                }
+
+                /* recursive calls for sub-boxes relevant to the intersection. */
+                if (nthreads < 2 || relevant_sub_boxes.size() < 2 || nelements < 4096) {
+                    for (auto j : relevant_sub_boxes) {
                         /* recursive call */
                         computeSpatialIntersectionCandidatePairs(
-                                sub_boxes[i],
-                                A_sub_lists[i], B_sub_lists[i],
+                                sub_boxes[j],
+                                A_sub_lists[j], B_sub_lists[j],
                                 rec_depth + 1, max_elements, max_rec_depth,
                                 candidate_pairs);
                     }
                 }
+                /* if threads are available and the lists are large enough, process the relevant sub-boxes as
+                 * concurrent tasks, among which the available threads are distributed for further splitting. every
+                 * sub-box collects its pairs in a separate buffer, and buffers are appended in sub-box order, so the
+                 * result is identical to the sequential recursion. */
+                else {
+                    uint32_t const                                  nsub            = relevant_sub_boxes.size();
+                    uint32_t const                                  sub_nthreads    = std::max(1u, nthreads / nsub);
+                    std::array<std::vector<std::pair<TA, TB>>, 8>   sub_candidate_pairs;
+                    std::atomic<uint32_t>                           next_sub(0);
+
+                    auto sub_task = [&] () -> void
+                    {
+                        uint32_t k;
+                        while ((k = next_sub++) < nsub) {
+                            uint32_t j = relevant_sub_boxes[k];
+                            computeSpatialIntersectionCandidatePairs(
+                                    sub_boxes[j],
+                                    A_sub_lists[j], B_sub_lists[j],
+                                    rec_depth + 1, max_elements, max_rec_depth,
+                                    sub_candidate_pairs[j],
+                                    sub_nthreads);
+                        }
+                    };
+
+                    std::vector<std::thread> sub_threads;
+                    for (uint32_t t = 1; t < std::min(nthreads, nsub); t++) {
+                        try {
+                            sub_threads.push_back(std::thread(sub_task));
+                        }
+                        catch (std::system_error &ex) {
+                            break;
+                        }
+                    }
+                    sub_task();
+                    for (auto &t : sub_threads) {
+                        t.join();
+                    }
+
+                    for (auto j : relevant_sub_boxes) {
+                        candidate_pairs.insert(candidate_pairs.end(), sub_candidate_pairs[j].begin(), sub_candidate_pairs[j].end());
+                    }
+                }
             }
             debugTabDec();
             debugl(3, "all recursive calls finished => returning..\n");
@@ -1678,6 +1966,28 @@ namespace Aux {
             }
         }
 
+        /* vector version of listSortedInsert() for short, id-sorted adjacency vectors */
+        template<typename T>
+        bool
+        vectorSortedInsert(
+            std::vector<T*>  &vec,
+            T*               x,
+            bool             duplicates = false)
+        {
+            auto    vit = vec.begin();
+            while (vit != vec.end() && (*vit)->id() < x->id()) {
+                ++vit;
+            }
+
+            if (vit != vec.end() && !duplicates && (*vit)->id() == x->id()) {
+                return false;
+            }
+            else {
+                vec.insert(vit, x);
+                return true;
+            }
+        }
+
         template<typename T>
         uint32_t
         listRemove(std::list<T> &l, const T &x)
@@ -1738,6 +2048,118 @@ namespace Aux {
             return sum;
         }
 
+        /* parallel sort of [first, last) with up to nthreads threads: the range is split into equally sized chunks of
+         * at least min_chunk elements, which are sorted concurrently with std::sort() and then merged pairwise with
+         * std::inplace_merge(), where all merges of one level run concurrently. for a strict total order cmp, the
+         * result is identical to that of std::sort(). */
+        template <typename RandomIt, typename Compare>
+        void
+        parallelSort(
+            RandomIt    first,
+            RandomIt    last,
+            Compare     cmp,
+            uint32_t    nthreads,
+            size_t      min_chunk = 16384)
+        {
+            size_t const    n       = last - first;
+            uint32_t const  nchunks = std::min<size_t>(nthreads, n / std::max<size_t>(min_chunk, 1));
+
+            if (nchunks < 2) {
+                std::sort(first, last, cmp);
+                return;
+            }
+
+            std::vector<RandomIt> bounds(nchunks + 1);
+            for (uint32_t k = 0; k <= nchunks; k++) {
+                bounds[k] = first + (n * k) / nchunks;
+            }
+
+            /* run all given jobs on separate threads, the last one on the calling thread. if a thread can't be
+             * spawned, the job is run on the calling thread as well. */
+            auto runConcurrently = [] (std::vector<std::function<void()>> const &jobs) -> void
+            {
+                std::vector<std::thread> threads;
+                for (size_t i = 0; i < jobs.size(); i++) {
+                    if (i + 1 < jobs.size()) {
+                        try {
+                            threads.push_back(std::thread(jobs[i]));
+                            continue;
+                        }
+                        catch (std::system_error &ex) {}
+                    }
+                    jobs[i]();
+                }
+                for (auto &t : threads) {
+                    t.join();
+                }
+            };
+
+            std::vector<std::function<void()>> jobs;
+            for (uint32_t k = 0; k < nchunks; k++) {
+                RandomIt a = bounds[k], b = bounds[k + 1];
+                jobs.push_back([a, b, &cmp] () -> void { std::sort(a, b, cmp); });
+            }
+            runConcurrently(jobs);
+
+            for (uint32_t width = 1; width < nchunks; width *= 2) {
+                jobs.clear();
+                for (uint32_t k = 0; k + width < nchunks; k += 2 * width) {
+                    RandomIt a = bounds[k], m = bounds[k + width], b = bounds[std::min(k + 2 * width, nchunks)];
+                    jobs.push_back([a, m, b, &cmp] () -> void { std::inplace_merge(a, m, b, cmp); });
+                }
+                runConcurrently(jobs);
+            }
+        }
+
+        template <typename RandomIt>
+        void
+        parallelSort(
+            RandomIt    first,
+            RandomIt    last,
+            uint32_t    nthreads,
+            size_t      min_chunk = 16384)
+        {
+            parallelSort(first, last, std::less<typename std::iterator_traits<RandomIt>::value_type>(), nthreads, min_chunk);
+        }
+
+        /* call f(b, first, last) for all blocks b of block_len consecutive indices [first, last) covering [0, n), on up
+         * to nthreads threads, each processing a contiguous range of at least min_blocks blocks. the block layout only
+         * depends on n and block_len, so per-block results combined in block order do not depend on nthreads. */
+        template <typename F>
+        void
+        parallelBlocks(
+            size_t      n,
+            size_t      block_len,
+            uint32_t    nthreads,
+            F const    &f,
+            size_t      min_blocks = 16)
+        {
+            size_t const    nblocks = (n + block_len - 1) / block_len;
+            uint32_t const  nchunks = std::max<size_t>(1, std::min<size_t>(nthreads, nblocks / std::max<size_t>(min_blocks, 1)));
+
+            auto runRange = [&] (uint32_t k) -> void
+            {
+                size_t const last_block = (nblocks * (k + 1)) / nchunks;
+                for (size_t b = (nblocks * k) / nchunks; b < last_block; b++) {
+                    f(b, b * block_len, std::min(n, (b + 1) * block_len));
+                }
+            };
+
+            std::vector<std::thread> threads;
+            for (uint32_t k = 1; k < nchunks; k++) {
+                try {
+                    threads.push_back(std::thread(runRange, k));
+                }
+                catch (std::system_error &ex) {
+                    runRange(k);
+                }
+            }
+            runRange(0);
+            for (auto &t : threads) {
+                t.join();
+            }
+        }
+
         /* generic binary searching for index on vectors, since C++ is so goddamn ugly it doesn't give you a efficient
          * way to do that. it WILL give you the iterator, but it won't give you its index without packing it
          * inside the key structure, which is just ugly */
@@ -1922,6 +2344,79 @@ namespace Aux {
 
             sigma = std::sqrt( var / (n-1.0) );
         }
+
+        /* running min, max, mean and sum of squared deviations m2 of a sequence of values, which need not be stored.
+         * single values are added with Welford's update, whole arrays with a two-pass over the array. partial results
+         * of disjoint sequences are combined with merge() (Chan et al.), so accumulators of fixed blocks merged in
+         * block order give the same result independent of the number of threads. */
+        template <typename R>
+        struct RunningStat {
+            uint64_t    n;
+            R           min, max, mean, m2;
+
+            RunningStat()
+            : n(0), min(Aux::Numbers::inf<R>()), max(-Aux::Numbers::inf<R>()), mean(0), m2(0)
+            {}
+
+            void
+            add(R x)
+            {
+                this->n++;
+                this->min       = std::min(this->min, x);
+                this->max       = std::max(this->max, x);
+
+                R const delta   = x - this->mean;
+                this->mean     += delta / (R)this->n;
+                this->m2       += delta * (x - this->mean);
+            }
+
+            void
+            add(R const *values, size_t m)
+            {
+                if (m > 0) {
+                    RunningStat s;
+                    R           sum = 0;
+
+                    for (size_t j = 0; j < m; j++) {
+                        s.min   = std::min(s.min, values[j]);
+                        s.max   = std::max(s.max, values[j]);
+                        sum    += values[j];
+                    }
+                    s.n         = m;
+                    s.mean      = sum / (R)m;
+                    for (size_t j = 0; j < m; j++) {
+                        s.m2   += (values[j] - s.mean) * (values[j] - s.mean);
+                    }
+                    this->merge(s);
+                }
+            }
+
+            void
+            merge(RunningStat const &o)
+            {
+                if (o.n > 0) {
+                    R const n       = (R)(this->n + o.n);
+                    R const delta   = o.mean - this->mean;
+
+                    this->m2       += o.m2 + delta * delta * ((R)this->n * (R)o.n / n);
+                    this->mean     += delta * ((R)o.n / n);
+                    this->min       = std::min(this->min, o.min);
+                    this->max       = std::max(this->max, o.max);
+                    this->n        += o.n;
+                }
+            }
+
+            /* same conventions as computeMinMaxAvgSigma(): bessel-corrected sigma, avg / sigma undefined (NaN) for
+             * less than one / two values. */
+            void
+            get(R &min, R &max, R &avg, R &sigma) const
+            {
+                min     = this->min;
+                max     = this->max;
+                avg     = (this->n > 0) ? this->mean : std::numeric_limits<R>::quiet_NaN();
+                sigma   = (this->n > 1) ? std::sqrt(this->m2 / (R)(this->n - 1)) : std::numeric_limits<R>::quiet_NaN();
+            }
+        };
     }
 
 
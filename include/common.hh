@@ -60,6 +60,8 @@
 #include <complex>
 
 #include <array>
+#include <atomic>
+#include <condition_variable>
 #include <cstring>
 #include <ctime>
 #include <functional>
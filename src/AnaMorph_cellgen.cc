@@ -73,11 +73,15 @@ const std::list<
         { "ana-nthreads",                           1 },
         { "ana-univar-eps",                         1 },
         { "ana-bivar-eps",                          1 },
+        { "mesh-format",                            1 },
         { "no-mesh-pp",                             0 },
         { "mesh-pp-gec",                            4 },
         { "no-mesh-pp-gec",                         0 },
         { "mesh-pp-hc",                             3 },
         { "no-mesh-pp-hc",                          0 },
+        { "pp-decimate",                            1 },
+        { "mesh-pp-seams",                          1 },
+        { "mesh-pp-nthreads",                       1 },
         { "meshing-soma-refs",                      1 },
         { "meshing-cansurf-angularsegments",        1 },
         { "meshing-triangle-height",                1 },
@@ -85,7 +89,11 @@ const std::list<
         { "meshing-innerloop-maxiter",              1 },
         { "preserve-crease-edges",                  0 },
         { "meshing-flush",                          1 },
+        { "meshing-flush-mem",                      1 },
         { "no-meshing-flush",                       0 },
+        { "meshing-nthreads",                       1 },
+        { "meshing-parallel-trees",                 0 },
+        { "meshing-parallel-cells",                 0 },
         { "meshing-merging-initial-radiusfactor",   1 },
         { "meshing-merging-radiusfactor-decrement", 1 },
         { "meshing-complexedge-max-growthfactor",   1 },
@@ -106,7 +114,12 @@ const std::list<
         { "mesh-pp-hc",     "no-mesh-pp-hc" },
         { "no-mesh-pp",     "mesh-pp-gec"},
         { "no-mesh-pp",     "mesh-pp-hc"},
+        { "no-mesh-pp",     "pp-decimate"},
+        { "no-mesh-pp",     "mesh-pp-seams"},
+        { "no-mesh-pp",     "mesh-pp-nthreads"},
         { "meshing-flush",  "no-meshing-flush" },
+        { "meshing-flush",  "meshing-flush-mem" },
+        { "meshing-flush-mem", "no-meshing-flush" },
         { "no-analysis",    "meshing" },
         { "no-analysis",    "force-meshing" },
         { "no-analysis",    "meshing-individual-surfaces"           },
@@ -114,7 +127,11 @@ const std::list<
         { "no-analysis",    "meshing-outerloop-maxiter",            },
         { "no-analysis",    "meshing-innerloop-maxiter",            },
         { "no-analysis",    "meshing-flush",                        },
+        { "no-analysis",    "meshing-flush-mem",                    },
         { "no-analysis",    "no-meshing-flush",                     },
+        { "no-analysis",    "meshing-nthreads",                     },
+        { "no-analysis",    "meshing-parallel-trees",               },
+        { "no-analysis",    "meshing-parallel-cells",               },
         { "no-analysis",    "meshing-merging-initial-radiusfactor", },
         { "no-analysis",    "meshing-merging-radiusfactor-decrement"},
         { "no-analysis",    "meshing-complexedge-max-growthfactor"  },
@@ -175,9 +192,9 @@ const std::string usage_string =
 "                                the network name is the name of the SWC\n"\
 "                                morphology file without suffix (that is,\n"\
 "                                without \".swc\").\n"\
-"                                for convenience, the extensions \".swc\", \".obj\"\n"\
-"                                and \".amv\" are stripped from the input\n"\
-"                                string if present.\n"\
+"                                for convenience, the extensions \".swc\", \".obj\",\n"\
+"                                \".ply\", \".stl\" and \".amv\" are stripped from\n"\
+"                                the input string if present.\n"\
 "                                EXAMPLE: the network name for \"ri05.CNG.swc\"\n"\
 "                                if \"ri05.CNG\". using \"ri05.CNG.obj\" would yield\n"\
 "                                the same network name.\n"\
@@ -341,6 +358,66 @@ const std::string usage_string =
 "                                amount of available RAM is exceeded.\n"\
 "                                DEFAULT: enabled, <flush_face_limit> = 100000.\n"\
 "\n"\
+" -meshing-flush-mem <MB>        enable mesh flushing as -meshing-flush, but\n"\
+"                                trigger partial flushes by memory instead of\n"\
+"                                by face count: a flush is performed whenever the\n"\
+"                                estimated heap footprint of the partially\n"\
+"                                completed mesh, including its topology lists,\n"\
+"                                spatial search structures and undo journal,\n"\
+"                                exceeds <MB> megabytes. flushed parts still\n"\
+"                                waiting to be written count towards <MB> as\n"\
+"                                well, meshing waits for them to be written\n"\
+"                                before flushing again. this bounds the memory\n"\
+"                                of the mesh independently of the morphology,\n"\
+"                                e.g. when running several jobs on one node.\n"\
+"                                the budget should leave room for the parts of\n"\
+"                                the mesh that can't be flushed yet, otherwise\n"\
+"                                a flush is attempted after every neurite path.\n"\
+"                                <MB> must be >= 1.\n"\
+"                                DEFAULT: disabled.\n"\
+"\n"\
+" -meshing-nthreads <n>          number of threads used during inductive cell\n"\
+"                                meshing. if n > 1, n - 1 worker threads\n"\
+"                                precompute the geometry of upcoming neurite\n"\
+"                                path meshes (render vectors, spine curve\n"\
+"                                samples) while the main thread merges the\n"\
+"                                current one into the cell mesh. the generated\n"\
+"                                mesh does not depend on n. n must be > 0.\n"\
+"                                DEFAULT: 1.\n"\
+"\n"\
+" -meshing-parallel-trees        mesh the neurites of all cells on <n> worker\n"\
+"                                threads (see -meshing-nthreads) by a reduction\n"\
+"                                over their branches: every neurite path is\n"\
+"                                meshed on its own and the meshes of its child\n"\
+"                                branches are merged into it as soon as they are\n"\
+"                                finished, so the branches of a single large\n"\
+"                                neurite are meshed in parallel as well. the\n"\
+"                                finished neurite meshes are joined to their\n"\
+"                                somas. branches or neurites that can't be\n"\
+"                                merged as a whole, e.g. because they touch\n"\
+"                                another branch or the soma, fall back to\n"\
+"                                sequential meshing. the generated mesh is\n"\
+"                                reproducible and does not depend on n, but\n"\
+"                                differs from the sequentially generated one in\n"\
+"                                vertex numbering and random angular offsets of\n"\
+"                                neurite paths.\n"\
+"                                DEFAULT: disabled.\n"\
+"\n"\
+" -meshing-parallel-cells        in networks with several somas, group cells with\n"\
+"                                overlapping bounding boxes into clusters and\n"\
+"                                mesh every cluster independently on <n> worker\n"\
+"                                threads (see -meshing-nthreads). the cluster\n"\
+"                                meshes are concatenated in order and flushed to\n"\
+"                                disk as a whole. takes precedence over\n"\
+"                                -meshing-parallel-trees if there is more than\n"\
+"                                one cluster, in which case the latter is ignored\n"\
+"                                with a warning. the generated mesh is\n"\
+"                                reproducible and does not depend on n, but\n"\
+"                                differs from the sequentially generated one in\n"\
+"                                vertex numbering and random angular offsets of\n"\
+"                                neurite paths.\n"\
+"                                DEFAULT: disabled.\n"\
+"\n"\
 " -meshing-soma-refs <n>         defines the number of refinements performed on an\n"
 "                                icosahedron to represent the soma sphere,\n"
 "                                default value: 3.\n"
@@ -444,6 +521,22 @@ const std::string usage_string =
 "                                1 is advisable in light of the above explanation.\n"\
 "                                DEFAULT: <c> = 2.0.\n"\
 "                                \n"\
+" -mesh-format <format>          file format of all output meshes, one of\n"\
+"                                \"obj\": wavefront obj text file,\n"\
+"                                \"ply\": binary little endian ply file,\n"\
+"                                \"stl\": binary stl file.\n"\
+"                                the file extension of all output mesh file names\n"\
+"                                given here changes accordingly. the binary\n"\
+"                                formats are considerably smaller and faster to\n"\
+"                                write and read. mesh flushing (-meshing-flush)\n"\
+"                                works with all formats. post-processing reloads\n"\
+"                                the union mesh in the same format.\n"\
+"                                NOTE: stl files store single precision triangles\n"\
+"                                without connectivity (quads are split). vertices\n"\
+"                                are identified by their positions when reloading\n"\
+"                                a stl mesh for post-processing.\n"\
+"                                DEFAULT: obj.\n"\
+"\n"\
 " -no-mesh-pp                    disable cell network union mesh post-processing\n"\
 "                                entirely. equivalent to\n"\
 "                                -no-mesh-pp-gec -no-mesh-pp-hc\n"\
@@ -491,6 +584,41 @@ const std::string usage_string =
 "\n"\
 "                                \"<CELLNETWORK>_post_processed.obj\".\n"\
 "\n"\
+" -pp-decimate <faces>           reduce the cell network union mesh to at most\n"\
+"                                <faces> faces by quadric error metric edge\n"\
+"                                collapses during post-processing. edges are\n"\
+"                                collapsed in order of increasing geometric error\n"\
+"                                and only if topologically safe, so the mesh stays\n"\
+"                                manifold. decimation is performed last, after\n"\
+"                                stages 1 and 2, since smoothing a decimated mesh\n"\
+"                                shrinks thin neurites considerably.\n"\
+"                                DEFAULT: disabled.\n"\
+"\n"\
+" -mesh-pp-seams <k>             restrict stages 1 and 2 of the post-processing\n"\
+"                                to the seams of the cell network union mesh,\n"\
+"                                i.e. to the k-ring of faces around the faces\n"\
+"                                created near the seams while merging. only\n"\
+"                                triangles of this region are collapsed and only\n"\
+"                                their vertices are smoothed, all others are\n"\
+"                                kept. during meshing, the file indices of the\n"\
+"                                seam vertices are written to the file\n"\
+"\n"\
+"                                \"<CELLNETWORK>_seams.txt\".\n"\
+"\n"\
+"                                decimation is not restricted. not supported for\n"\
+"                                stl files, which carry no vertex indices.\n"\
+"                                DEFAULT: disabled.\n"\
+"\n"\
+" -mesh-pp-nthreads <n>          number of threads used during post-processing.\n"\
+"                                with n > 1, stage 1 evaluates candidate\n"\
+"                                triangles concurrently and collapses edges in\n"\
+"                                rounds of independent edges with disjoint\n"\
+"                                one-rings. the quality criteria are unchanged,\n"\
+"                                but the result differs in detail from the\n"\
+"                                serial greedy order. stage 2 runs its sweeps on\n"\
+"                                n threads with identical results. n must be > 0.\n"\
+"                                DEFAULT: 1.\n"\
+"\n"\
 " -debug-lvl <cmp> <lvl>         Enable debugging for component <cmp>\n"\
 "                                and set debug level to <lvl>.\n"\
 "                                Debug component 0 is global debugging.\n"\
@@ -524,8 +652,15 @@ AnaMorph_cellgen::AnaMorph_cellgen(
     this->force_meshing                             = false;
     this->meshing_individual_surfaces               = false;
 
+    this->mesh_format                               = MESH_FILE_OBJ;
+
     this->meshing_flush                             = true;
     this->meshing_flush_face_limit                  = 100000;
+    this->meshing_flush_mem_limit                   = 0;
+
+    this->meshing_nthreads                          = 1;
+    this->meshing_parallel_trees                    = false;
+    this->meshing_parallel_cells                    = false;
 
     this->meshing_n_soma_refs                       = 3;
     this->scale_radius                              = 1.0;
@@ -554,6 +689,14 @@ AnaMorph_cellgen::AnaMorph_cellgen(
     this->pp_hc_alpha                               = 0.4;
     this->pp_hc_beta                                = 0.7;
     this->pp_hc_maxiter                             = 10;
+
+    this->pp_decimate                               = false;
+    this->pp_decimate_faces                         = 0;
+
+    this->pp_seams                                  = false;
+    this->pp_seams_k                                = 0;
+
+    this->pp_nthreads                               = 1;
 }
 
 bool
@@ -751,6 +894,21 @@ AnaMorph_cellgen::processCommandLineArguments()
                 return false;
             }
         }
+        else if (s == "mesh-format") {
+            if (s_args[0] == "obj") {
+                this->mesh_format = MESH_FILE_OBJ;
+            }
+            else if (s_args[0] == "ply") {
+                this->mesh_format = MESH_FILE_PLY;
+            }
+            else if (s_args[0] == "stl") {
+                this->mesh_format = MESH_FILE_STL;
+            }
+            else {
+                printf("ERROR: invalid argument to switch \"mesh-format\". format must be one of \"obj\", \"ply\", \"stl\".\n");
+                return false;
+            }
+        }
         else if (s == "no-mesh-pp") {
             this->pp_gec    = false;
             this->pp_hc     = false;
@@ -825,6 +983,59 @@ AnaMorph_cellgen::processCommandLineArguments()
         else if (s == "no-mesh-pp-hc") {
             this->pp_hc = false;
         }
+        else if (s == "pp-decimate") {
+            try {
+                this->pp_decimate       = true;
+                this->pp_decimate_faces = stou(s_args[0]);
+            }
+            catch (std::out_of_range& ex) {
+                printf("ERROR: argument to switch \"pp-decimate\" out of range.\n");
+                return false;
+            }
+            catch (...) {
+                printf("ERROR: argument to switch \"pp-decimate\" could not be converted to an unsigned integer.\n");
+                return false;
+            }
+
+            /* check value */
+            if (this->pp_decimate_faces == 0) {
+                printf("ERROR: face budget given to switch \"pp-decimate\" must be > 0.\n");
+                return false;
+            }
+        }
+        else if (s == "mesh-pp-seams") {
+            try {
+                this->pp_seams      = true;
+                this->pp_seams_k    = stou(s_args[0]);
+            }
+            catch (std::out_of_range& ex) {
+                printf("ERROR: argument to switch \"mesh-pp-seams\" out of range.\n");
+                return false;
+            }
+            catch (...) {
+                printf("ERROR: argument to switch \"mesh-pp-seams\" could not be converted to an unsigned integer.\n");
+                return false;
+            }
+        }
+        else if (s == "mesh-pp-nthreads") {
+            try {
+                this->pp_nthreads = stou(s_args[0]);
+            }
+            catch (std::out_of_range& ex) {
+                printf("ERROR: argument to switch \"mesh-pp-nthreads\" out of range.\n");
+                return false;
+            }
+            catch (...) {
+                printf("ERROR: argument to switch \"mesh-pp-nthreads\" could not be converted to an unsigned integer.\n");
+                return false;
+            }
+
+            /* check value */
+            if (this->pp_nthreads == 0) {
+                printf("ERROR: number of post-processing threads must be >= 1\n");
+                return false;
+            }
+        }
         else if (s == "meshing-soma-refs") {
             try {
                 meshing_n_soma_refs = stou(s_args[0]);
@@ -942,9 +1153,54 @@ AnaMorph_cellgen::processCommandLineArguments()
                 return false;
             }
         }
+        else if (s == "meshing-flush-mem") {
+            try {
+                this->meshing_flush             = true;
+                this->meshing_flush_mem_limit   = stou(s_args[0]);
+            }
+            catch (std::out_of_range& ex) {
+                printf("ERROR: argument to switch \"meshing-flush-mem\" out of range.\n");
+                return false;
+            }
+            catch (...) {
+                printf("ERROR: argument to switch \"meshing-flush-mem\" could not be converted to an unsigned integer.\n");
+                return false;
+            }
+
+            /* check value */
+            if (this->meshing_flush_mem_limit < 1) {
+                printf("ERROR: memory limit parameter to switch \"meshing-flush-mem\" must be >= 1 MB.\n");
+                return false;
+            }
+        }
         else if (s == "no-meshing-flush") {
             this->meshing_flush = false;
         }
+        else if (s == "meshing-nthreads") {
+            try {
+                this->meshing_nthreads = stou(s_args[0]);
+            }
+            catch (std::out_of_range& ex) {
+                printf("ERROR: argument to switch \"meshing-nthreads\" out of range.\n");
+                return false;
+            }
+            catch (...) {
+                printf("ERROR: argument to switch \"meshing-nthreads\" could not be converted to an unsigned integer.\n");
+                return false;
+            }
+
+            /* check value */
+            if (this->meshing_nthreads == 0) {
+                printf("ERROR: number of meshing threads must be >= 1\n");
+                return false;
+            }
+        }
+        else if (s == "meshing-parallel-trees") {
+            this->meshing_parallel_trees = true;
+        }
+        else if (s == "meshing-parallel-cells") {
+            this->meshing_parallel_cells = true;
+        }
         else if (s == "meshing-merging-radiusfactor-decrement") {
             try {
                 this->meshing_radius_factor_decrement = std::stod(s_args[0]);
@@ -1021,6 +1277,8 @@ AnaMorph_cellgen::processCommandLineArguments()
             if (    network_name_extension != ".swc" &&
                     network_name_extension != ".amv" &&
                     network_name_extension != ".obj" &&
+                    network_name_extension != ".ply" &&
+                    network_name_extension != ".stl" &&
                     network_name_extension != ".CNG")
             {
                 printf("ERROR: input file name invalid.\n");
@@ -1072,8 +1330,15 @@ AnaMorph_cellgen::run()
             C_settings.partition_algo                           = this->partition_algo;
             C_settings.parametrization_algo                     = this->parametrization_algo;
 
+            C_settings.meshing_mesh_format                      = this->mesh_format;
             C_settings.meshing_flush                            = this->meshing_flush;
             C_settings.meshing_flush_face_limit                 = this->meshing_flush_face_limit;
+            C_settings.meshing_flush_mem_limit                  = this->meshing_flush_mem_limit;
+            C_settings.meshing_write_seams                      = this->pp_seams;
+
+            C_settings.meshing_nthreads                         = this->meshing_nthreads;
+            C_settings.meshing_parallel_trees                   = this->meshing_parallel_trees;
+            C_settings.meshing_parallel_cells                   = this->meshing_parallel_cells;
 
             C_settings.meshing_n_soma_refs                      = this->meshing_n_soma_refs;
             C_settings.meshing_canal_segment_n_phi_segments     = this->meshing_canal_segment_n_phi_segments;
@@ -1138,7 +1403,7 @@ AnaMorph_cellgen::run()
 
             /* render cell network mesh */
             if (clean || this->force_meshing) {
-                printf("rendering cell network to consistent mesh \"%s.obj\".\n", network_name.c_str());
+                printf("rendering cell network to consistent mesh \"%s.%s\".\n", network_name.c_str(), meshFileExtension(this->mesh_format));
                 if (this->force_meshing) {
                     printf("\t NOTE: meshing forced in spite of potentially unclean network.\n");fflush(stdout);
                 }
@@ -1151,7 +1416,7 @@ AnaMorph_cellgen::run()
             if (this->meshing_individual_surfaces) {
                 std::string ims_filename = std::string(network_name + "_individual_modelling_surfaces");
 
-                printf("rendering cell network modelling surfaces individually to output mesh \"%s.obj\".\n", ims_filename.c_str());fflush(stdout);
+                printf("rendering cell network modelling surfaces individually to output mesh \"%s.%s\".\n", ims_filename.c_str(), meshFileExtension(this->mesh_format));fflush(stdout);
                 /* render geometric modelling surfaces individually and output mesh */
                 C.renderModellingMeshesIndividually<bool, bool, bool>(std::string(network_name + "_individual_modelling_surfaces"));
 
@@ -1160,12 +1425,33 @@ AnaMorph_cellgen::run()
         }
 
         /* mesh-post-processing */
-        if (this->pp_gec || this->pp_hc) {
-            printf("post-processing union mesh \"%s.obj\".\n", this->network_name.c_str() );
+        if (this->pp_gec || this->pp_hc || this->pp_decimate) {
+            printf("post-processing union mesh \"%s.%s\".\n", this->network_name.c_str(), meshFileExtension(this->mesh_format));
             /* reload mesh to ram */
             Mesh<bool, bool, bool, double> M_cell;
             try {
-                M_cell.readFromObjFile( (network_name + ".obj").c_str());
+                M_cell.readFromFile(network_name.c_str(), this->mesh_format, this->meshing_nthreads);
+
+                /* seam-local mode: vertex ids of the reloaded mesh are file indices, so the seam vertices written
+                 * during meshing can be looked up directly. */
+                std::vector<uint32_t>   seam_region;
+                bool                    seam_local = false;
+                if (this->pp_seams) {
+                    std::vector<uint32_t> seam_vertices;
+                    if (this->mesh_format == MESH_FILE_STL) {
+                        printf("\t WARNING: seam-local post-processing not supported for stl files. processing entire mesh.\n");
+                    }
+                    else if (!Aux::File::readIndexFile( (this->network_name + "_seams.txt").c_str(), seam_vertices)) {
+                        printf("\t WARNING: could not open seam file \"%s_seams.txt\". processing entire mesh.\n", this->network_name.c_str());
+                    }
+                    else {
+                        MeshAlg::getSeamRegion(M_cell, seam_vertices, this->pp_seams_k, seam_region);
+                        seam_local = true;
+                        printf("\t seam-local post-processing: %zu seam vertices, %zu of %d faces within the %d-ring.\n",
+                            seam_vertices.size(), seam_region.size(), M_cell.numFaces(), this->pp_seams_k);
+                    }
+                }
+
                 if (this->pp_gec) {
                     printf("\t stage 1: improved edge-collapse algorithm. parameters:\n"\
                         "\t\t alpha:  %5.4f\n"\
@@ -1174,12 +1460,25 @@ AnaMorph_cellgen::run()
                         "\t\t d:      %5d\n",
                         this->pp_gec_alpha, this->pp_gec_lambda, this->pp_gec_mu, this->pp_gec_d);
 
-                    MeshAlg::greedyEdgeCollapsePostProcessing(
-                        M_cell,
-                        this->pp_gec_alpha,
-                        this->pp_gec_lambda,
-                        this->pp_gec_mu,
-                        this->pp_gec_d);
+                    if (this->pp_nthreads > 1) {
+                        MeshAlg::parallelGreedyEdgeCollapsePostProcessing(
+                            M_cell,
+                            this->pp_gec_alpha,
+                            this->pp_gec_lambda,
+                            this->pp_gec_mu,
+                            this->pp_gec_d,
+                            this->pp_nthreads,
+                            seam_local ? &seam_region : NULL);
+                    }
+                    else {
+                        MeshAlg::greedyEdgeCollapsePostProcessing(
+                            M_cell,
+                            this->pp_gec_alpha,
+                            this->pp_gec_lambda,
+                            this->pp_gec_mu,
+                            this->pp_gec_d,
+                            seam_local ? &seam_region : NULL);
+                    }
                 }
 
                 if (this->pp_hc) {
@@ -1193,14 +1492,26 @@ AnaMorph_cellgen::run()
                         M_cell,
                         this->pp_hc_alpha,
                         this->pp_hc_beta,
-                        this->pp_hc_maxiter);
+                        this->pp_hc_maxiter,
+                        this->pp_nthreads,
+                        seam_local ? &seam_region : NULL);
+                }
+
+                if (this->pp_decimate) {
+                    printf("\t stage 3: quadric error decimation. parameters:\n"\
+                        "\t\t faces:  %5d\n",
+                        this->pp_decimate_faces);
+
+                    MeshAlg::quadricErrorDecimation(M_cell, this->pp_decimate_faces);
+
+                    printf("\t\t faces after decimation: %d\n", M_cell.numFaces());
                 }
 
-                M_cell.writeObjFile( (this->network_name + "_post_processed").c_str() );
+                M_cell.writeFile( (this->network_name + "_post_processed").c_str(), this->mesh_format, this->meshing_nthreads);
             }
             catch (MeshEx& e) {
                 if (e.error_type == MESH_IO_ERROR) {
-                    printf("\t ERROR: could not open mesh obj file for post-processing. skipping..\n");
+                    printf("\t ERROR: could not open mesh file for post-processing. skipping..\n");
                 }
                 else throw;
             }
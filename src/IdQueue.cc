@@ -130,3 +130,37 @@ IdQueue::freeId(uint32_t id)
         debugl(1, "IdQueue::freeId(): WARNING: attempting to free id (%5d), which is smaller than this->smallest_id (%5d). ignoring..\n", id, this->smallest_id);
     }
 }
+
+bool
+IdQueue::getIdRange(
+    uint32_t    n,
+    uint32_t   &first)
+{
+    debugl(5, "IdQueue::getIdRange()\n");
+
+    /* all ids in q are distinct and lie in (next_id, last_id], so q contains the entire range (i.e. nothing above
+     * next_id has been freed) if and only if its size matches. */
+    if (this->q.size() != (size_t)(this->last_id - this->next_id)) {
+        return false;
+    }
+
+    /* ids up to UINT32_MAX - 1 can be handed out, let getId() report the overflow */
+    if ((uint64_t)this->next_id + n >= UINT32_MAX) {
+        return false;
+    }
+
+    first           = this->next_id;
+    this->next_id  += n;
+
+    /* drop the now partially used range from q. with q empty and next_id == last_id, the next call to getId() will
+     * refill q starting at next_id + 1. */
+    if (n > 0) {
+        this->q         =   std::priority_queue<
+                                uint32_t,
+                                std::deque<uint32_t>,
+                                std::greater<uint32_t> > ();
+        this->last_id   = this->next_id;
+    }
+
+    return true;
+}
@@ -48,7 +48,6 @@
 
 #include "Polynomial.hh"
 
-#include "Octree.hh"
 #include "Mesh.hh"
 #include "MeshAlgorithms.hh"
 
@@ -104,17 +103,128 @@ std::string const usage_text =
 "\n"\
 "am_meshstat: generate mesh statistics.\n"\
 "\n"\
-"Usage: am_meshstat <OBJ_FILE>\n"\
+"Usage: am_meshstat [-stream] [-nthreads <n>] <OBJ_FILE>\n"\
+"\n"\
+"   -stream         compute the statistics in a single streaming pass over the\n"\
+"                   faces of the obj file without building the mesh topology.\n"\
+"                   only the vertex positions and a compact edge table are kept\n"\
+"                   in memory, which allows for meshes that would not fit into\n"\
+"                   memory as a Mesh. the results don't depend on -nthreads.\n"\
+"\n"\
+"   -nthreads <n>   number of threads used for reading, and for the streaming\n"\
+"                   pass with -stream. default: number of hardware threads.\n"\
 "\n";
 
 using namespace std;
 
+/* open-addressing hash set of undirected edges, packed into one 64-bit key (min id, max id). key 0 (edge (0, 0))
+ * never occurs and marks empty slots. insertions are lock-free, so the set can be filled from several threads. the
+ * table is sized for an expected number of edges at load factor at most 3/4 and refuses insertions beyond 7/8 of its
+ * capacity, which is recorded in overflow(), so that probing always terminates. */
+class EdgeSet {
+    private:
+        std::vector<std::atomic<uint64_t>>  slots;
+        uint64_t                            mask;
+        uint64_t                            max_size;
+        std::atomic<uint64_t>               size;
+        std::atomic<bool>                   full;
+
+    public:
+        EdgeSet(size_t expected_edges)
+        {
+            size_t cap = 16;
+            while (3 * cap < 4 * expected_edges) {
+                cap <<= 1;
+            }
+            this->slots = std::vector<std::atomic<uint64_t>>(cap);
+            for (auto &s : this->slots) {
+                s.store(0, std::memory_order_relaxed);
+            }
+            this->mask      = cap - 1;
+            this->max_size  = cap - cap / 8;
+            this->size.store(0);
+            this->full.store(false);
+        }
+
+        bool
+        overflow() const
+        {
+            return this->full.load();
+        }
+
+        /* returns true if edge {u, v} was not contained yet */
+        bool
+        insert(uint32_t u, uint32_t v)
+        {
+            uint64_t const  key = (u < v) ? (((uint64_t)u << 32) | v) : (((uint64_t)v << 32) | u);
+            uint64_t        i   = ((key * 0x9E3779B97F4A7C15ULL) >> 20) & this->mask;
+
+            while (true) {
+                uint64_t cur = this->slots[i].load(std::memory_order_relaxed);
+                if (cur == key) {
+                    return false;
+                }
+                else if (cur == 0) {
+                    if (this->size.load(std::memory_order_relaxed) >= this->max_size) {
+                        this->full.store(true);
+                        return false;
+                    }
+                    else if (this->slots[i].compare_exchange_strong(cur, key, std::memory_order_relaxed)) {
+                        this->size.fetch_add(1, std::memory_order_relaxed);
+                        return true;
+                    }
+                    else if (cur == key) {
+                        return false;
+                    }
+                }
+                i = (i + 1) & this->mask;
+            }
+        }
+};
+
+/* per-chunk accumulators of the streaming statistics, combined in chunk order. */
+struct StreamStats {
+    uint64_t                        nedges      = 0;
+    uint64_t                        nobtuse     = 0;
+    double                          area        = 0.0;
+    double                          volume      = 0.0;
+    Aux::Stat::RunningStat<double>  ar;
+    bool                            quad        = false;
+
+    void
+    merge(StreamStats const &o)
+    {
+        this->nedges   += o.nedges;
+        this->nobtuse  += o.nobtuse;
+        this->area     += o.area;
+        this->volume   += o.volume;
+        this->ar.merge(o.ar);
+        this->quad      = this->quad || o.quad;
+    }
+};
+
 int main(int argc, char *argv[])
 {
     std::string meshname;
+    bool        stream      = false;
+    uint32_t    nthreads    = std::max(1u, std::thread::hardware_concurrency());
+
+    int i;
+    for (i = 1; i < argc - 1; i++) {
+        std::string s(argv[i]);
+        if (s == "-stream") {
+            stream = true;
+        }
+        else if (s == "-nthreads" && i + 2 < argc) {
+            nthreads = std::max(1, atoi(argv[++i]));
+        }
+        else {
+            break;
+        }
+    }
 
-    if (argc == 2) {
-        meshname = std::string(argv[1]);
+    if (i == argc - 1 && argv[i][0] != '-') {
+        meshname = std::string(argv[i]);
     }
     else {
         printf("%s", usage_text.c_str());
@@ -125,18 +235,100 @@ int main(int argc, char *argv[])
         uint32_t    nobtuse_tris;
         int         nvertices, nfaces, nedges, chi;
 
-        Mesh<bool, bool, bool, double> M;
-        M.readFromObjFile(meshname.c_str());
-
-        /* statistics */
-        area            = M.getTotalArea();
-        volume          = M.getTotalVolume();
-        nvertices       = M.numVertices();
-        nfaces          = M.numFaces();
-        nedges          = M.numEdges();
-        chi             = nvertices - nedges + nfaces;
-        M.getAvgAspectRatio(ar_avg, ar_sigma, &ar_max);
-        nobtuse_tris    = M.numObtuseTriangles();
+        if (stream) {
+            std::vector<std::array<double, 3>>  x;
+            std::vector<StreamStats>            chunk_stats;
+            std::unique_ptr<EdgeSet>            edges;
+
+            /* a closed triangle mesh has 1.5 * nfaces edges. if the table overflows, e.g. for a triangle soup with up
+             * to 3 * nfaces edges, the pass is repeated with a larger table. */
+            double edges_per_face = 1.5;
+
+            auto begin = [&] (size_t nf, uint32_t nchunks) -> void
+                {
+                    edges.reset(new EdgeSet(edges_per_face * nf));
+                    chunk_stats.assign(nchunks, StreamStats());
+                };
+
+            auto face = [&] (uint32_t k, std::array<uint32_t, 4> const &f) -> void
+                {
+                    StreamStats &st = chunk_stats[k];
+                    if (f[3] != UINT32_MAX) {
+                        st.quad = true;
+                        return;
+                    }
+
+                    for (uint32_t j = 0; j < 3; j++) {
+                        if (edges->insert(f[j], f[(j + 1) % 3])) {
+                            st.nedges++;
+                        }
+                    }
+
+                    Vec3<double> v0(x[f[0]][0], x[f[0]][1], x[f[0]][2]);
+                    Vec3<double> v1(x[f[1]][0], x[f[1]][1], x[f[1]][2]);
+                    Vec3<double> v2(x[f[2]][0], x[f[2]][1], x[f[2]][2]);
+
+                    double const a  = (v1 - v0).len2();
+                    double const b  = (v2 - v1).len2();
+                    double const c  = (v0 - v2).len2();
+                    double const s  = 0.5*(a + b + c);
+
+                    st.area    += ((v1 - v0).cross(v2 - v0)).len2() / 2.0;
+                    st.volume  += (v0 * v1.cross(v2)) / 6.0;
+                    if (a*a + b*b < c*c || b*b + c*c < a*a || c*c + a*a < b*b) {
+                        st.nobtuse++;
+                    }
+                    st.ar.add((a*b*c) / (8.0*(s - a)*(s - b)*(s - c)));
+                };
+
+            while (true) {
+                if (!Aux::File::streamObjFile(meshname.c_str(), x, begin, face, nthreads)) {
+                    throw("am_meshstat: can't open obj file.");
+                }
+                if (!edges || !edges->overflow()) {
+                    break;
+                }
+                edges_per_face *= 2.0;
+            }
+
+            StreamStats st;
+            for (auto &c : chunk_stats) {
+                st.merge(c);
+            }
+            if (st.quad) {
+                throw("am_meshstat: streaming statistics require a triangle mesh.");
+            }
+
+            area            = st.area;
+            volume          = fabs(st.volume);
+            nvertices       = x.size();
+            nfaces          = st.ar.n;
+            nedges          = st.nedges;
+            chi             = nvertices - nedges + nfaces;
+            ar_avg          = (st.ar.n > 0) ? st.ar.mean : 0.0;
+            ar_sigma        = (st.ar.n > 1) ? sqrt(st.ar.m2 / (st.ar.n - 1)) : 0.0;
+            ar_max          = st.ar.max;
+            nobtuse_tris    = st.nobtuse;
+        }
+        else {
+            Mesh<bool, bool, bool, double> M;
+            M.readFromObjFile(meshname.c_str(), nthreads);
+
+            /* statistics, all triangle metrics from one position snapshot */
+            Mesh<bool, bool, bool, double>::TriQuality q;
+            M.getTriQuality(q, nthreads);
+
+            area            = q.area;
+            volume          = fabs(q.volume);
+            nvertices       = M.numVertices();
+            nfaces          = M.numFaces();
+            nedges          = M.numEdges();
+            chi             = nvertices - nedges + nfaces;
+            ar_avg          = q.ar_avg;
+            ar_sigma        = q.ar_sigma;
+            ar_max          = q.ar_max;
+            nobtuse_tris    = q.nobtuse;
+        }
 
         printf("Mesh: \"%s\"\n\n"\
                "nvertices:      %8d\n"\
@@ -47,13 +47,20 @@
 #include "common.hh"
 
 #include <stdarg.h>
+#include <random>
+#include <sstream>
+#include <unordered_map>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include "debug.hh"
 #include "Vec3.hh"
 #include "aux.hh"
 
 namespace Aux {
     namespace Timing {
-        struct timeval 
+        /* per-thread registers, since timed code may run on several meshing threads at once */
+        thread_local struct timeval 
             starttimes[TIMER_REGISTERS], 
             endtimes[TIMER_REGISTERS];
 
@@ -85,11 +92,34 @@ namespace Aux {
     }
 
     namespace Numbers {
+        /* per-thread random stream, see frandSetThreadStream() */
+        static thread_local bool            frand_thread_stream_set = false;
+        static thread_local std::mt19937    frand_thread_stream;
+
+        void
+        frandSetThreadStream(uint32_t seed)
+        {
+            frand_thread_stream.seed(seed);
+            frand_thread_stream_set = true;
+        }
+
+        void
+        frandUnsetThreadStream()
+        {
+            frand_thread_stream_set = false;
+        }
+
         /* random double */
         double
         frand(double min, double max)
         {
-            double f = (double)std::rand() / RAND_MAX;
+            double f;
+            if (frand_thread_stream_set) {
+                f = (double)(frand_thread_stream() - std::mt19937::min()) / (double)(std::mt19937::max() - std::mt19937::min());
+            }
+            else {
+                f = (double)std::rand() / RAND_MAX;
+            }
             return (min + f*(max - min));
         }
 
@@ -175,6 +205,1262 @@ namespace Aux {
                 return false;
             }
         }
+
+        size_t
+        formatUInt(
+            char       *buf,
+            uint32_t    x)
+        {
+            char    tmp[16];
+            size_t  len = 0;
+
+            do {
+                tmp[len++]  = '0' + (x % 10);
+                x          /= 10;
+            } while (x > 0);
+
+            for (size_t i = 0; i < len; i++) {
+                buf[i] = tmp[len - 1 - i];
+            }
+
+            return len;
+        }
+
+        /* the mantissa digits are obtained by scaling |x| with a power of ten in long double arithmetic and rounding to
+         * the nearest integer. whenever the scaled value is too close to a rounding tie to be sure about the correctly
+         * rounded result, and for exotic inputs, snprintf() is used instead. */
+        size_t
+        formatSci(
+            char       *buf,
+            double      x,
+            uint32_t    precision)
+        {
+            static const long double pow10[] = {
+                1E0L,  1E1L,  1E2L,  1E3L,  1E4L,  1E5L,  1E6L,  1E7L,  1E8L,  1E9L,
+                1E10L, 1E11L, 1E12L, 1E13L, 1E14L, 1E15L, 1E16L, 1E17L, 1E18L, 1E19L,
+                1E20L, 1E21L, 1E22L, 1E23L, 1E24L, 1E25L, 1E26L, 1E27L
+            };
+            int const max_pow = 27;
+
+            auto fallback = [&] () -> size_t
+            {
+                return snprintf(buf, 32, "%+.*e", (int)precision, x);
+            };
+
+            if (precision < 1 || precision > 17 || !std::isfinite(x)) {
+                return fallback();
+            }
+
+            double const    a   = std::fabs(x);
+            int             e   = 0;
+            uint64_t        m   = 0;
+
+            if (a != 0) {
+                long double const   m_min   = pow10[precision];
+                long double const   m_max   = pow10[precision + 1];
+                long double const   tol     = m_max * std::numeric_limits<long double>::epsilon() * 4;
+                long double         scaled;
+
+                /* scale a by 10^(precision - e), such that scaled lies in [m_min, m_max) */
+                auto scale = [&] (int k, long double &y) -> bool
+                {
+                    if (k > max_pow || k < -max_pow) {
+                        return false;
+                    }
+                    y = (k >= 0) ? (long double)a * pow10[k] : (long double)a / pow10[-k];
+                    return true;
+                };
+
+                e = (int)std::floor(std::log10(a));
+                if (!scale((int)precision - e, scaled)) {
+                    return fallback();
+                }
+                if (scaled >= m_max) {
+                    e++;
+                    if (!scale((int)precision - e, scaled)) {
+                        return fallback();
+                    }
+                }
+                else if (scaled < m_min) {
+                    e--;
+                    if (!scale((int)precision - e, scaled)) {
+                        return fallback();
+                    }
+                }
+
+                long double const fl    = std::floor(scaled);
+                long double const frac  = scaled - fl;
+                if (std::fabs(frac - 0.5L) <= tol || fl < m_min || fl >= m_max) {
+                    return fallback();
+                }
+
+                m = (uint64_t)fl + (frac > 0.5L ? 1 : 0);
+                if ((long double)m == m_max) {
+                    m = (uint64_t)m_min;
+                    e++;
+                }
+            }
+
+            /* sign, leading digit, decimal point, remaining precision digits */
+            char   *s = buf;
+            *s++ = std::signbit(x) ? '-' : '+';
+
+            char digits[20];
+            for (int i = precision; i >= 0; i--) {
+                digits[i]   = '0' + (m % 10);
+                m          /= 10;
+            }
+            *s++ = digits[0];
+            *s++ = '.';
+            for (uint32_t i = 1; i <= precision; i++) {
+                *s++ = digits[i];
+            }
+
+            /* exponent with at least two digits */
+            *s++ = 'e';
+            *s++ = (e < 0) ? '-' : '+';
+            uint32_t const ae = (e < 0) ? -e : e;
+            if (ae < 10) {
+                *s++ = '0';
+            }
+            s += formatUInt(s, ae);
+            *s = '\0';
+
+            return s - buf;
+        }
+
+        bool
+        copyReplacingLine(
+            FILE                                   *src,
+            FILE                                   *dst,
+            const char                             *delim,
+            std::function<void(FILE *)> const      &insert)
+        {
+            /* search for "\n<delim>\n" in blocks of src. an artificial newline is put in front of the data, so that a
+             * delimiter in the first line is found as well, the first skip characters of buf are not part of src. the
+             * last pattern length - 1 characters of every block are carried over to the next one, since the pattern
+             * might cross block boundaries. */
+            std::string const   pattern     = std::string("\n") + delim + "\n";
+            size_t const        block_len   = 1 << 22;
+            size_t const        carry_len   = pattern.size() - 1;
+            std::vector<char>   buf(1 + carry_len + block_len);
+            size_t              len         = 1;
+            size_t              skip        = 1;
+            bool                found       = false;
+
+            auto write = [&] (const char *p, size_t n) -> void
+            {
+                if (n > 0 && fwrite(p, 1, n, dst) != n) {
+                    throw("Aux::File::copyReplacingLine(): write error.");
+                }
+            };
+
+            rewind(src);
+            buf[0] = '\n';
+
+            while (true) {
+                size_t const nread = fread(buf.data() + len, 1, block_len, src);
+                len += nread;
+
+                if (found) {
+                    write(buf.data(), len);
+                    len = 0;
+                }
+                else {
+                    auto it = std::search(buf.begin(), buf.begin() + len, pattern.begin(), pattern.end());
+                    if (it != buf.begin() + len) {
+                        /* write everything up to and including the newline preceding the delimiter line, then the
+                         * inserted data, then everything after the delimiter line. */
+                        size_t const pos = it - buf.begin();
+                        write(buf.data() + skip, pos + 1 - skip);
+                        insert(dst);
+                        write(buf.data() + pos + pattern.size(), len - pos - pattern.size());
+
+                        found   = true;
+                        len     = 0;
+                        skip    = 0;
+                    }
+                    else {
+                        size_t const keep   = std::min(len, carry_len);
+                        size_t const n_out  = len - keep;
+
+                        if (n_out >= skip) {
+                            write(buf.data() + skip, n_out - skip);
+                            skip = 0;
+                        }
+                        else {
+                            skip -= n_out;
+                        }
+                        std::copy(buf.begin() + n_out, buf.begin() + len, buf.begin());
+                        len = keep;
+                    }
+                }
+
+                if (nread < block_len) {
+                    break;
+                }
+            }
+
+            if (!found) {
+                write(buf.data() + skip, len - skip);
+            }
+
+            return found;
+        }
+
+        MappedFile::MappedFile()
+        : ptr(NULL), len(0), mapped(false)
+        {}
+
+        MappedFile::~MappedFile()
+        {
+            this->close();
+        }
+
+        bool
+        MappedFile::open(const char *filename)
+        {
+            this->close();
+
+            int fd = ::open(filename, O_RDONLY);
+            if (fd < 0) {
+                return false;
+            }
+
+            struct stat st;
+            if (fstat(fd, &st) != 0) {
+                ::close(fd);
+                return false;
+            }
+
+            if (st.st_size > 0) {
+                void *p = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+                if (p != MAP_FAILED) {
+                    madvise(p, st.st_size, MADV_SEQUENTIAL);
+                    this->ptr       = (const char *)p;
+                    this->len       = st.st_size;
+                    this->mapped    = true;
+                    ::close(fd);
+                    return true;
+                }
+            }
+
+            /* fall back to reading the file */
+            char    block[1 << 16];
+            ssize_t n;
+            while ((n = ::read(fd, block, sizeof(block))) > 0) {
+                this->buf.insert(this->buf.end(), block, block + n);
+            }
+            ::close(fd);
+
+            if (n < 0) {
+                this->buf.clear();
+                return false;
+            }
+
+            this->ptr   = this->buf.data();
+            this->len   = this->buf.size();
+            return true;
+        }
+
+        void
+        MappedFile::close()
+        {
+            if (this->mapped) {
+                munmap((void *)this->ptr, this->len);
+            }
+            std::vector<char>().swap(this->buf);
+            this->ptr       = NULL;
+            this->len       = 0;
+            this->mapped    = false;
+        }
+
+        const char *
+        MappedFile::data() const
+        {
+            return this->ptr;
+        }
+
+        size_t
+        MappedFile::size() const
+        {
+            return this->len;
+        }
+
+        /* tokenizer for readObjFile(). all functions skip leading blanks and advance p past the parsed token. */
+        namespace {
+            inline void
+            skipBlanks(const char *&p, const char *end)
+            {
+                while (p < end && (*p == ' ' || *p == '\t' || *p == '\r')) {
+                    p++;
+                }
+            }
+
+            inline bool
+            parseUInt(const char *&p, const char *end, uint32_t &x)
+            {
+                uint64_t v = 0;
+                const char *q = p;
+
+                while (q < end && *q >= '0' && *q <= '9' && v <= UINT32_MAX) {
+                    v = 10 * v + (*q++ - '0');
+                }
+                if (q == p || v > UINT32_MAX) {
+                    return false;
+                }
+
+                x = v;
+                p = q;
+                return true;
+            }
+
+            /* decimal mantissas of up to 19 digits that are exactly representable and scaled by at most 10^22 are
+             * converted with a single correctly rounded floating point operation, which yields the same result as
+             * strtod(). everything else (long mantissas, large exponents, nan / inf) is passed on to strtod(). */
+            inline bool
+            parseDouble(const char *&p, const char *end, double &x)
+            {
+                static const double pow10[] = {
+                    1E0,  1E1,  1E2,  1E3,  1E4,  1E5,  1E6,  1E7,  1E8,  1E9,  1E10, 1E11,
+                    1E12, 1E13, 1E14, 1E15, 1E16, 1E17, 1E18, 1E19, 1E20, 1E21, 1E22
+                };
+
+                const char *q       = p;
+                bool        neg     = false;
+                uint64_t    m       = 0;
+                int         nsig    = 0, ndigits = 0, e10 = 0;
+                bool        exact   = true;
+
+                if (q < end && (*q == '+' || *q == '-')) {
+                    neg = (*q++ == '-');
+                }
+
+                for (bool frac = false; q < end; q++) {
+                    if (*q >= '0' && *q <= '9') {
+                        ndigits++;
+                        if (nsig < 19) {
+                            m = 10 * m + (*q - '0');
+                            if (m > 0) {
+                                nsig++;
+                            }
+                            if (frac) {
+                                e10--;
+                            }
+                        }
+                        else {
+                            exact = false;
+                        }
+                    }
+                    else if (*q == '.' && !frac) {
+                        frac = true;
+                    }
+                    else {
+                        break;
+                    }
+                }
+
+                if (ndigits > 0 && q < end && (*q == 'e' || *q == 'E')) {
+                    const char *r       = q + 1;
+                    bool        eneg    = false;
+                    int         ev      = 0;
+
+                    if (r < end && (*r == '+' || *r == '-')) {
+                        eneg = (*r++ == '-');
+                    }
+                    if (r < end && *r >= '0' && *r <= '9') {
+                        while (r < end && *r >= '0' && *r <= '9') {
+                            ev = std::min(10 * ev + (*r++ - '0'), 100000);
+                        }
+                        e10 += eneg ? -ev : ev;
+                        q    = r;
+                    }
+                }
+
+                if (ndigits > 0 && exact && m <= (1ull << 53) && e10 >= -22 && e10 <= 22) {
+                    x = (e10 < 0) ? (double)m / pow10[-e10] : (double)m * pow10[e10];
+                    x = neg ? -x : x;
+                    p = q;
+                    return true;
+                }
+
+                /* general case: strtod() on a zero-terminated copy of the token */
+                const char *t = p;
+                while (t < end && *t != ' ' && *t != '\t' && *t != '\r' && *t != '\n') {
+                    t++;
+                }
+                std::string token(p, t);
+                char       *tend;
+
+                x = strtod(token.c_str(), &tend);
+                if (tend == token.c_str()) {
+                    return false;
+                }
+                p += (tend - token.c_str());
+                return true;
+            }
+
+            inline bool
+            lineStartsWith(const char *p, const char *end, const char *key)
+            {
+                for (; *key; key++, p++) {
+                    if (p >= end || *p != *key) {
+                        return false;
+                    }
+                }
+                return true;
+            }
+
+            inline bool
+            isBlank(const char *p, const char *end)
+            {
+                return (p >= end || *p == ' ' || *p == '\t' || *p == '\r');
+            }
+
+            enum ObjLineType {
+                OBJ_LINE_SKIP,
+                OBJ_LINE_VERTEX,
+                OBJ_LINE_NORMAL,
+                OBJ_LINE_FACE,
+                OBJ_LINE_UNKNOWN
+            };
+
+            /* classify the line starting at p (after leading blanks), return position after the keyword */
+            inline ObjLineType
+            classifyObjLine(const char *&p, const char *end)
+            {
+                skipBlanks(p, end);
+                if (p >= end || *p == '#' || *p == 'o') {
+                    return OBJ_LINE_SKIP;
+                }
+                else if (*p == 'v') {
+                    if (isBlank(p + 1, end)) {
+                        p += 1;
+                        return OBJ_LINE_VERTEX;
+                    }
+                    else if (p + 1 < end && p[1] == 'n' && isBlank(p + 2, end)) {
+                        p += 2;
+                        return OBJ_LINE_NORMAL;
+                    }
+                    else if (p + 1 < end && p[1] == 't') {
+                        return OBJ_LINE_SKIP;
+                    }
+                }
+                else if (*p == 'f' && isBlank(p + 1, end)) {
+                    p += 1;
+                    return OBJ_LINE_FACE;
+                }
+
+                return OBJ_LINE_UNKNOWN;
+            }
+
+            /* parse the three coordinates of a vertex / normal line after the keyword */
+            inline bool
+            parseObjTriple(const char *&p, const char *end, std::array<double, 3> &x)
+            {
+                bool ok = true;
+                for (uint32_t i = 0; i < 3 && ok; i++) {
+                    skipBlanks(p, end);
+                    ok = parseDouble(p, end, x[i]);
+                }
+                return ok;
+            }
+
+            /* parse the vertex indices of a face line after the keyword into 0-based f, f[3] = UINT32_MAX for
+             * triangles */
+            inline bool
+            parseObjFace(const char *&p, const char *end, std::array<uint32_t, 4> &f)
+            {
+                bool        ok  = true;
+                uint32_t    n   = 0;
+
+                f[3] = UINT32_MAX;
+                while (ok) {
+                    skipBlanks(p, end);
+                    if (p >= end) {
+                        break;
+                    }
+
+                    /* vertex index, optionally followed by /texture and /normal indices */
+                    uint32_t v, dummy;
+                    ok = (n < 4) && parseUInt(p, end, v) && v > 0;
+                    if (ok) {
+                        f[n++] = v - 1;
+                        for (uint32_t i = 0; i < 2 && p < end && *p == '/'; i++) {
+                            p++;
+                            parseUInt(p, end, dummy);
+                        }
+                        ok = isBlank(p, end);
+                    }
+                }
+                return ok && (n >= 3);
+            }
+
+            /* chunks of at least 1 MiB of a mapped file, aligned to line starts, for up to nthreads threads */
+            std::vector<const char *>
+            splitIntoLineChunks(const char *begin, const char *end, uint32_t nthreads)
+            {
+                size_t const    size        = end - begin;
+                size_t const    min_chunk   = 1 << 20;
+                uint32_t const  nchunks     = std::max<size_t>(1, std::min<size_t>(std::max(nthreads, 1u), size / min_chunk));
+
+                std::vector<const char *> bounds(nchunks + 1, end);
+                bounds[0] = begin;
+                for (uint32_t k = 1; k < nchunks; k++) {
+                    const char *q = std::max(begin + (size * k) / nchunks, bounds[k - 1]);
+                    q = (const char *)memchr(q, '\n', end - q);
+                    bounds[k] = q ? q + 1 : end;
+                }
+                return bounds;
+            }
+
+            /* chunks of about chunk_len bytes of a mapped file, aligned to line starts. the split depends only on the
+             * file, not on the number of threads processing it. */
+            std::vector<const char *>
+            splitIntoFixedLineChunks(const char *begin, const char *end, size_t chunk_len)
+            {
+                std::vector<const char *> bounds(1, begin);
+                while (bounds.back() < end) {
+                    const char *q = bounds.back() + std::min<size_t>(chunk_len, end - bounds.back());
+                    q = (q < end) ? (const char *)memchr(q, '\n', end - q) : NULL;
+                    bounds.push_back(q ? q + 1 : end);
+                }
+                if (bounds.size() == 1) {
+                    bounds.push_back(end);
+                }
+                return bounds;
+            }
+
+            /* run f(k) for all chunks k on up to nthreads threads, each of which takes the next unprocessed chunk */
+            void
+            runOnChunks(uint32_t nchunks, uint32_t nthreads, std::function<void(uint32_t)> const &f)
+            {
+                std::atomic<uint32_t>       next(0);
+                std::vector<std::thread>    threads;
+
+                auto worker = [&] () -> void
+                    {
+                        for (uint32_t k; (k = next.fetch_add(1)) < nchunks; ) {
+                            f(k);
+                        }
+                    };
+
+                for (uint32_t t = 1; t < std::min(std::max(nthreads, 1u), nchunks); t++) {
+                    try {
+                        threads.push_back(std::thread(worker));
+                    }
+                    catch (std::system_error &ex) {
+                        break;
+                    }
+                }
+                worker();
+                for (auto &t : threads) {
+                    t.join();
+                }
+            }
+
+            /* run f(k) for all chunks k on their own threads */
+            void
+            runOnChunks(uint32_t nchunks, std::function<void(uint32_t)> const &f)
+            {
+                std::vector<std::thread> threads;
+                for (uint32_t k = 1; k < nchunks; k++) {
+                    try {
+                        threads.push_back(std::thread(f, k));
+                    }
+                    catch (std::system_error &ex) {
+                        f(k);
+                    }
+                }
+                f(0);
+                for (auto &t : threads) {
+                    t.join();
+                }
+            }
+
+            inline const char *
+            objLineEnd(const char *p, const char *end)
+            {
+                const char *q = (const char *)memchr(p, '\n', end - p);
+                return q ? q : end;
+            }
+        }
+
+        bool
+        readObjFile(
+            const char     *filename,
+            ObjData        &data,
+            uint32_t        nthreads)
+        {
+            MappedFile mf;
+            if (!mf.open(filename)) {
+                return false;
+            }
+
+            const char * const          end     = mf.data() + mf.size();
+            std::vector<const char *>   bounds  = splitIntoLineChunks(mf.data(), end, nthreads);
+            uint32_t const              nchunks = bounds.size() - 1;
+
+            struct ChunkInfo {
+                size_t          nv, nn, nf;
+                bool            error;
+                std::string     error_line;
+            };
+            std::vector<ChunkInfo> chunks(nchunks, { 0, 0, 0, false, "" });
+
+            /* first pass: count */
+            runOnChunks(nchunks, [&] (uint32_t k) -> void
+                {
+                    ChunkInfo &c = chunks[k];
+                    for (const char *p = bounds[k]; p < bounds[k + 1]; ) {
+                        const char *le = objLineEnd(p, end);
+                        switch (classifyObjLine(p, le)) {
+                            case OBJ_LINE_VERTEX:   c.nv++; break;
+                            case OBJ_LINE_NORMAL:   c.nn++; break;
+                            case OBJ_LINE_FACE:     c.nf++; break;
+                            default:                break;
+                        }
+                        p = le + 1;
+                    }
+                });
+
+            size_t nv = 0, nn = 0, nf = 0;
+            std::vector<size_t> v_off(nchunks), n_off(nchunks), f_off(nchunks);
+            for (uint32_t k = 0; k < nchunks; k++) {
+                v_off[k] = nv, n_off[k] = nn, f_off[k] = nf;
+                nv += chunks[k].nv, nn += chunks[k].nn, nf += chunks[k].nf;
+            }
+
+            data.vertices.resize(nv);
+            data.normals.resize(nn);
+            data.faces.resize(nf);
+
+            /* second pass: parse every chunk into its ranges. the first error of every chunk is recorded and the one
+             * occurring first in the file is reported below. */
+            runOnChunks(nchunks, [&] (uint32_t k) -> void
+                {
+                    ChunkInfo  &c   = chunks[k];
+                    size_t      iv  = v_off[k], in = n_off[k], jf = f_off[k];
+
+                    for (const char *p = bounds[k]; p < bounds[k + 1] && !c.error; ) {
+                        const char *const   ls  = p;
+                        const char *const   le  = objLineEnd(p, end);
+                        bool                ok  = true;
+
+                        switch (classifyObjLine(p, le)) {
+                            case OBJ_LINE_SKIP:     break;
+                            case OBJ_LINE_VERTEX:   ok = parseObjTriple(p, le, data.vertices[iv++]); break;
+                            case OBJ_LINE_NORMAL:   ok = parseObjTriple(p, le, data.normals[in++]); break;
+                            case OBJ_LINE_FACE:     ok = parseObjFace(p, le, data.faces[jf++]); break;
+                            default:                ok = false; break;
+                        }
+
+                        if (!ok) {
+                            c.error         = true;
+                            c.error_line    = std::string(ls, le);
+                        }
+                        p = le + 1;
+                    }
+                });
+
+            for (auto &c : chunks) {
+                if (c.error) {
+                    printf("Aux::File::readObjFile(): unrecognized line: \"%s\".\n", c.error_line.c_str());
+                    throw("Aux::File::readObjFile(): unrecognized line.");
+                }
+            }
+
+            return true;
+        }
+
+        bool
+        streamObjFile(
+            const char                                                         *filename,
+            std::vector<std::array<double, 3>>                                 &vertices,
+            std::function<void(size_t, uint32_t)> const                        &begin,
+            std::function<void(uint32_t, std::array<uint32_t, 4> const &)> const &face,
+            uint32_t                                                            nthreads)
+        {
+            MappedFile mf;
+            if (!mf.open(filename)) {
+                return false;
+            }
+
+            const char * const          end     = mf.data() + mf.size();
+            std::vector<const char *>   bounds  = splitIntoFixedLineChunks(mf.data(), end, 1 << 20);
+            uint32_t const              nchunks = bounds.size() - 1;
+
+            struct ChunkInfo {
+                size_t          nv, nf;
+                bool            error;
+                std::string     error_line;
+            };
+            std::vector<ChunkInfo> chunks(nchunks, { 0, 0, false, "" });
+
+            /* first pass: count vertices and faces */
+            runOnChunks(nchunks, nthreads, [&] (uint32_t k) -> void
+                {
+                    ChunkInfo &c = chunks[k];
+                    for (const char *p = bounds[k]; p < bounds[k + 1]; ) {
+                        const char *le = objLineEnd(p, end);
+                        switch (classifyObjLine(p, le)) {
+                            case OBJ_LINE_VERTEX:   c.nv++; break;
+                            case OBJ_LINE_FACE:     c.nf++; break;
+                            default:                break;
+                        }
+                        p = le + 1;
+                    }
+                });
+
+            size_t nv = 0, nfaces = 0;
+            std::vector<size_t> v_off(nchunks);
+            for (uint32_t k = 0; k < nchunks; k++) {
+                v_off[k]    = nv;
+                nv         += chunks[k].nv;
+                nfaces     += chunks[k].nf;
+            }
+            vertices.resize(nv);
+
+            /* second pass: parse vertices, third pass: parse faces and pass them on. all other lines are checked in
+             * the second pass, face lines in the third. */
+            for (uint32_t pass = 0; pass < 2; pass++) {
+                if (pass == 1) {
+                    begin(nfaces, nchunks);
+                }
+
+                runOnChunks(nchunks, nthreads, [&] (uint32_t k) -> void
+                    {
+                        ChunkInfo  &c   = chunks[k];
+                        size_t      iv  = v_off[k];
+
+                        for (const char *p = bounds[k]; p < bounds[k + 1] && !c.error; ) {
+                            const char *const       ls  = p;
+                            const char *const       le  = objLineEnd(p, end);
+                            bool                    ok  = true;
+                            std::array<double, 3>   x;
+                            std::array<uint32_t, 4> f;
+
+                            switch (classifyObjLine(p, le)) {
+                                case OBJ_LINE_SKIP:
+                                    break;
+                                case OBJ_LINE_VERTEX:
+                                    if (pass == 0) {
+                                        ok = parseObjTriple(p, le, vertices[iv++]);
+                                    }
+                                    break;
+                                case OBJ_LINE_NORMAL:
+                                    if (pass == 0) {
+                                        ok = parseObjTriple(p, le, x);
+                                    }
+                                    break;
+                                case OBJ_LINE_FACE:
+                                    if (pass == 1) {
+                                        ok = parseObjFace(p, le, f);
+                                        for (uint32_t i = 0; i < 4 && ok; i++) {
+                                            ok = (f[i] < nv || (i == 3 && f[i] == UINT32_MAX));
+                                        }
+                                        if (ok) {
+                                            face(k, f);
+                                        }
+                                    }
+                                    break;
+                                default:
+                                    ok = false;
+                                    break;
+                            }
+
+                            if (!ok) {
+                                c.error         = true;
+                                c.error_line    = std::string(ls, le);
+                            }
+                            p = le + 1;
+                        }
+                    });
+
+                for (auto &c : chunks) {
+                    if (c.error) {
+                        printf("Aux::File::streamObjFile(): unrecognized line: \"%s\".\n", c.error_line.c_str());
+                        throw("Aux::File::streamObjFile(): unrecognized line or vertex index out of range.");
+                    }
+                }
+            }
+
+            return true;
+        }
+
+        void
+        writePlyHeader(
+            FILE       *f,
+            uint32_t    nvertices,
+            uint32_t    nfaces)
+        {
+            char    header[plyHeaderLength + 1];
+            int     len = snprintf(header, sizeof(header),
+                            "ply\n"
+                            "format binary_little_endian 1.0\n"
+                            "comment generated by AnaMorph\n"
+                            "element vertex %u\n"
+                            "property double x\n"
+                            "property double y\n"
+                            "property double z\n"
+                            "element face %u\n"
+                            "property list uchar int vertex_indices\n",
+                            nvertices, nfaces);
+
+            /* pad to the fixed header length with a comment line */
+            char const  end[] = "end_header\n";
+            size_t      npad  = plyHeaderLength - len - (sizeof(end) - 1);
+
+            memcpy(header + len, "comment", 7);
+            memset(header + len + 7, ' ', npad - 8);
+            header[len + npad - 1] = '\n';
+            memcpy(header + len + npad, end, sizeof(end) - 1);
+
+            if (fwrite(header, 1, plyHeaderLength, f) != plyHeaderLength) {
+                throw("Aux::File::writePlyHeader(): write error.");
+            }
+        }
+
+        void
+        writeStlHeader(
+            FILE       *f,
+            uint32_t    ntriangles)
+        {
+            /* the text header must not start with "solid", which would mark an ascii stl file for many readers */
+            char header[stlHeaderLength];
+
+            memset(header, ' ', 80);
+            memcpy(header, "binary stl generated by AnaMorph", 32);
+            putLE<uint32_t>(header + 80, ntriangles);
+
+            if (fwrite(header, 1, stlHeaderLength, f) != stlHeaderLength) {
+                throw("Aux::File::writeStlHeader(): write error.");
+            }
+        }
+
+        size_t
+        formatPlyVertex(
+            char   *buf,
+            double  x,
+            double  y,
+            double  z)
+        {
+            putLE<double>(buf, x);
+            putLE<double>(buf + 8, y);
+            putLE<double>(buf + 16, z);
+
+            return 24;
+        }
+
+        size_t
+        formatPlyFace(
+            char                           *buf,
+            std::array<uint32_t, 4> const  &ids)
+        {
+            uint8_t const   nids    = (ids[3] == UINT32_MAX) ? 3 : 4;
+            char           *s       = buf;
+
+            s += putLE<uint8_t>(s, nids);
+            for (uint32_t k = 0; k < nids; k++) {
+                s += putLE<int32_t>(s, ids[k]);
+            }
+
+            return (s - buf);
+        }
+
+        /* helpers for readPlyFile() */
+        namespace {
+            /* size of a ply scalar type or zero if unknown */
+            size_t
+            plyTypeSize(std::string const &t)
+            {
+                if (t == "char" || t == "uchar" || t == "int8" || t == "uint8") {
+                    return 1;
+                }
+                else if (t == "short" || t == "ushort" || t == "int16" || t == "uint16") {
+                    return 2;
+                }
+                else if (t == "int" || t == "uint" || t == "float" || t == "int32" || t == "uint32" || t == "float32") {
+                    return 4;
+                }
+                else if (t == "double" || t == "float64") {
+                    return 8;
+                }
+                else {
+                    return 0;
+                }
+            }
+
+            /* read a little endian ply scalar of type t as double, which is exact for all ply types */
+            double
+            plyGetScalar(const char *p, std::string const &t)
+            {
+                if (t == "char" || t == "int8")         return getLE<int8_t>(p);
+                if (t == "uchar" || t == "uint8")       return getLE<uint8_t>(p);
+                if (t == "short" || t == "int16")       return getLE<int16_t>(p);
+                if (t == "ushort" || t == "uint16")     return getLE<uint16_t>(p);
+                if (t == "int" || t == "int32")         return getLE<int32_t>(p);
+                if (t == "uint" || t == "uint32")       return getLE<uint32_t>(p);
+                if (t == "float" || t == "float32")     return getLE<float>(p);
+                return getLE<double>(p);
+            }
+
+            struct PlyProperty {
+                std::string     name;
+                std::string     type;
+                std::string     count_type;
+                bool            list;
+            };
+
+            struct PlyElement {
+                std::string                 name;
+                size_t                      count;
+                std::vector<PlyProperty>    properties;
+            };
+        }
+
+        bool
+        readPlyFile(
+            const char     *filename,
+            ObjData        &data)
+        {
+            data = ObjData();
+
+            MappedFile file;
+            if (!file.open(filename)) {
+                return false;
+            }
+
+            const char         *p   = file.data();
+            const char * const  end = p + file.size();
+
+            /* parse header line by line */
+            std::vector<PlyElement> elements;
+            bool                    header_done = false;
+            bool                    first_line  = true;
+
+            while (p < end && !header_done) {
+                const char *le = (const char *)memchr(p, '\n', end - p);
+                if (!le) {
+                    throw("Aux::File::readPlyFile(): incomplete ply header.");
+                }
+
+                std::istringstream  line(std::string(p, le));
+                std::string         keyword;
+                line >> keyword;
+                p = le + 1;
+
+                if (first_line) {
+                    if (keyword != "ply") {
+                        throw("Aux::File::readPlyFile(): not a ply file.");
+                    }
+                    first_line = false;
+                }
+                else if (keyword == "format") {
+                    std::string format;
+                    line >> format;
+                    if (format != "binary_little_endian") {
+                        throw("Aux::File::readPlyFile(): only binary_little_endian ply files are supported.");
+                    }
+                }
+                else if (keyword == "element") {
+                    PlyElement e;
+                    if (!(line >> e.name >> e.count)) {
+                        throw("Aux::File::readPlyFile(): invalid element line in ply header.");
+                    }
+                    elements.push_back(e);
+                }
+                else if (keyword == "property") {
+                    PlyProperty prop;
+                    std::string type;
+
+                    line >> type;
+                    prop.list = (type == "list");
+                    if (prop.list) {
+                        line >> prop.count_type >> prop.type >> prop.name;
+                    }
+                    else {
+                        prop.type = type;
+                        line >> prop.name;
+                    }
+
+                    if (    elements.empty() || plyTypeSize(prop.type) == 0 ||
+                            (prop.list && plyTypeSize(prop.count_type) == 0) )
+                    {
+                        throw("Aux::File::readPlyFile(): invalid property line in ply header.");
+                    }
+                    elements.back().properties.push_back(prop);
+                }
+                else if (keyword == "end_header") {
+                    header_done = true;
+                }
+                else if (keyword != "comment" && keyword != "obj_info" && !keyword.empty()) {
+                    throw("Aux::File::readPlyFile(): unrecognized line in ply header.");
+                }
+            }
+
+            if (!header_done) {
+                throw("Aux::File::readPlyFile(): incomplete ply header.");
+            }
+
+            /* parse body element by element */
+            auto need = [&] (size_t n) -> void
+            {
+                if ((size_t)(end - p) < n) {
+                    throw("Aux::File::readPlyFile(): unexpected end of file.");
+                }
+            };
+
+            for (auto &e : elements) {
+                bool const is_vertex  = (e.name == "vertex");
+                bool const is_face    = (e.name == "face");
+
+                if (is_vertex) {
+                    data.vertices.resize(e.count);
+                }
+                else if (is_face) {
+                    data.faces.reserve(e.count);
+                }
+
+                for (size_t i = 0; i < e.count; i++) {
+                    for (auto &prop : e.properties) {
+                        if (!prop.list) {
+                            size_t const sz = plyTypeSize(prop.type);
+                            need(sz);
+                            if (is_vertex && prop.name.size() == 1 && prop.name[0] >= 'x' && prop.name[0] <= 'z') {
+                                data.vertices[i][prop.name[0] - 'x'] = plyGetScalar(p, prop.type);
+                            }
+                            p += sz;
+                        }
+                        else {
+                            size_t const csz = plyTypeSize(prop.count_type);
+                            size_t const sz  = plyTypeSize(prop.type);
+
+                            need(csz);
+                            size_t const n = (size_t)plyGetScalar(p, prop.count_type);
+                            p += csz;
+                            need(n * sz);
+
+                            if (is_face && (prop.name == "vertex_indices" || prop.name == "vertex_index")) {
+                                if (n != 3 && n != 4) {
+                                    throw("Aux::File::readPlyFile(): face is neither triangle nor quad.");
+                                }
+
+                                std::array<uint32_t, 4> f = {{ 0, 0, 0, UINT32_MAX }};
+                                for (size_t k = 0; k < n; k++) {
+                                    double const id = plyGetScalar(p + k * sz, prop.type);
+                                    if (id < 0 || id >= data.vertices.size()) {
+                                        throw("Aux::File::readPlyFile(): face vertex index out of range.");
+                                    }
+                                    f[k] = (uint32_t)id;
+                                }
+                                data.faces.push_back(f);
+                            }
+                            p += n * sz;
+                        }
+                    }
+                }
+            }
+
+            return true;
+        }
+
+        bool
+        readStlFile(
+            const char     *filename,
+            ObjData        &data)
+        {
+            data = ObjData();
+
+            MappedFile file;
+            if (!file.open(filename)) {
+                return false;
+            }
+
+            if (file.size() < stlHeaderLength) {
+                throw("Aux::File::readStlFile(): file too short for a binary stl file.");
+            }
+
+            const char     *p   = file.data();
+            uint32_t const  n   = getLE<uint32_t>(p + 80);
+
+            if (file.size() != stlHeaderLength + (size_t)n * stlTriangleLength) {
+                throw("Aux::File::readStlFile(): file size doesn't match triangle count. not a binary stl file?");
+            }
+            p += stlHeaderLength;
+
+            /* identify vertices by the bit patterns of their coordinates */
+            struct KeyHash {
+                size_t
+                operator()(std::array<uint32_t, 3> const &k) const
+                {
+                    return (k[0] * 73856093u) ^ (k[1] * 19349663u) ^ (k[2] * 83492791u);
+                }
+            };
+            std::unordered_map<std::array<uint32_t, 3>, uint32_t, KeyHash> ids;
+
+            data.faces.reserve(n);
+            for (uint32_t i = 0; i < n; i++, p += stlTriangleLength) {
+                std::array<uint32_t, 4> f = {{ 0, 0, 0, UINT32_MAX }};
+
+                for (uint32_t k = 0; k < 3; k++) {
+                    std::array<uint32_t, 3> key;
+                    for (uint32_t j = 0; j < 3; j++) {
+                        /* adding zero maps -0 to +0 */
+                        float const x = getLE<float>(p + 12 * (k + 1) + 4 * j) + 0.0f;
+                        memcpy(&key[j], &x, 4);
+                    }
+
+                    auto ins = ids.insert({ key, (uint32_t)data.vertices.size() });
+                    if (ins.second) {
+                        std::array<double, 3> v;
+                        for (uint32_t j = 0; j < 3; j++) {
+                            float x;
+                            memcpy(&x, &key[j], 4);
+                            v[j] = x;
+                        }
+                        data.vertices.push_back(v);
+                    }
+                    f[k] = ins.first->second;
+                }
+
+                if (f[0] != f[1] && f[1] != f[2] && f[0] != f[2]) {
+                    data.faces.push_back(f);
+                }
+            }
+
+            return true;
+        }
+
+        bool
+        writeIndexFile(
+            const char                     *filename,
+            std::vector<uint32_t> const    &indices)
+        {
+            FILE *f = fopen(filename, "w");
+            if (!f) {
+                return false;
+            }
+
+            try {
+                writeLines(f, indices.size(), 32,
+                    [&] (size_t i, char *buf) -> size_t
+                    {
+                        size_t const len = formatUInt(buf, indices[i]);
+                        buf[len] = '\n';
+                        return len + 1;
+                    });
+            }
+            catch (...) {
+                fclose(f);
+                throw;
+            }
+            fclose(f);
+
+            return true;
+        }
+
+        bool
+        readIndexFile(
+            const char                     *filename,
+            std::vector<uint32_t>          &indices)
+        {
+            indices.clear();
+
+            MappedFile file;
+            if (!file.open(filename)) {
+                return false;
+            }
+
+            const char         *p   = file.data();
+            const char * const  end = p + file.size();
+            while (p < end) {
+                if (*p == '\n' || *p == '\r') {
+                    ++p;
+                    continue;
+                }
+
+                uint64_t    x       = 0;
+                const char *first   = p;
+                while (p < end && *p >= '0' && *p <= '9') {
+                    x = 10 * x + (*p++ - '0');
+                    if (x > UINT32_MAX) {
+                        throw("Aux::File::readIndexFile(): index out of range.");
+                    }
+                }
+                if (p == first || (p < end && *p != '\n' && *p != '\r')) {
+                    throw("Aux::File::readIndexFile(): malformed line.");
+                }
+                indices.push_back((uint32_t)x);
+            }
+
+            return true;
+        }
+
+        bool
+        readSWCFile(
+            const char                     *filename,
+            std::vector<SWCRecord>         &records)
+        {
+            records.clear();
+
+            MappedFile file;
+            if (!file.open(filename)) {
+                return false;
+            }
+
+            const char         *p   = file.data();
+            const char * const  end = p + file.size();
+
+            /* rough estimate from the file size to avoid most reallocations: records are rarely shorter than 32 bytes */
+            records.reserve(file.size() / 32 + 1);
+
+            while (p < end) {
+                skipBlanks(p, end);
+                if (p < end && *p != '\n' && *p != '#') {
+                    SWCRecord   rec;
+                    uint32_t    parent;
+                    bool        ok  = true;
+
+                    ok = ok && parseUInt(p, end, rec.id)    && isBlank(p, end);
+                    skipBlanks(p, end);
+                    ok = ok && parseUInt(p, end, rec.type)  && isBlank(p, end);
+                    skipBlanks(p, end);
+                    ok = ok && parseDouble(p, end, rec.x)   && isBlank(p, end);
+                    skipBlanks(p, end);
+                    ok = ok && parseDouble(p, end, rec.y)   && isBlank(p, end);
+                    skipBlanks(p, end);
+                    ok = ok && parseDouble(p, end, rec.z)   && isBlank(p, end);
+                    skipBlanks(p, end);
+                    ok = ok && parseDouble(p, end, rec.r)   && isBlank(p, end);
+                    skipBlanks(p, end);
+
+                    /* parent id: -1 for roots, otherwise a compartment id */
+                    if (ok && p < end && *p == '-') {
+                        ++p;
+                        ok = parseUInt(p, end, parent) && parent == 1;
+                        rec.parent_id = -1;
+                    }
+                    else {
+                        ok = ok && parseUInt(p, end, parent) && parent <= INT32_MAX;
+                        rec.parent_id = parent;
+                    }
+
+                    if (!ok || !(isBlank(p, end) || *p == '\n')) {
+                        throw("Aux::File::readSWCFile(): line is not a comment, yet necessary information could not be matched. syntax error.");
+                    }
+                    records.push_back(rec);
+                }
+
+                /* skip the remainder of the line */
+                while (p < end && *p != '\n') {
+                    ++p;
+                }
+                ++p;
+            }
+
+            return true;
+        }
     }
 
     namespace Geometry {
@@ -250,32 +250,18 @@ CanalSurface<C2F, RadF, R>::setRadiusFunctor(RadF const &radius_functor)
 }
 
 template <typename C2F, typename RadF, typename R>
-template <typename Tm, typename Tv, typename Tf>
 void
-CanalSurface<C2F, RadF, R>::generateMesh(
-    Mesh<Tm, Tv, Tf, R>                                    &M,
+CanalSurface<C2F, RadF, R>::computeMeshFrames(
     uint32_t                                                n_phi_segments,
     R                                                       triangle_height_factor,
     Vec3<R>                                                 rvec,
-    R const                                                &phi_0,
     R const                                                &arclen_dt,
-    bool                                                    start_circle_offset,
-    std::vector<
-            typename Mesh<Tm, Tv, Tf, R>::vertex_iterator
-        >                                                  *start_circle_its,
-    bool                                                   *end_circle_offset,
-    std::vector<
-            typename Mesh<Tm, Tv, Tf, R>::vertex_iterator
-        >                                                  *end_circle_its,
-    typename Mesh<Tm, Tv, Tf, R>::vertex_iterator          *closing_vertex_it,
-	bool                                                    preserve_crease_edges) const
+    bool                                                    preserve_crease_edges,
+    CanalSurfaceMeshFrames<R>                              &frames) const
 {
-    debugl(1, "CanalSurface::generateMesh().\n");
-    debugTabInc();
-
-    uint32_t    i, j, ntsegments;
-    R           t, r, phi, dphi, phi_offset;
-    Vec3<R>     c, p, n, last_p, a, px, py, pz, vpos;
+    uint32_t    i, ntsegments;
+    R           t, r, dphi;
+    Vec3<R>     px;
 
     dphi = Common::twopi / (R)n_phi_segments;
 
@@ -338,6 +324,69 @@ CanalSurface<C2F, RadF, R>::generateMesh(
     /* append t1 to finish the list */
     t_values.push_back(this->t1);
 
+    /* sample center, radius and render frame for all ntsegments + 1 circles. the frenet frame is available to
+     * demonstrate its disadvantageous nature for meshing, which is due to strong spinning of the frenet trihedron,
+     * which is quite bad for discretization, since quads get twisted then.. */
+    frames.n_phi_segments           = n_phi_segments;
+    frames.triangle_height_factor   = triangle_height_factor;
+    frames.rvec                     = rvec;
+    frames.arclen_dt                = arclen_dt;
+    frames.preserve_crease_edges    = preserve_crease_edges;
+
+    frames.p.resize(ntsegments + 1);
+    frames.py.resize(ntsegments + 1);
+    frames.pz.resize(ntsegments + 1);
+    frames.r.resize(ntsegments + 1);
+
+    for (i = 0; i <= ntsegments; i++) {
+        frames.p[i] = this->spineCurveEval(t_values[i]);
+        frames.r[i] = this->radiusEval(t_values[i]);
+        this->spineCurveGetRenderFrame(t_values[i], rvec, px, frames.py[i], frames.pz[i]);
+        //this->spineCurveGetFrenetFrame(t_values[i], px, frames.py[i], frames.pz[i]);
+    }
+}
+
+template <typename C2F, typename RadF, typename R>
+template <typename Tm, typename Tv, typename Tf>
+void
+CanalSurface<C2F, RadF, R>::generateMesh(
+    Mesh<Tm, Tv, Tf, R>                                    &M,
+    uint32_t                                                n_phi_segments,
+    R                                                       triangle_height_factor,
+    Vec3<R>                                                 rvec,
+    R const                                                &phi_0,
+    R const                                                &arclen_dt,
+    bool                                                    start_circle_offset,
+    std::vector<
+            typename Mesh<Tm, Tv, Tf, R>::vertex_iterator
+        >                                                  *start_circle_its,
+    bool                                                   *end_circle_offset,
+    std::vector<
+            typename Mesh<Tm, Tv, Tf, R>::vertex_iterator
+        >                                                  *end_circle_its,
+    typename Mesh<Tm, Tv, Tf, R>::vertex_iterator          *closing_vertex_it,
+	bool                                                    preserve_crease_edges,
+    CanalSurfaceMeshFrames<R> const                        *frames) const
+{
+    debugl(1, "CanalSurface::generateMesh().\n");
+    debugTabInc();
+
+    uint32_t    i, j, ntsegments;
+    R           r, phi, dphi, phi_offset;
+    Vec3<R>     p, py, pz, vpos;
+
+    dphi = Common::twopi / (R)n_phi_segments;
+
+    /* use precomputed spine curve samples if supplied by the caller, otherwise compute them now */
+    CanalSurfaceMeshFrames<R> local_frames;
+    if (!frames || !frames->matches(n_phi_segments, triangle_height_factor, rvec, arclen_dt, preserve_crease_edges)) {
+        this->computeMeshFrames(n_phi_segments, triangle_height_factor, rvec, arclen_dt, preserve_crease_edges, local_frames);
+        frames = &local_frames;
+    }
+
+    /* we got ntsegments + 1 circles with indices 0..ntsegments in total. */
+    ntsegments = frames->p.size() - 1;
+
     /* vectors storing vertices of current and last circle */
     std::vector<typename Mesh<Tm, Tv, Tf, R>::vertex_iterator>  last_circle;
     std::vector<typename Mesh<Tm, Tv, Tf, R>::vertex_iterator>  current_circle;
@@ -348,17 +397,11 @@ CanalSurface<C2F, RadF, R>::generateMesh(
 
     /* if start_circle_its == NULL, generate initial circle and close it with triangles */
     if (start_circle_its == NULL) {
-        /* get starting point and radius */
-        p   = this->spineCurveEval(this->t0);
-        r   = this->radiusEval(this->t0);
-
-        /* get curve base for t0 */
-        this->spineCurveGetRenderFrame(this->t0, rvec, px, py, pz);
-
-        /* frenet base is available to demonstrate its disadvantageous nature for meshing, which is due
-         * to strong spinning of the frenet trihedron, which is quite bad for discretization, since
-         * quads get twisted then.. */
-        //this->getFrenetFrame(this->t0, px, py, pz);
+        /* get starting point, radius and curve base for t0 */
+        p   = frames->p[0];
+        r   = frames->r[0];
+        py  = frames->py[0];
+        pz  = frames->pz[0];
 
         debugl(1, "start_circle_its == NULL => generating initial circle.\n"); 
 
@@ -420,19 +463,14 @@ CanalSurface<C2F, RadF, R>::generateMesh(
                 phi_offset = phi_0 + dphi / 2.0;
         }
 
-        //t = (R)i / (R)ntsegments;
-        t = t_values[i];
-
-        /* shift current_circle to last_circle. same for p and last_p */
+        /* shift current_circle to last_circle */
         last_circle = current_circle;
-        last_p      = p;
-
-        /* calculate new current point and radius */
-        p           = this->spineCurveEval(t);
-        r           = this->radiusEval(t);
 
-        this->spineCurveGetRenderFrame(t, rvec, px, py, pz);
-        //this->spineCurveGetFrenetFrame(t, px, py, pz);
+        /* get new current point, radius and render frame */
+        p           = frames->p[i];
+        r           = frames->r[i];
+        py          = frames->py[i];
+        pz          = frames->pz[i];
 
         /* generate current circle vertices and save iterators */
         for (j = 0; j < n_phi_segments; j++) {
@@ -452,12 +490,10 @@ CanalSurface<C2F, RadF, R>::generateMesh(
     debugl(1, "rendering last circle..\n");
     /* and the same procedure for the endpoint, i.e. t = t1 */
     last_circle = current_circle;
-    last_p      = p;
-    p           = this->spineCurveEval(this->t1);
-    r           = this->radiusEval(this->t1);
-
-    this->spineCurveGetRenderFrame(this->t1, rvec, px, py, pz);
-    //this->spineCurveGetFrenetFrame(this->t1, px, py, pz);
+    p           = frames->p[ntsegments];
+    r           = frames->r[ntsegments];
+    py          = frames->py[ntsegments];
+    pz          = frames->pz[ntsegments];
     
     /* last circle has index ntsegments, since we got (ntsegments + 1) circles */
     if (start_circle_offset)
@@ -475,7 +511,6 @@ CanalSurface<C2F, RadF, R>::generateMesh(
             phi_offset = phi_0 + dphi / 2.0;
     }
 
-    px.print_debugl(1);
     py.print_debugl(1);
     pz.print_debugl(1);
     debugTabInc();
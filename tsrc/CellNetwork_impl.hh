@@ -208,6 +208,7 @@ NeuronVertex::NeuronVertex(NeuronVertex const &v)
 
 {
     this->sections      = v.sections;
+    this->type_tag      = v.type_tag;
 }
 
 /* see protected copy constructor above */
@@ -223,6 +224,7 @@ NeuronVertex::operator=(NeuronVertex const &v)
     Graph<Tn, Tv, Te>::Vertex::operator=(v);
 
     this->sections      = v.sections;
+    this->type_tag      = v.type_tag;
 
     return (*this);
 }
@@ -997,6 +999,7 @@ SomaVertex::SomaVertex(
          * to reimplement the empty() check in all leafs of the hierarchy. */
         : NeuronVertex(network, { CellSection( 0, Vec3<R>(0, 0, 0), 0) }, vertex_data)
 {
+    this->type_tag      = CellNetwork::SOMA_VERTEX;
     this->section_graph = section_graph;
     this->soma_data     = soma_data;
 
@@ -1264,6 +1267,9 @@ CellNetwork<Tn, Tv, Te, Tso, Tnv, Tax, Tde, Tns, Tas, Tds, Tnr, Tar, Tdr, R>::
 NeuriteVertex::setPosition(Vec3<R> const &p)
 {
     this->sections.begin()->position() = p;
+
+    /* chordal depths depend on segment lengths */
+    this->network->invalidateNeuriteSubTreeDepths();
 }
 
 template <
@@ -1456,6 +1462,7 @@ AxonVertex::AxonVertex(
         : NeuriteVertex(network, section, neurite_vertex_data, vertex_data),
         axon_data(axon_data)
 {
+    this->type_tag = CellNetwork::AXON_VERTEX;
 }
 
 /* private copy ctor, use with care! see NeuronVertex and Graph::Vertex copy ctor for details. */
@@ -1599,6 +1606,7 @@ DendriteVertex::DendriteVertex(
         apical_dendrite(apical_dendrite),
         dendrite_data(dendrite_data)
 {
+    this->type_tag = CellNetwork::DENDRITE_VERTEX;
 }
 
 /* private copy ctor, use with care! see NeuronVertex and Graph::Vertex copy ctor for details. */
@@ -1766,6 +1774,7 @@ NeuronEdge::NeuronEdge(NeuronEdge const &e) : Graph<Tn, Tv, Te>::Edge(e)
     this->network       = e.network;
     this->v_neuron_src  = e.v_neuron_src;
     this->v_neuron_dst  = e.v_neuron_dst;
+    this->type_tag      = e.type_tag;
 }
 
 template <
@@ -1780,6 +1789,7 @@ NeuronEdge::operator=(NeuronEdge const &e)
     this->network       = e.network;
     this->v_neuron_src  = e.v_neuron_src;
     this->v_neuron_dst  = e.v_neuron_dst;
+    this->type_tag      = e.type_tag;
 
     return (*this);
 }
@@ -2067,7 +2077,8 @@ AxonRootEdge::AxonRootEdge(
         : NeuriteRootEdge(network, v_src, v_dst, neurite_root_edge_data, edge_data),
         v_axon_dst(v_dst)
 {
-    this->axon_root_edge_data = axon_root_edge_data;
+    this->axon_root_edge_data   = axon_root_edge_data;
+    this->type_tag              = CellNetwork::AXON_ROOT_EDGE;
 }
 
 template <
@@ -2206,7 +2217,8 @@ DendriteRootEdge::DendriteRootEdge(
         : NeuriteRootEdge(network, v_src, v_dst, neurite_root_edge_data, edge_data),
         v_dendrite_dst(v_dst)
 {
-    this->dendrite_root_edge_data = dendrite_root_edge_data;
+    this->dendrite_root_edge_data   = dendrite_root_edge_data;
+    this->type_tag                  = CellNetwork::DENDRITE_ROOT_EDGE;
 }
 
 template <
@@ -2681,6 +2693,7 @@ AxonSegment::AxonSegment(
         v_axon_src(v_src), v_axon_dst(v_dst),
         axon_segment_data(axon_segment_data)
 {
+    this->type_tag = CellNetwork::AXON_SEGMENT;
 }
 
 template <
@@ -2866,6 +2879,7 @@ DendriteSegment::DendriteSegment(
         v_dendrite_src(v_src), v_dendrite_dst(v_dst),
         dendrite_segment_data(dendrite_segment_data)
 {
+    this->type_tag = CellNetwork::DENDRITE_SEGMENT;
 }
 
 template <
@@ -3471,7 +3485,7 @@ NeuronVertexAccessor::NeuronVertexAccessor(CellNetwork<Tn, Tv, Te, Tso, Tnv, Tax
         NeuronVertex,
         typename Graph<Tn, Tv, Te>::Vertex,
         NeuronVertex,
-        std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>,
+        typename Graph<Tn, Tv, Te>::VertexMapType,
         NeuronVertexPred,
         neuron_iterator,
         neuron_const_iterator,
@@ -3532,7 +3546,7 @@ NeuriteVertexAccessor::NeuriteVertexAccessor(CellNetwork &C)
         NeuriteVertex,
         typename Graph<Tn, Tv, Te>::Vertex,
         NeuronVertex,
-        std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>,
+        typename Graph<Tn, Tv, Te>::VertexMapType,
         NeuriteVertexPred,
         neurite_iterator,
         neurite_const_iterator,
@@ -3580,7 +3594,7 @@ CellNetwork<Tn, Tv, Te, Tso, Tnv, Tax, Tde, Tns, Tas, Tds, Tnr, Tar, Tdr, R>
         SomaVertex,
         typename Graph<Tn, Tv, Te>::Vertex,
         NeuronVertex,
-        std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>,
+        typename Graph<Tn, Tv, Te>::VertexMapType,
         SomaVertexPred,
         soma_iterator,
         soma_const_iterator,
@@ -3653,7 +3667,7 @@ AxonAccessor::AxonAccessor(CellNetwork<Tn, Tv, Te, Tso, Tnv, Tax, Tde, Tns, Tas,
         AxonVertex,
         typename Graph<Tn, Tv, Te>::Vertex,
         NeuronVertex,
-        std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>,
+        typename Graph<Tn, Tv, Te>::VertexMapType,
         AxonVertexPred,
         axon_iterator,
         axon_const_iterator,
@@ -3727,7 +3741,7 @@ DendriteAccessor::DendriteAccessor(CellNetwork<Tn, Tv, Te, Tso, Tnv, Tax, Tde, T
         DendriteVertex,
         typename Graph<Tn, Tv, Te>::Vertex,
         NeuronVertex,
-        std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>,
+        typename Graph<Tn, Tv, Te>::VertexMapType,
         DendriteVertexPred,
         dendrite_iterator,
         dendrite_const_iterator,
@@ -3802,7 +3816,7 @@ NeuronEdgeAccessor::NeuronEdgeAccessor(CellNetwork &C)
         NeuronEdge,
         typename Graph<Tn, Tv, Te>::Edge,
         NeuronEdge,
-        std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
+        typename Graph<Tn, Tv, Te>::EdgeMapType,
         NeuronEdgePred,
         neuron_edge_iterator,
         neuron_edge_const_iterator,
@@ -3864,7 +3878,7 @@ NeuriteRootEdgeAccessor::NeuriteRootEdgeAccessor(CellNetwork &C)
         NeuriteRootEdge,
         typename Graph<Tn, Tv, Te>::Edge,
         NeuronEdge,
-        std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
+        typename Graph<Tn, Tv, Te>::EdgeMapType,
         NeuriteRootEdgePred,
         neurite_rootedge_iterator,
         neurite_rootedge_const_iterator,
@@ -4092,7 +4106,7 @@ AxonRootEdgeAccessor::AxonRootEdgeAccessor(CellNetwork &C)
         AxonRootEdge,
         typename Graph<Tn, Tv, Te>::Edge,
         NeuronEdge,
-        std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
+        typename Graph<Tn, Tv, Te>::EdgeMapType,
         AxonRootEdgePred,
         axon_rootedge_iterator,
         axon_rootedge_const_iterator,
@@ -4159,7 +4173,7 @@ DendriteRootEdgeAccessor::DendriteRootEdgeAccessor(CellNetwork &C)
         DendriteRootEdge,
         typename Graph<Tn, Tv, Te>::Edge,
         NeuronEdge,
-        std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
+        typename Graph<Tn, Tv, Te>::EdgeMapType,
         DendriteRootEdgePred,
         dendrite_rootedge_iterator,
         dendrite_rootedge_const_iterator,
@@ -4226,7 +4240,7 @@ NeuriteSegmentAccessor::NeuriteSegmentAccessor(CellNetwork &C)
         NeuriteSegment,
         typename Graph<Tn, Tv, Te>::Edge,
         NeuronEdge,
-        std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
+        typename Graph<Tn, Tv, Te>::EdgeMapType,
         NeuriteSegmentPred,
         neurite_segment_iterator,
         neurite_segment_const_iterator,
@@ -4471,7 +4485,7 @@ AxonSegmentAccessor::AxonSegmentAccessor(CellNetwork &C)
         AxonSegment,
         typename Graph<Tn, Tv, Te>::Edge,
         NeuronEdge,
-        std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
+        typename Graph<Tn, Tv, Te>::EdgeMapType,
         AxonSegmentPred,
         axon_segment_iterator,
         axon_segment_const_iterator,
@@ -4538,7 +4552,7 @@ DendriteSegmentAccessor::DendriteSegmentAccessor(CellNetwork &C)
         DendriteSegment,
         typename Graph<Tn, Tv, Te>::Edge,
         NeuronEdge,
-        std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
+        typename Graph<Tn, Tv, Te>::EdgeMapType,
         DendriteSegmentPred,
         dendrite_segment_iterator,
         dendrite_segment_const_iterator,
@@ -4812,6 +4826,7 @@ CellNetwork(const std::string& _network_name)
 : Graph<Tn, Tv, Te>(),
 network_name(_network_name), network_info_initialized(false),
 global_coordinate_displacement(Aux::VecMat::nullvec<R>()), global_coordinate_scaling_factor(1.0),
+neurite_subtree_depths_valid(false), neurite_subtree_depths_version(0),
 neuron_vertices(*this), soma_vertices(*this),
 neurite_vertices(*this), axon_vertices(*this), dendrite_vertices(*this),
 neuron_edges(*this), neurite_root_edges(*this), axon_root_edges(*this), dendrite_root_edges(*this),
@@ -5036,6 +5051,121 @@ traverseBreadthFirst(
         (directed) ? "directed" : "undirected", vstart_it->id());
 }
 
+template <
+    typename Tn, typename Tv, typename Te, typename Tso, typename Tnv, typename Tax, typename Tde,
+    typename Tns, typename Tas, typename Tds, typename Tnr, typename Tar, typename Tdr, typename R
+>
+template <
+    typename VertexType,
+    typename EdgeType,
+    typename VertexPred,
+    typename EdgePred,
+    typename VertexVisitor,
+    typename EdgeVisitor
+>
+void
+CellNetwork<Tn, Tv, Te, Tso, Tnv, Tax, Tde, Tns, Tas, Tds, Tnr, Tar, Tdr, R>::
+traverseBreadthFirst(
+    neuron_iterator                 vstart_it,
+    bool const                     &directed,
+    VertexPred const               &vertex_pred,
+    EdgePred const                 &edge_pred,
+    VertexVisitor                 &&vertex_visitor,
+    EdgeVisitor                   &&edge_visitor,
+    std::vector<NeuronVertex *>    *parents,
+    int32_t                         tid_arg)
+{
+    debugl(1, "CellNetwork::traverseBreadthFirst(): starting %s traversal from node %2d.\n",
+        (directed) ? "directed" : "undirected", vstart_it->id());
+    debugTabInc();
+
+    uint32_t tid;
+    if (tid_arg == -1) {
+        tid = this->getFreshTraversalId();  
+    }
+    else if (tid_arg >= 0) {
+        tid = tid_arg;
+    }
+    else {
+        throw("CellNetwork::traverseBreadthFirst(): supplied traversal id is neither -1 (to indicate that fresh "\
+            "traversal id should be fetched internaly) nor >= 0.\n");
+    }
+
+    if (parents) {
+        parents->assign(this->V.empty() ? 0 : (this->V.rbegin()->first + 1), NULL);
+    }
+
+    /* queue of (vertex, d(vstart, vertex)) pairs. vertices are marked TRAV_ENQUEUED when pushed, so every vertex is
+     * enqueued at most once and a vector with a moving head suffices. */
+    std::vector<std::pair<NeuronVertex *, R>>   Q;
+    size_t                                      Q_head = 0;
+
+    NeuronVertex *vstart = &(*vstart_it);
+    Q.push_back(std::pair<NeuronVertex *, R>(vstart, 0));
+    vstart->setTraversalState(tid, this->TRAV_ENQUEUED);
+
+    /* process all edges in the given incident edge vector of v, where out indicates whether these are out edges
+     * (neighbour is destination) or in edges (neighbour is source) of v. */
+    auto process_edges = [&] (
+            NeuronVertex                                               *v,
+            R                                                           v_dist,
+            std::vector<typename Graph<Tn, Tv, Te>::Edge *> const      &edges,
+            bool                                                        out) -> void
+        {
+            for (auto &ge : edges) {
+                /* all edges of a CellNetwork are NeuronEdges by construction */
+                NeuronEdge *e = static_cast<NeuronEdge *>(ge);
+                if (!edge_pred(*e)) {
+                    continue;
+                }
+
+                NeuronVertex *nb = out ? &(*e->getDestinationVertex()) : &(*e->getSourceVertex());
+                if (!vertex_pred(*nb)) {
+                    continue;
+                }
+
+                /* visit e once if both e and the neighbour are of matching type */
+                if (matchesType(*nb, (VertexType const *)NULL) &&
+                    matchesType(*e, (EdgeType const *)NULL) &&
+                    e->getTraversalState(tid) == this->TRAV_UNSEEN)
+                {
+                    e->setTraversalState(tid, this->TRAV_DONE);
+                    edge_visitor(static_cast<EdgeType &>(*e));
+                }
+
+                if (nb->getTraversalState(tid) == this->TRAV_UNSEEN) {
+                    nb->setTraversalState(tid, this->TRAV_ENQUEUED);
+                    if (parents) {
+                        (*parents)[nb->id()] = v;
+                    }
+                    Q.push_back(std::pair<NeuronVertex *, R>(nb, v_dist + e->getLength()));
+                }
+            }
+        };
+
+    while (Q_head < Q.size()) {
+        NeuronVertex   *v       = Q[Q_head].first;
+        R const         v_dist  = Q[Q_head].second;
+        ++Q_head;
+
+        /* visit v if it is of matching type, abort the traversal if the visitor says so */
+        if (matchesType(*v, (VertexType const *)NULL) && !vertex_visitor(static_cast<VertexType &>(*v), v_dist)) {
+            break;
+        }
+
+        process_edges(v, v_dist, v->outEdges(), true);
+        if (!directed) {
+            process_edges(v, v_dist, v->inEdges(), false);
+        }
+
+        v->setTraversalState(tid, this->TRAV_DONE);
+    }
+
+    debugTabDec();
+    debugl(1, "CellNetwork::traverseBreadthFirst(): %s traversal from node %2d finished.\n",
+        (directed) ? "directed" : "undirected", vstart_it->id());
+}
+
 template <
     typename Tn, typename Tv, typename Te, typename Tso, typename Tnv, typename Tax, typename Tde,
     typename Tns, typename Tas, typename Tds, typename Tnr, typename Tar, typename Tdr, typename R
@@ -5044,84 +5174,111 @@ std::pair<uint32_t, R>
 CellNetwork<Tn, Tv, Te, Tso, Tnv, Tax, Tde, Tns, Tas, Tds, Tnr, Tar, Tdr, R>::
 getNeuriteSubTreeDepths(neurite_iterator n_it)
 {
-    /* compute depth from directed traversal of sub-tree rooted in n_it. first, retrieve all reachable neurite leafs
-     * along with paths to them. then the depth is given as the number of edges in the longest returned path. */
-    auto neurite_vertex_pred    = std::function<bool(NeuronVertex const &v)>(
-            [] (NeuronVertex const &v) -> bool
-            {
-                return (v.getType() == SOMA_VERTEX ||
-                        v.getType() == AXON_VERTEX ||
-                        v.getType() == DENDRITE_VERTEX);
-            }
-        );
+    if (!this->neurite_subtree_depths_valid || this->neurite_subtree_depths_version != this->getTopologyVersion()) {
+        this->computeNeuriteSubTreeDepths();
+    }
+    return this->neurite_subtree_depths[n_it->id()];
+}
 
-    auto neurite_segment_pred   = std::function<bool(NeuronEdge const &e)>(
-            [] (NeuronEdge const &e) -> bool
-            {
-                return (e.getType() == AXON_SEGMENT ||
-                        e.getType() == DENDRITE_SEGMENT);
-            }
-        );
+template <
+    typename Tn, typename Tv, typename Te, typename Tso, typename Tnv, typename Tax, typename Tde,
+    typename Tns, typename Tas, typename Tds, typename Tnr, typename Tar, typename Tdr, typename R
+>
+void
+CellNetwork<Tn, Tv, Te, Tso, Tnv, Tax, Tde, Tns, Tas, Tds, Tnr, Tar, Tdr, R>::
+invalidateNeuriteSubTreeDepths()
+{
+    this->neurite_subtree_depths_valid = false;
+}
 
-    auto neurite_leaf_pred      = std::function<bool(NeuriteVertex const &v)>(
-            [] (NeuriteVertex const &v) -> bool
-            {
-                return (v.template getFilteredOutNeighbours<NeuriteVertex>().size() == 0);
-            }
-        );
+template <
+    typename Tn, typename Tv, typename Te, typename Tso, typename Tnv, typename Tax, typename Tde,
+    typename Tns, typename Tas, typename Tds, typename Tnr, typename Tar, typename Tdr, typename R
+>
+void
+CellNetwork<Tn, Tv, Te, Tso, Tnv, Tax, Tde, Tns, Tas, Tds, Tnr, Tar, Tdr, R>::
+computeNeuriteSubTreeDepths()
+{
+    /* the depths of a neurite sub-tree are the maxima over all neurite leafs reachable along neurite segments of the
+     * number of edges resp. the length of the path to the leaf, i.e. for a vertex v with children c_i connected by
+     * segments e_i:
+     *
+     *  depth(v) = max_i (1 + depth(c_i)),  chordal_depth(v) = max_i (|e_i| + chordal_depth(c_i)),
+     *
+     * where only children with a reachable leaf are considered and leafs have depths zero. all depths are computed in
+     * post-order with an explicit stack, since neurite trees may be very deep. */
+    auto is_neurite_segment = [] (NeuronEdge const *e) -> bool
+    {
+        return (e->type_tag == AXON_SEGMENT || e->type_tag == DENDRITE_SEGMENT);
+    };
 
-    auto vertex_false_pred      = std::function<bool(NeuriteVertex const &v)>(
-            [] (NeuriteVertex const &v) -> bool
-            {
-                return false;
-            }
-        );
+    auto is_neurite_vertex = [] (NeuronVertex const *v) -> bool
+    {
+        return (v->type_tag == AXON_VERTEX || v->type_tag == DENDRITE_VERTEX);
+    };
 
-    auto edge_false_pred        = std::function<bool(NeuriteSegment const &e)>(
-            [] (NeuriteSegment const &e) -> bool
-            {
-                return false;
-            }
-        );
+    uint32_t const          nids = this->V.empty() ? 0 : (this->V.rbegin()->first + 1);
 
-    std::list<std::tuple<NeuriteVertex *, std::list<NeuronVertex *>, R>>    reachable_vertices_info;
-    std::list<NeuriteSegment *>                                             reachable_edges;
-
-    this->traverseBreadthFirst<NeuriteVertex, NeuriteSegment>(
-        /* start traversal from soma s */
-        n_it,
-        /* directed traversal, return paths */
-        true, true,
-        /* return lists */
-        reachable_vertices_info, reachable_edges,
-        /* predicates for neurite veritces / segments */
-        neurite_vertex_pred, neurite_segment_pred,
-        /* selection predicates for leaf neurite vertices, no edges at all */
-        neurite_leaf_pred, edge_false_pred,
-        /* trivial termination predicates always returning false */
-        vertex_false_pred, edge_false_pred);
-
-    /* get size of longest path to any neurite leaf */
-    if (!reachable_vertices_info.empty()) {
-        uint32_t    integral_depth  = 0, itmp;
-        R           chord_depth     = 0, rtmp;
-        for (auto &vi_tuple : reachable_vertices_info) {
-            itmp = (std::get<1>(vi_tuple)).size() - 1;
-            if (itmp > integral_depth) {
-                integral_depth = itmp;
-            }
+    /* per vertex id: 0 = unseen, 1 = children pushed, 2 = done. has_leaf marks vertices with a reachable leaf. */
+    std::vector<char>       state(nids, 0), has_leaf(nids, 0);
+    this->neurite_subtree_depths.assign(nids, std::pair<uint32_t, R>(0, 0));
+
+    std::vector<NeuronVertex *>     stack;
 
-            rtmp = (std::get<2>(vi_tuple));
-            if (rtmp > chord_depth) {
-                chord_depth = rtmp;
+    for (auto &n : this->neurite_vertices) {
+        stack.push_back(&n);
+
+        while (!stack.empty()) {
+            NeuronVertex   *v       = stack.back();
+            uint32_t const  v_id    = v->id();
+
+            if (state[v_id] == 0) {
+                /* push all unseen children, v is finished once they have been popped */
+                state[v_id] = 1;
+                for (auto &ge : v->outEdges()) {
+                    /* all edges of a CellNetwork are NeuronEdges by construction */
+                    NeuronEdge     *e = static_cast<NeuronEdge *>(ge);
+                    NeuronVertex   *c = &(*e->getDestinationVertex());
+                    if (is_neurite_segment(e) && is_neurite_vertex(c) && state[c->id()] == 0) {
+                        stack.push_back(c);
+                    }
+                }
+            }
+            else if (state[v_id] == 1) {
+                stack.pop_back();
+                state[v_id] = 2;
+
+                /* v is a leaf if it has no neurite vertex out-neighbour at all */
+                std::pair<uint32_t, R> &d   = this->neurite_subtree_depths[v_id];
+                bool is_leaf                = true;
+
+                for (auto &ge : v->outEdges()) {
+                    NeuronEdge     *e = static_cast<NeuronEdge *>(ge);
+                    NeuronVertex   *c = &(*e->getDestinationVertex());
+
+                    if (is_neurite_vertex(c)) {
+                        is_leaf = false;
+                        if (is_neurite_segment(e) && has_leaf[c->id()]) {
+                            std::pair<uint32_t, R> const &dc = this->neurite_subtree_depths[c->id()];
+                            has_leaf[v_id]  = 1;
+                            d.first         = std::max(d.first, dc.first + 1);
+                            d.second        = std::max(d.second, e->getLength() + dc.second);
+                        }
+                    }
+                }
+                if (is_leaf) {
+                    has_leaf[v_id] = 1;
+                }
+            }
+            else {
+                /* already finished, e.g. as the child of a vertex processed earlier */
+                stack.pop_back();
             }
         }
-        return std::pair<uint32_t, R>(integral_depth, chord_depth);
-    }
-    /* no neurite leaf (other than n_it) reachable. depths are zero */
-    else {
-        return std::pair<uint32_t, R>(0, 0);
     }
+
+    this->neurite_subtree_depths_valid      = true;
+    this->neurite_subtree_depths_version    = this->getTopologyVersion();
 }
 
 template <
@@ -5136,73 +5293,42 @@ getDirectedPath(
     std::list<NeuronVertex *>  &path,
     R                          &pathlen)
 {
-    auto neuron_vertex_true_pred    = std::function<bool(NeuronVertex const &v)>(
-            [] (NeuronVertex const &v) -> bool
-            {
-                return true;
-            }
-        );
-
-    auto neuron_vertex_false_pred   = std::function<bool(NeuronVertex const &v)>(
-            [] (NeuronVertex const &v) -> bool
-            {
-                return false;
-            }
-        );
+    std::vector<NeuronVertex *>     parents;
+    NeuronVertex                   *v       = &(*v_it);
+    bool                            reached = false;
 
-    auto neuron_edge_true_pred  = std::function<bool(NeuronEdge const &e)>(
-            [] (NeuronEdge const &e) -> bool
-            {
-                return true;
-            }
-        );
-    
-    auto neuron_edge_false_pred = std::function<bool(NeuronEdge const &e)>(
-            [] (NeuronEdge const &e) -> bool
-            {
+    /* directed traversal over all neuron vertices / edges starting from u, stopping as soon as v is reached */
+    this->template traverseBreadthFirst<NeuronVertex, NeuronEdge>(
+        u_it,
+        true,
+        [] (NeuronVertex const &) -> bool { return true; },
+        [] (NeuronEdge const &) -> bool { return true; },
+        [&] (NeuronVertex &w, R w_dist) -> bool
+        {
+            if (&w == v) {
+                reached = true;
+                pathlen = w_dist;
                 return false;
             }
-        );
-
-
-    auto v_pred                     = std::function<bool(NeuronVertex const &v)> (
-            [u_it] (NeuronVertex const &v) -> bool
-            {
-                return (neuron_const_iterator(u_it) == v.iterator());
-            }
-        );
-
-    std::list<std::tuple<NeuronVertex *, std::list<NeuronVertex *>, R>>     reachable_vertices_info;
-    std::list<NeuronEdge *>                                                 reachable_edges;
-
-    this->traverseBreadthFirst<NeuronVertex, NeuronEdge>(
-        /* start traversal from u */
-        u_it,
-        /* directed traversal, return paths */
-        true, true,
-        /* return lists */
-        reachable_vertices_info, reachable_edges,
-        /* use all neuron edges / vertices */
-        neuron_vertex_true_pred, neuron_edge_true_pred,
-        /* selection predicates: get v and no edges */
-        v_pred, neuron_edge_false_pred,
-        /* trivial termination predicates always returning false */
-        neuron_vertex_false_pred, neuron_edge_false_pred);
-
-    /* if v has been reached, copy info */
-    if (reachable_vertices_info.size() == 1) {
+            return true;
+        },
+        [] (NeuronEdge &) -> void {},
+        &parents);
+
+    path.clear();
+    /* if v has been reached, assemble path u -> v by following the parent pointers back from v */
+    if (reached) {
+        for (NeuronVertex *w = v; w; w = parents[w->id()]) {
+            path.push_front(w);
+        }
     }
     /* if v is not reachable, indicate with empty path and distance infinity */
-    else if (reachable_vertices_info.empty()) {
-        path    = {};
-        pathlen = Aux::Numbers::inf<R>(); 
-    }
-    /* throw: ambiguous, at least two paths from u to v found */
     else {
-        throw("CellNetwork::getDirectedPath(): ambiguous result. more than two paths from u to v found.");
+        pathlen = Aux::Numbers::inf<R>(); 
     }
 }
 
+
 template <
     typename Tn, typename Tv, typename Te, typename Tso, typename Tnv, typename Tax, typename Tde,
     typename Tns, typename Tas, typename Tds, typename Tnr, typename Tar, typename Tdr, typename R
@@ -5214,76 +5340,27 @@ getNeuriteConnectedComponent(
     std::list<NeuriteVertex *>     &reachable_neurite_vertices,
     std::list<NeuriteSegment *>    &reachable_neurite_segments)
 {
-    auto neurite_vertex_pred        = std::function<bool(NeuronVertex const &v)>(
-            [] (NeuronVertex const &v) -> bool
-            {
-                return (v.getType() == AXON_VERTEX || v.getType() == DENDRITE_VERTEX);
-            }
-        );
-
-    auto neurite_segment_pred       = std::function<bool(NeuronEdge const &e)>(
-            [] (NeuronEdge const &e) -> bool
-            {
-                return (e.getType() == AXON_SEGMENT || e.getType() == DENDRITE_SEGMENT);
-            }
-        );
-
-    auto neurite_segment_true_pred  = std::function<bool(NeuriteSegment const &e)>(
-            [] (NeuriteSegment const &e) -> bool
-            {
-                return true;
-            }
-        );
-
-    auto neurite_segment_false_pred = std::function<bool(NeuriteSegment const &e)>(
-            [] (NeuriteSegment const &e) -> bool
-            {
-                return false;
-            }
-        );
-
-    auto neurite_vertex_true_pred   = std::function<bool(NeuriteVertex const &v)>(
-            [] (NeuriteVertex const &v) -> bool
-            {
-                return true;
-            }
-        );
-
-    auto neurite_vertex_false_pred  = std::function<bool(NeuriteVertex const &v)>(
-            [] (NeuriteVertex const &v) -> bool
-            {
-                return false;
-            }
-        );
-    
-
-    std::list<std::tuple<NeuriteVertex *, std::list<NeuronVertex *>, R>>    reachable_vertices_info;
-    std::list<NeuriteSegment *>                                             reachable_edges;
-
-    this->traverseBreadthFirst<NeuriteVertex, NeuriteSegment>(
-        /* start traversal from u */
-        v_it,
-        /* undirected traversal, don't return paths */
-        false, false,
-        /* return lists */
-        reachable_vertices_info, reachable_edges,
-        /* use all neurite vertices / segments */
-        neurite_vertex_pred, neurite_segment_pred,
-        /* selection predicates: get all neurite vertices and edge */
-        neurite_vertex_true_pred, neurite_segment_true_pred,
-        /* trivial termination predicates always returning false */
-        neurite_vertex_false_pred, neurite_segment_false_pred);
-
-    /* assemble list of all reachable neurite vertices */
     reachable_neurite_vertices.clear();
-    for (auto &v_info : reachable_vertices_info) {
-        reachable_neurite_vertices.push_back(std::get<0>(v_info));
-    }
+    reachable_neurite_segments.clear();
 
-    /* copy reachable edges to return list */
-    reachable_neurite_segments = reachable_edges;
+    /* undirected traversal restricted to neurite vertices / segments, collecting everything reached */
+    this->template traverseBreadthFirst<NeuriteVertex, NeuriteSegment>(
+        v_it,
+        false,
+        [] (NeuronVertex const &v) -> bool { return (v.type_tag == AXON_VERTEX || v.type_tag == DENDRITE_VERTEX); },
+        [] (NeuronEdge const &e) -> bool { return (e.type_tag == AXON_SEGMENT || e.type_tag == DENDRITE_SEGMENT); },
+        [&] (NeuriteVertex &v, R) -> bool
+        {
+            reachable_neurite_vertices.push_back(&v);
+            return true;
+        },
+        [&] (NeuriteSegment &e) -> void
+        {
+            reachable_neurite_segments.push_back(&e);
+        });
 }
 
+
 /* statistical methods */
 template <
     typename Tn, typename Tv, typename Te, typename Tso, typename Tnv, typename Tax, typename Tde,
@@ -5291,52 +5368,159 @@ template <
 >
 typename CellNetwork<Tn, Tv, Te, Tso, Tnv, Tax, Tde, Tns, Tas, Tds, Tnr, Tar, Tdr, R>::CellNetworkStatistics
 CellNetwork<Tn, Tv, Te, Tso, Tnv, Tax, Tde, Tns, Tas, Tds, Tnr, Tar, Tdr, R>::
-computeStatistics() const
+computeStatistics(uint32_t nthreads) const
 {
-    CellNetworkStatistics stat;
+    using Aux::Stat::RunningStat;
+
+    struct VertexBlockStat {
+        RunningStat<R>  x, y, z, radius;
+    };
+
+    struct SegmentBlockStat {
+        RunningStat<R>  len, rlen, angle, abs_radius_diff, radius_ratio;
+        R               total_length = 0;
+    };
+
+    /* the block length is fixed, independent of nthreads. */
+    size_t const                            block_len = 1024;
+
+    CellNetworkStatistics                   stat;
+    RunningStat<R>                          dist, x, y, z, radius;
+    RunningStat<R>                          len, rlen, angle, abs_radius_diff, radius_ratio;
+    R                                       total_length = 0;
+    std::vector<NeuronVertex const *>       vertices;
+    std::vector<NeuriteSegment const *>     segments;
+
+    /* gather vertices and segments for random access by the blocks below */
+    vertices.reserve(this->vertices.size());
+    for (auto &v : this->neuron_vertices) {
+        vertices.push_back(&v);
+    }
+    for (auto &ns : this->neurite_segments) {
+        segments.push_back(&ns);
+    }
+
+    size_t const                    nv = vertices.size();
+    size_t const                    ns = segments.size();
+    std::vector<Vec3<R>>            positions(nv);
+    std::vector<VertexBlockStat>    vertex_blocks((nv + block_len - 1) / block_len);
+    std::vector<SegmentBlockStat>   segment_blocks((ns + block_len - 1) / block_len);
+
+    /* single pass over all neuron vertices: coordinate and neurite radius statistics, position snapshot for the
+     * pairwise distances below */
+    Aux::Alg::parallelBlocks(nv, block_len, nthreads,
+        [&] (size_t b, size_t first, size_t last) -> void
+        {
+            VertexBlockStat &bs = vertex_blocks[b];
+            for (size_t i = first; i < last; i++) {
+                NeuronVertex const &v   = *vertices[i];
+                Vec3<R> const p         = v.getSinglePointPosition();
+
+                positions[i] = p;
+                bs.x.add(p[0]);
+                bs.y.add(p[1]);
+                bs.z.add(p[2]);
+                if (v.type_tag == AXON_VERTEX || v.type_tag == DENDRITE_VERTEX) {
+                    bs.radius.add(v.getSinglePointRadius());
+                }
+            }
+        },
+        1);
+
+    /* single pass over all neurite segments */
+    Aux::Alg::parallelBlocks(ns, block_len, nthreads,
+        [&] (size_t b, size_t first, size_t last) -> void
+        {
+            SegmentBlockStat &bs = segment_blocks[b];
+            for (size_t i = first; i < last; i++) {
+                NeuriteSegment const   &e       = *segments[i];
+                neurite_const_iterator  u_it    = e.getSourceVertex();
+                neurite_const_iterator  v_it    = e.getDestinationVertex();
+                R const                 l       = e.getLength();
+
+                bs.total_length += l;
+                bs.len.add(l);
+                bs.rlen.add(l - u_it->getRadius() - v_it->getRadius());
+                bs.abs_radius_diff.add(e.getAbsoluteRadiusDifference());
+                bs.radius_ratio.add(e.getRadiusRatio());
+                if (u_it->indeg() == 1) {
+                    bs.angle.add(e.getAngle());
+                }
+            }
+        },
+        1);
+
+    for (auto &bs : vertex_blocks) {
+        x.merge(bs.x);
+        y.merge(bs.y);
+        z.merge(bs.z);
+        radius.merge(bs.radius);
+    }
+
+    for (auto &bs : segment_blocks) {
+        total_length += bs.total_length;
+        len.merge(bs.len);
+        rlen.merge(bs.rlen);
+        angle.merge(bs.angle);
+        abs_radius_diff.merge(bs.abs_radius_diff);
+        radius_ratio.merge(bs.radius_ratio);
+    }
+
+    /* pairwise distances of all neuron vertices, the only part that is not linear in the size of the network */
+    getPairwiseDistanceStat(positions, dist, nthreads);
+
+    R unused;
 
-    stat.neurite_tree_total_length      = this->getTotalNeuriteTreeLength();
+    stat.neurite_tree_total_length      = total_length;
     //stat.morphological_diameter         = this->getMorphologicalDiameter();
 
-    this->getNeuronVerticesDistanceStat(
+    dist.get(
         stat.neuron_vertices_dist_min,
         stat.neuron_vertices_dist_max,
         stat.neuron_vertices_dist_avg,
         stat.neuron_vertices_dist_sigma);
 
-    this->getNeuronVerticesCoordinateStat(
-        stat.neuron_vertices_xmin,
-        stat.neuron_vertices_xmax,
-        stat.neuron_vertices_xavg,
-        stat.neuron_vertices_xsigma,
-        //
-        stat.neuron_vertices_ymin,
-        stat.neuron_vertices_ymax,
-        stat.neuron_vertices_yavg,
-        stat.neuron_vertices_ysigma,
-        //
-        stat.neuron_vertices_zmin,
-        stat.neuron_vertices_zmax,
-        stat.neuron_vertices_zavg,
-        stat.neuron_vertices_zsigma);
-
-    this->getNeuriteRadiusStat(
+    x.get(stat.neuron_vertices_xmin, stat.neuron_vertices_xmax, stat.neuron_vertices_xavg, stat.neuron_vertices_xsigma);
+    y.get(stat.neuron_vertices_ymin, stat.neuron_vertices_ymax, stat.neuron_vertices_yavg, stat.neuron_vertices_ysigma);
+    z.get(stat.neuron_vertices_zmin, stat.neuron_vertices_zmax, stat.neuron_vertices_zavg, stat.neuron_vertices_zsigma);
+
+    radius.get(
         stat.neurite_radius_min,
         stat.neurite_radius_max,
         stat.neurite_radius_avg,
         stat.neurite_radius_sigma);
 
-    this->getNeuriteSegmentLengthStat(
+    len.get(
         stat.neurite_segment_length_min,
         stat.neurite_segment_length_max,
         stat.neurite_segment_length_avg,
-        stat.neurite_segment_length_sigma,
-        //
+        stat.neurite_segment_length_sigma);
+
+    rlen.get(
         stat.neurite_segment_reduced_length_min,
         stat.neurite_segment_reduced_length_max,
         stat.neurite_segment_reduced_length_avg,
         stat.neurite_segment_reduced_length_sigma);
 
+    angle.get(
+        stat.neurite_segment_angle_min,
+        stat.neurite_segment_angle_max,
+        stat.neurite_segment_angle_avg,
+        stat.neurite_segment_angle_sigma);
+
+    /* CellNetworkStatistics has no minimum fields for radius differences / ratios */
+    abs_radius_diff.get(
+        unused,
+        stat.neurite_segment_abs_radius_diff_max,
+        stat.neurite_segment_abs_radius_diff_avg,
+        stat.neurite_segment_abs_radius_diff_sigma);
+
+    radius_ratio.get(
+        unused,
+        stat.neurite_segment_radius_ratio_max,
+        stat.neurite_segment_radius_ratio_avg,
+        stat.neurite_segment_radius_ratio_sigma);
+
     return stat;
 }
 
@@ -5374,125 +5558,115 @@ getMorphologicalDiameter(soma_iterator s_it)
      * of the soma / neurite vertex sub-tree, i.e. the longest path between any two vertices in said tree. */
 
     /* find diameter of cell rooted in soma referred to by soma_it */
-    auto cell_vertex_pred   = std::function<bool(NeuronVertex const &v)>(
-            [] (NeuronVertex const &v) -> bool
-            {
-                return (v.getType() == SOMA_VERTEX ||
-                        v.getType() == AXON_VERTEX ||
-                        v.getType() == DENDRITE_VERTEX);
-            }
-        );
+    auto cell_vertex_pred = [] (NeuronVertex const &v) -> bool
+        {
+            return (v.type_tag == SOMA_VERTEX || v.type_tag == AXON_VERTEX || v.type_tag == DENDRITE_VERTEX);
+        };
 
-    auto cell_edge_pred     = std::function<bool(NeuronEdge const &e)>(
-            [] (NeuronEdge const &e) -> bool
-            {
-                return (e.getType() == AXON_ROOT_EDGE ||
-                        e.getType() == DENDRITE_ROOT_EDGE ||
-                        e.getType() == AXON_SEGMENT ||
-                        e.getType() == DENDRITE_SEGMENT);
-            }
-        );
+    auto cell_edge_pred = [] (NeuronEdge const &e) -> bool
+        {
+            return (e.type_tag == AXON_ROOT_EDGE || e.type_tag == DENDRITE_ROOT_EDGE ||
+                    e.type_tag == AXON_SEGMENT || e.type_tag == DENDRITE_SEGMENT);
+        };
 
-    auto neuron_vertex_true_pred    = std::function<bool(NeuronVertex const &v)>(
-            [] (NeuronVertex const &v) -> bool
-            {
-                return true;
-            }
-        );
+    /* undirected traversal of the cell tree from w, returning the reached vertex of maximum distance to w and said
+     * distance. */
+    auto farthest_vertex = [&] (neuron_iterator w_it) -> std::pair<NeuronVertex *, R>
+        {
+            std::pair<NeuronVertex *, R> far(NULL, -Aux::Numbers::inf<R>());
+
+            this->template traverseBreadthFirst<NeuronVertex, NeuronEdge>(
+                w_it,
+                false,
+                cell_vertex_pred,
+                cell_edge_pred,
+                [&] (NeuronVertex &x, R x_dist) -> bool
+                {
+                    if (x_dist > far.second) {
+                        far = std::pair<NeuronVertex *, R>(&x, x_dist);
+                    }
+                    return true;
+                },
+                [] (NeuronEdge &) -> void {});
 
-    auto neuron_vertex_false_pred   = std::function<bool(NeuronVertex const &v)>(
-            [] (NeuronVertex const &v) -> bool
-            {
-                return false;
-            }
-        );
+            return far;
+        };
 
-    auto neuron_edge_true_pred  = std::function<bool(NeuronEdge const &e)>(
-            [] (NeuronEdge const &e) -> bool
-            {
-                return true;
-            }
-        );
-    
-    auto neuron_edge_false_pred = std::function<bool(NeuronEdge const &e)>(
-            [] (NeuronEdge const &e) -> bool
-            {
-                return false;
-            }
-        );
+    /* find vertex u of maximum distance to s */
+    std::pair<NeuronVertex *, R> su = farthest_vertex(s_it);
+    neuron_iterator u_it            = su.first->iterator();
+    debugl(1, "neuron vertex of maximum distance to soma s (%d): vertex u (%d) with d(s,u) %10.5f\n", s_it->id(), u_it->id(), su.second);
 
-    std::list<std::tuple<NeuronVertex *, std::list<NeuronVertex *>, R>> reachable_vertices_info;
-    std::list<NeuronEdge *>                                             reachable_edges;
-
-    this->traverseBreadthFirst<NeuronVertex, NeuronEdge>(
-        /* start traversal from soma s */
-        s_it,
-        /* undirected traversal, don't return paths */
-        false, false,
-        /* addresses of return lists */
-        reachable_vertices_info, reachable_edges,
-        /* predicates for cell veritces / edges */
-        cell_vertex_pred, cell_edge_pred,
-        /* trivial selection predicates always returning true */
-        neuron_vertex_true_pred, neuron_edge_true_pred,
-        /* trivial termination predicates always returning false */
-        neuron_vertex_false_pred, neuron_edge_false_pred);
-
-    debugl(1, "reachable_vertices_info.size(): %zu.\n", reachable_vertices_info.size());
-    debugl(1, "reachable_edges.size(): %zu.\n", reachable_edges.size());
-
-    if (!reachable_vertices_info.empty()) {
-        /* find vertex u of maximum distance to s */
-        R               su_dist = -Aux::Numbers::inf<R>();
-        neuron_iterator u_it;
-
-        for (auto &vi_tuple : reachable_vertices_info) {
-            if (std::get<2>(vi_tuple) > su_dist) {
-                su_dist = std::get<2>(vi_tuple);
-                u_it    = std::get<0>(vi_tuple)->iterator();
-            }
-        }
-        debugl(1, "neuron vertex of maximum distance to soma s (%d): vertex u (%d) with d(s,u) %10.5f\n", s_it->id(), u_it->id(), su_dist);
-
-        /* start traversal from u, find vertex v of maximum distance to u. d(u, v) is the diameter of the cell tree, i.e.
-         * the morphological diameter of the cell rooted in s */
-        reachable_vertices_info.clear();
-        reachable_edges.clear();
-        this->traverseBreadthFirst<NeuronVertex, NeuronEdge>(
-            /* start traversal from soma iterator sit */
-            u_it,
-            /* undirected traversal, don't return paths */
-            false, false,
-            /* addresses of return lists */
-            reachable_vertices_info, reachable_edges,
-            /* predicates for cell veritces / edges */
-            cell_vertex_pred, cell_edge_pred,
-            /* trivial selection predicates always returning true */
-            neuron_vertex_true_pred, neuron_edge_true_pred,
-            /* trivial termination predicates always returning false */
-            neuron_vertex_false_pred, neuron_edge_false_pred);
-
-        /* find vertex u of maximum distance to s */
-        R               uv_dist = -Aux::Numbers::inf<R>();
-        neuron_iterator v_it;
-
-        for (auto &vi_tuple : reachable_vertices_info) {
-            if (std::get<2>(vi_tuple) > uv_dist) {
-                uv_dist = std::get<2>(vi_tuple);
-                v_it    = std::get<0>(vi_tuple)->iterator();
+    /* start traversal from u, find vertex v of maximum distance to u. d(u, v) is the diameter of the cell tree, i.e.
+     * the morphological diameter of the cell rooted in s */
+    std::pair<NeuronVertex *, R> uv = farthest_vertex(u_it);
+    debugl(1, "neuron vertex of maximum distance to u (%d): vertex v(%d) with d(u, v) = %10.5f\n", u_it->id(), uv.first->id(), uv.second);
+    debugl(1, "<=> diameter of cell tree, i.e. the morphological diameter, is %10.5f\n", uv.second);
+
+    debugTabDec();
+    debugl(1, "CellNetwork::getMorphologicalDiameter(): done.\n");
+
+    return uv.second;
+}
+
+
+template <
+    typename Tn, typename Tv, typename Te, typename Tso, typename Tnv, typename Tax, typename Tde,
+    typename Tns, typename Tas, typename Tds, typename Tnr, typename Tar, typename Tdr, typename R
+>
+void
+CellNetwork<Tn, Tv, Te, Tso, Tnv, Tax, Tde, Tns, Tas, Tds, Tnr, Tar, Tdr, R>::
+getPairwiseDistanceStat(
+    std::vector<Vec3<R>> const &positions,
+    Aux::Stat::RunningStat<R>  &dist_stat,
+    uint32_t                    nthreads)
+{
+    size_t const    block_len   = 256;
+    size_t const    n           = positions.size();
+    size_t const    nblocks     = (n + block_len - 1) / block_len;
+
+    /* coordinate arrays for the inner loop, which then runs over independent iterations */
+    std::vector<R>  px(n), py(n), pz(n);
+    for (size_t i = 0; i < n; i++) {
+        px[i] = positions[i][0];
+        py[i] = positions[i][1];
+        pz[i] = positions[i][2];
+    }
+
+    /* row i holds the distances to all j > i and is accumulated as a whole into the statistics of its block */
+    std::vector<Aux::Stat::RunningStat<R>> block_stats(nblocks);
+
+    auto processBlock = [&] (size_t b, R *d) -> void
+    {
+        size_t const last = std::min(n, (b + 1) * block_len);
+        for (size_t i = b * block_len; i < last; i++) {
+            R const         xi  = px[i], yi = py[i], zi = pz[i];
+            R const        *xj  = px.data() + i + 1, *yj = py.data() + i + 1, *zj = pz.data() + i + 1;
+            size_t const    m   = n - i - 1;
+
+            for (size_t j = 0; j < m; j++) {
+                R const dx = xj[j] - xi, dy = yj[j] - yi, dz = zj[j] - zi;
+                d[j] = std::sqrt(dx*dx + dy*dy + dz*dz);
             }
+            block_stats[b].add(d, m);
         }
-        debugl(1, "neuron vertex of maximum distance to u (%d): vertex v(%d) with d(u, v) = %10.5f\n", u_it->id(), v_it->id(), uv_dist);
-        debugl(1, "<=> diameter of cell tree, i.e. the morphological diameter, is %10.5f\n", uv_dist);
+    };
 
-        debugTabDec();
-        debugl(1, "CellNetwork::getMorphologicalDiameter(): done.\n");
+    /* rows get shorter towards the end. task t processes blocks t and nblocks - 1 - t to even out the work. */
+    Aux::Alg::parallelBlocks((nblocks + 1) / 2, 1, nthreads,
+        [&] (size_t t, size_t, size_t) -> void
+        {
+            std::vector<R> d(n);
 
-        return uv_dist;
-    }
-    /* no neuron vertex reachable from s => return 0 */
-    else {
-        return 0;
+            processBlock(t, d.data());
+            if (nblocks - 1 - t != t) {
+                processBlock(nblocks - 1 - t, d.data());
+            }
+        },
+        1);
+
+    for (auto &s : block_stats) {
+        dist_stat.merge(s);
     }
 }
 
@@ -5503,29 +5677,22 @@ template <
 void
 CellNetwork<Tn, Tv, Te, Tso, Tnv, Tax, Tde, Tns, Tas, Tds, Tnr, Tar, Tdr, R>::
 getNeuronVerticesDistanceStat(
-    R  &v_dist_min,
-    R  &v_dist_max,
-    R  &v_dist_avg,
-    R  &v_dist_sigma) const
-{
-    std::vector<R>  distances;
-    R               d;
-
-    for (auto vit = this->neuron_vertices.begin(); vit != this->neuron_vertices.end(); ++vit) {
-        auto vit_next = vit;
-        ++vit_next;
-        for (auto wit = vit_next; wit != this->neuron_vertices.end(); ++wit) {
-            d = (wit->getSinglePointPosition() - vit->getSinglePointPosition()).len2();
-            distances.push_back(d);
-        }
+    R          &v_dist_min,
+    R          &v_dist_max,
+    R          &v_dist_avg,
+    R          &v_dist_sigma,
+    uint32_t    nthreads) const
+{
+    std::vector<Vec3<R>>        positions;
+    Aux::Stat::RunningStat<R>   dist;
+
+    positions.reserve(this->vertices.size());
+    for (auto &v : this->neuron_vertices) {
+        positions.push_back(v.getSinglePointPosition());
     }
 
-    Aux::Stat::computeMinMaxAvgSigma(
-        distances,
-        v_dist_min,
-        v_dist_max,
-        v_dist_avg,
-        v_dist_sigma);
+    getPairwiseDistanceStat(positions, dist, nthreads);
+    dist.get(v_dist_min, v_dist_max, v_dist_avg, v_dist_sigma);
 }
 
 template <
@@ -5550,36 +5717,18 @@ getNeuronVerticesCoordinateStat(
     R  &v_zavg,
     R  &v_zsigma) const
 {
-    std::vector<R>  x_components, y_components, z_components;
-    Vec3<R>         p;
+    Aux::Stat::RunningStat<R> x, y, z;
 
     for (auto &v : this->neuron_vertices) {
-        p = v.getSinglePointPosition();
-        x_components.push_back(p[0]);
-        y_components.push_back(p[1]);
-        z_components.push_back(p[2]);
+        Vec3<R> const p = v.getSinglePointPosition();
+        x.add(p[0]);
+        y.add(p[1]);
+        z.add(p[2]);
     }
 
-    Aux::Stat::computeMinMaxAvgSigma(
-        x_components,
-        v_xmin,
-        v_xmax,
-        v_xavg,
-        v_xsigma);
-
-    Aux::Stat::computeMinMaxAvgSigma(
-        y_components,
-        v_ymin,
-        v_ymax,
-        v_yavg,
-        v_ysigma);
-
-    Aux::Stat::computeMinMaxAvgSigma(
-        z_components,
-        v_zmin,
-        v_zmax,
-        v_zavg,
-        v_zsigma);
+    x.get(v_xmin, v_xmax, v_xavg, v_xsigma);
+    y.get(v_ymin, v_ymax, v_yavg, v_ysigma);
+    z.get(v_zmin, v_zmax, v_zavg, v_zsigma);
 }
 
 template <
@@ -5594,16 +5743,12 @@ getNeuriteRadiusStat(
     R  &n_ravg,
     R  &n_rsigma) const
 {
-    std::vector<R>  values;
+    Aux::Stat::RunningStat<R> radius;
+
     for (auto &nv : this->neurite_vertices) {
-        values.push_back(nv.getRadius());
+        radius.add(nv.getRadius());
     }
-    Aux::Stat::computeMinMaxAvgSigma(
-        values,
-        n_rmin,
-        n_rmax,
-        n_ravg,
-        n_rsigma);
+    radius.get(n_rmin, n_rmax, n_ravg, n_rsigma);
 }
 
 template <
@@ -5623,27 +5768,15 @@ getNeuriteSegmentRadiusStat(
     R  &ns_radius_ratio_avg,
     R  &ns_radius_ratio_sigma) const
 {
-    std::vector<R>  abs_radius_diff_values;
-    std::vector<R>  radius_ratio_values;
-    for (auto &ns : this->neurite_segments) {
-        abs_radius_diff_values.push_back(ns.getAbsoluteRadiusDifference());
-        radius_ratio_values.push_back(ns.getRadiusRatio());
+    Aux::Stat::RunningStat<R> abs_radius_diff, radius_ratio;
 
+    for (auto &ns : this->neurite_segments) {
+        abs_radius_diff.add(ns.getAbsoluteRadiusDifference());
+        radius_ratio.add(ns.getRadiusRatio());
     }
 
-    Aux::Stat::computeMinMaxAvgSigma(
-        abs_radius_diff_values,
-        ns_abs_radius_diff_min,
-        ns_abs_radius_diff_max,
-        ns_abs_radius_diff_avg,
-        ns_abs_radius_diff_sigma);
-
-    Aux::Stat::computeMinMaxAvgSigma(
-        radius_ratio_values,
-        ns_radius_ratio_min,
-        ns_radius_ratio_max,
-        ns_radius_ratio_avg,
-        ns_radius_ratio_sigma);
+    abs_radius_diff.get(ns_abs_radius_diff_min, ns_abs_radius_diff_max, ns_abs_radius_diff_avg, ns_abs_radius_diff_sigma);
+    radius_ratio.get(ns_radius_ratio_min, ns_radius_ratio_max, ns_radius_ratio_avg, ns_radius_ratio_sigma);
 }
 
 template <
@@ -5663,6 +5796,16 @@ getNeuriteSegmentLengthStat(
     R  &ns_rlen_avg,
     R  &ns_rlen_sigma) const
 {
+    Aux::Stat::RunningStat<R> len, rlen;
+
+    for (auto &ns : this->neurite_segments) {
+        R const l = ns.getLength();
+        len.add(l);
+        rlen.add(l - ns.getSourceVertex()->getRadius() - ns.getDestinationVertex()->getRadius());
+    }
+
+    len.get(ns_len_min, ns_len_max, ns_len_avg, ns_len_sigma);
+    rlen.get(ns_rlen_min, ns_rlen_max, ns_rlen_avg, ns_rlen_sigma);
 }
 
 template <
@@ -5677,6 +5820,14 @@ getNeuriteSegmentAngleStat(
     R  &ns_angle_avg,
     R  &ns_angle_sigma) const
 {
+    Aux::Stat::RunningStat<R> angle;
+
+    for (auto &ns : this->neurite_segments) {
+        if (ns.getSourceVertex()->indeg() == 1) {
+            angle.add(ns.getAngle());
+        }
+    }
+    angle.get(ns_angle_min, ns_angle_max, ns_angle_avg, ns_angle_sigma);
 }
 
 template <
@@ -5773,109 +5924,63 @@ readFromNeuroMorphoSWCFile(
     debugl(1, "CellNetwork::readFromNeuroMorphoSWCFile():\n");
     debugTabInc();
 
-    /* define sorting function as lambda */
-    auto sort_id = [] (SWCNode const &a, SWCNode const &b) -> bool {
-        return (a.compartment_id < b.compartment_id);
-    };
+    std::vector<Aux::File::SWCRecord>   records;
+    std::vector<SWCNode>                swc_nodes;
+    std::vector<bool>                   node_traversed;
 
-    /* try to open input file */
-    std::ifstream           f;
-    std::string             line_string;
-    char                   *line;
-    char                   *linestart;
-    std::vector<SWCNode>    swc_nodes;
-    std::vector<bool>       node_traversed;
-    Vec3<R>                 p;
-    R                       r;
-    uint32_t                compartment_id, compartment_type;
-    int32_t                 parent_id;
-    uint32_t                nmatch;
-
-    debugl(2, "trying to open input file \"%s\". \n", filename.c_str() );
-
-    f.open(filename, std::ifstream::in);
-    if ( !f.is_open() ) {
-        //printf("CellNetwork::readFromNeuroMorphoSWCFile(): cannot open SWC file \"%s\" for reading.\n", filename.c_str() );
+    debugl(2, "trying to map and parse input file \"%s\". \n", filename.c_str() );
+    if (!Aux::File::readSWCFile(filename.c_str(), records)) {
         throw("CellNetwork::readFromNeuroMorphoSWCFile(): unable to open SWC file for reading.");
     }
-    debugl(2, "successfully opened. parsing input file one line at a time..\n");
+    debugl(2, "input file parsed into %zu SWC records.\n", records.size());
 
-    debugTabInc();
-    while ( f.good() ) {
-        std::getline(f, line_string);
-        if (line_string.size() == 0) {
-            debugl(4, "empty line..\n");
-            continue;
-        }
-
-        line        = new char [ line_string.size() + 1];
-        linestart   = line;
-        std::strcpy(line, line_string.c_str() );
-
-        while (isspace(*linestart)) {
-            ++linestart;
+    /* nodes are stored at their (0-based) compartment id. files almost always list compartments in order of their ids,
+     * otherwise sort the plain records once. */
+    auto in_order = [&] () -> bool
+    {
+        for (size_t i = 0; i < records.size(); i++) {
+            if (records[i].id != i + 1) {
+                return false;
+            }
         }
+        return true;
+    };
 
-        /* skip comments */
-        if (*linestart == '#') {
-            debugl(4, "comment found.. ignoring.\n");
-            delete[] line;
-            continue;
-        }
-        else {
-            debugl(4, "line: \"%s\".\n", line);
-        }
+    if (!in_order()) {
+        std::sort(records.begin(), records.end(),
+            [] (Aux::File::SWCRecord const &x, Aux::File::SWCRecord const &y) -> bool { return (x.id < y.id); });
 
-        if (std::is_same<double, R>::value) {
-            nmatch = sscanf(linestart, "%u %u %lf %lf %lf %lf %d\n", &compartment_id, &compartment_type, &p[0], &p[1], &p[2], &r, &parent_id);
-        }
-        if (std::is_same<float, R>::value) {
-            nmatch = sscanf(linestart, "%u %u %f %f %f %f %d\n", &compartment_id, &compartment_type, &p[0], &p[1], &p[2], &r, &parent_id);
-        }
-        else {
-            nmatch = sscanf(linestart, "%u %u %lf %lf %lf %lf %d\n", &compartment_id, &compartment_type, &p[0], &p[1], &p[2], &r, &parent_id);
+        /* check whether all ids are consecutive and hence also pairwise distinct */
+        if (!in_order()) {
+            throw("CellNetwork::readFromNeuroMorphoSWCFile(): compartment ids not consecutive. semantic error.\n");
         }
+    }
 
-        if (nmatch != 7) {
-            throw("CellNetwork::readFromNeuroMorphoSWCFile(): line is not a comment, yet necessary information could not be matched. syntax error..");
-        }
+    /* convert records to nodes, counting from 0. in the same pass, check that all parent ids refer to existing
+     * compartments other than the compartment itself. */
+    swc_nodes.reserve(records.size());
+    for (auto &rec : records) {
+        uint32_t const  compartment_id  = rec.id - 1;
+        int32_t const   parent_id       = (rec.parent_id == -1) ? -1 : (rec.parent_id - 1);
 
-        /* decrement indices, we count fromt 0 */
-        compartment_id--;
-        /* if parent_id is not -1 (soma), decrement as well */
-        if (parent_id != -1) {
-            parent_id--;
+        if (parent_id < -1 || parent_id >= (int32_t)records.size() || parent_id == (int32_t)compartment_id) {
+            throw("CellNetwork::readFromNeuroMorphoSWCFile(): parent id does not refer to another compartment. semantic error.\n");
         }
-        //printf("(%u,%u,%f,%f,%f,%f,%d)\n", section_idx, section_type, x, y, z, r, parent_idx);
 
         swc_nodes.push_back(
                 SWCNode(
                     compartment_id,
-                    compartment_type,
+                    rec.type,
                     parent_id,
-                    { { compartment_id, p, r } }
+                    { { compartment_id, Vec3<R>(rec.x, rec.y, rec.z), (R)rec.r } }
                 )
             );
-
-        delete [] line;
     }
-    debugTabDec();
-    debugl(2, "input file parsed into SWCNode array.\n");
-    
-    /* sort nodes by compartment id. */
-    std::sort(swc_nodes.begin(), swc_nodes.end(), sort_id);
+    std::vector<Aux::File::SWCRecord>().swap(records);
 
-    /* resize and init traversal flag array */
+    /* init traversal flag array */
     node_traversed.assign(swc_nodes.size(), false);
 
-    debugl(2, "checking for consecutive ids.\n");
-    /* check whether all ids are consecutive and hence also pairwise distinct */
-    for (uint32_t i = 0; i < swc_nodes.size(); i++) {
-        if (swc_nodes[i].compartment_id != i) {
-            throw("CellNetwork::readFromNeuroMorphoSWCFile(): compartment ids not consecutive. semantic error.\n");
-        }
-    }
-
     debugl(2, "computing preliminary tree structure.\n");
     /* compute tree structure among nodes and get all soma nodes, that is: all nodes with parent_id -1. other nodes may
      * refer encode information for the same soma and will be merged below */
@@ -5904,10 +6009,8 @@ readFromNeuroMorphoSWCFile(
      }
  
 
-    /* sort all child_id lists. */
-    for (auto &node : swc_nodes) {
-        node.child_ids.sort();
-    }
+    /* NOTE: all child_id lists are sorted, since nodes have been appended to their parents' lists in order of their
+     * ids above. */
 
     debugl(2, "gathering soma information from sub-graphs of soma info nodes.\n");
 
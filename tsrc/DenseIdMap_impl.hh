@@ -0,0 +1,278 @@
+/*
+ * This file is part of
+ *
+ * AnaMorph: a framework for geometric modelling, consistency analysis and surface
+ * mesh generation of anatomically reconstructed neuron morphologies.
+ * 
+ * Copyright (c) 2013-2017: G-CSC, Goethe University Frankfurt - Queisser group
+ * Author: Konstantin Mörschel
+ * 
+ * AnaMorph is free software: Redistribution and use in source and binary forms,
+ * with or without modification, are permitted under the terms of the
+ * GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works:
+ * "Based on AnaMorph (https://github.com/NeuroBox3D/AnaMorph)."
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works:
+ * "Based on AnaMorph (https://github.com/NeuroBox3D/AnaMorph)."
+ *
+ * (3) Neither the name "AnaMorph" nor the names of its contributors may be
+ * used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * (4) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Mörschel K, Breit M, Queisser G. Generating neuron geometries for detailed
+ *   three-dimensional simulations using AnaMorph. Neuroinformatics (2017)"
+ * "Grein S, Stepniewski M, Reiter S, Knodel MM, Queisser G.
+ *   1D-3D hybrid modelling – from multi-compartment models to full resolution
+ *   models in space and time. Frontiers in Neuroinformatics 8, 68 (2014)"
+ * "Breit M, Stepniewski M, Grein S, Gottmann P, Reinhardt L, Queisser G.
+ *   Anatomically detailed and large-scale simulations studying synapse loss
+ *   and synchrony using NeuroBox. Frontiers in Neuroanatomy 10 (2016)"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU Lesser General Public License for more details.
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* ----------------------------------------------------------------------------------------------------------------- *
+ *
+ *                        dense id map implementation
+ *
+ * ----------------------------------------------------------------------------------------------------------------- */
+
+template <typename T>
+size_t const DenseIdMap<T>::npos;
+
+template <typename T>
+DenseIdMap<T>::DenseIdMap()
+: s(new Slots())
+{
+    this->s->n = 0;
+}
+
+template <typename T>
+DenseIdMap<T>::DenseIdMap(DenseIdMap const &x)
+: s(new Slots(*x.s))
+{
+}
+
+template <typename T>
+DenseIdMap<T> &
+DenseIdMap<T>::operator=(DenseIdMap const &x)
+{
+    if (this != &x) {
+        *this->s = *x.s;
+    }
+    return (*this);
+}
+
+template <typename T>
+size_t
+DenseIdMap<T>::firstUsed(size_t j) const
+{
+    size_t const n = this->s->v.size();
+    for (; j < n; j++) {
+        if (this->s->v[j].second) {
+            return j;
+        }
+    }
+    return npos;
+}
+
+template <typename T>
+typename DenseIdMap<T>::iterator
+DenseIdMap<T>::begin()
+{
+    return iterator(this->s.get(), this->firstUsed(0));
+}
+
+template <typename T>
+typename DenseIdMap<T>::iterator
+DenseIdMap<T>::end()
+{
+    return iterator(this->s.get(), npos);
+}
+
+template <typename T>
+typename DenseIdMap<T>::const_iterator
+DenseIdMap<T>::begin() const
+{
+    return const_iterator(this->s.get(), this->firstUsed(0));
+}
+
+template <typename T>
+typename DenseIdMap<T>::const_iterator
+DenseIdMap<T>::end() const
+{
+    return const_iterator(this->s.get(), npos);
+}
+
+template <typename T>
+typename DenseIdMap<T>::reverse_iterator
+DenseIdMap<T>::rbegin()
+{
+    return reverse_iterator(this->end());
+}
+
+template <typename T>
+typename DenseIdMap<T>::reverse_iterator
+DenseIdMap<T>::rend()
+{
+    return reverse_iterator(this->begin());
+}
+
+template <typename T>
+typename DenseIdMap<T>::const_reverse_iterator
+DenseIdMap<T>::rbegin() const
+{
+    return const_reverse_iterator(this->end());
+}
+
+template <typename T>
+typename DenseIdMap<T>::const_reverse_iterator
+DenseIdMap<T>::rend() const
+{
+    return const_reverse_iterator(this->begin());
+}
+
+template <typename T>
+bool
+DenseIdMap<T>::empty() const
+{
+    return (this->s->n == 0);
+}
+
+template <typename T>
+size_t
+DenseIdMap<T>::size() const
+{
+    return this->s->n;
+}
+
+template <typename T>
+void
+DenseIdMap<T>::clear()
+{
+    std::vector<value_type>().swap(this->s->v);
+    this->s->n = 0;
+}
+
+template <typename T>
+void
+DenseIdMap<T>::swap(DenseIdMap &x)
+{
+    this->s.swap(x.s);
+}
+
+template <typename T>
+typename DenseIdMap<T>::iterator
+DenseIdMap<T>::find(uint32_t id)
+{
+    bool const used = (id < this->s->v.size() && this->s->v[id].second);
+    return iterator(this->s.get(), used ? id : npos);
+}
+
+template <typename T>
+typename DenseIdMap<T>::const_iterator
+DenseIdMap<T>::find(uint32_t id) const
+{
+    bool const used = (id < this->s->v.size() && this->s->v[id].second);
+    return const_iterator(this->s.get(), used ? id : npos);
+}
+
+template <typename T>
+size_t
+DenseIdMap<T>::count(uint32_t id) const
+{
+    return (id < this->s->v.size() && this->s->v[id].second) ? 1 : 0;
+}
+
+template <typename T>
+T &
+DenseIdMap<T>::at(uint32_t id)
+{
+    if (!this->count(id)) {
+        throw std::out_of_range("DenseIdMap::at(): id not found.");
+    }
+    return this->s->v[id].second;
+}
+
+template <typename T>
+T const &
+DenseIdMap<T>::at(uint32_t id) const
+{
+    if (!this->count(id)) {
+        throw std::out_of_range("DenseIdMap::at(): id not found.");
+    }
+    return this->s->v[id].second;
+}
+
+template <typename T>
+std::pair<typename DenseIdMap<T>::iterator, bool>
+DenseIdMap<T>::insert(value_type const &x)
+{
+    std::vector<value_type> &v  = this->s->v;
+    uint32_t const           id = x.first;
+
+    if (!x.second) {
+        throw("DenseIdMap::insert(): NULL can't be stored.");
+    }
+
+    /* new slots are marked unused and carry their id */
+    if (id >= v.size()) {
+        size_t j = v.size();
+        v.resize((size_t)id + 1);
+        for (; j < v.size(); j++) {
+            v[j] = value_type((uint32_t)j, T());
+        }
+    }
+
+    if (v[id].second) {
+        return { iterator(this->s.get(), id), false };
+    }
+    else {
+        v[id].second = x.second;
+        this->s->n++;
+        return { iterator(this->s.get(), id), true };
+    }
+}
+
+template <typename T>
+typename DenseIdMap<T>::iterator
+DenseIdMap<T>::erase(const_iterator it)
+{
+    std::vector<value_type> &v = this->s->v;
+    size_t const             j = it.i;
+
+    v[j].second = T();
+    this->s->n--;
+
+    /* drop unused slots at the end, which keeps iteration cheap if the elements with the largest ids are erased. the
+     * remaining iterators are unaffected, since they refer to used slots or to end(). */
+    while (!v.empty() && !v.back().second) {
+        v.pop_back();
+    }
+
+    return iterator(this->s.get(), this->firstUsed(j + 1));
+}
+
+template <typename T>
+size_t
+DenseIdMap<T>::erase(uint32_t id)
+{
+    if (this->count(id)) {
+        this->erase(this->find(id));
+        return 1;
+    }
+    return 0;
+}
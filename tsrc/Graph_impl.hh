@@ -70,9 +70,11 @@ Graph<Tg, Tv, Te>::resetTraversalStates()
 }
 
 template <typename Tg, typename Tv, typename Te>
-std::pair<typename std::map<uint32_t, typename Graph<Tg, Tv, Te>::VertexPointerType>::iterator, bool>
+std::pair<typename Graph<Tg, Tv, Te>::VertexMapType::iterator, bool>
 Graph<Tg, Tv, Te>::protectedVertexInsert(Vertex *v)
 {
+    this->topology_version++;
+
     debugl(3, "Graph::protectedVertexInsert()\n");
     debugTabInc();
 
@@ -87,7 +89,7 @@ Graph<Tg, Tv, Te>::protectedVertexInsert(Vertex *v)
     v->blocked              = false;
 
     /* insert vertex just as in VertexAccessor::insert().. */
-    std::pair<typename std::map<uint32_t, VertexPointerType >::iterator, bool> pair, ret;
+    std::pair<typename VertexMapType::iterator, bool> pair, ret;
 
     /* get fresh id for new vertex, allocate new vertex, insert pair (id, vertex) into map */
     uint32_t v_id   = this->V_idq.getId();
@@ -113,12 +115,14 @@ Graph<Tg, Tv, Te>::protectedVertexInsert(Vertex *v)
 }
 
 template <typename Tg, typename Tv, typename Te>
-std::pair<typename std::map<uint32_t, typename Graph<Tg, Tv, Te>::EdgePointerType>::iterator, bool>
+std::pair<typename Graph<Tg, Tv, Te>::EdgeMapType::iterator, bool>
 Graph<Tg, Tv, Te>::protectedEdgeInsert(
     Edge       *e,
     uint32_t    v_src_id,
     uint32_t    v_dst_id)  
 {
+    this->topology_version++;
+
     debugl(3, "Graph::protectedEdgeInsert()\n");
     debugTabInc();
 
@@ -132,7 +136,7 @@ Graph<Tg, Tv, Te>::protectedEdgeInsert(
         /* compare pointers */
         if ( v_src_it == e->getSourceVertex() && v_dst_it == e->getDestinationVertex() ) {
             /* pointers match, check if edge already exists via iterators */
-            std::pair<typename std::map<uint32_t, EdgePointerType >::iterator, bool> ret;
+            std::pair<typename EdgeMapType::iterator, bool> ret;
 
             if (this->edges.exists(v_src_it, v_dst_it)) {
                 ret.first = this->E.end();
@@ -155,8 +159,8 @@ Graph<Tg, Tv, Te>::protectedEdgeInsert(
 
                 /* topology information update */
                 bool all_inserted = 
-                    Aux::Alg::listSortedInsert(v_src_it->out_edges, e, false) &&
-                    Aux::Alg::listSortedInsert(v_dst_it->in_edges, e, false);
+                    Aux::Alg::vectorSortedInsert(v_src_it->out_edges, e, false) &&
+                    Aux::Alg::vectorSortedInsert(v_dst_it->in_edges, e, false);
 
                 if (all_inserted) {
                     ret.first   = e->g_eit;
@@ -186,28 +190,28 @@ Graph<Tg, Tv, Te>::protectedEdgeInsert(
 
 /* protected (static) methods to extract internal iterators from Graph::{vertex,edge}_iterators */
 template <typename Tg, typename Tv, typename Te>
-typename std::map<uint32_t, typename Graph<Tg, Tv, Te>::VertexPointerType>::const_iterator
+typename Graph<Tg, Tv, Te>::VertexMapType::const_iterator
 Graph<Tg, Tv, Te>::getInternalIterator(vertex_const_iterator const &it)
 {
     return it.int_it;
 }
 
 template <typename Tg, typename Tv, typename Te>
-typename std::map<uint32_t, typename Graph<Tg, Tv, Te>::VertexPointerType>::iterator
+typename Graph<Tg, Tv, Te>::VertexMapType::iterator
 Graph<Tg, Tv, Te>::getInternalIterator(vertex_iterator const &it)
 {
     return it.int_it;
 }
 
 template <typename Tg, typename Tv, typename Te>
-typename std::map<uint32_t, typename Graph<Tg, Tv, Te>::EdgePointerType>::const_iterator
+typename Graph<Tg, Tv, Te>::EdgeMapType::const_iterator
 Graph<Tg, Tv, Te>::getInternalIterator(edge_const_iterator const &it)
 {
     return it.int_it;
 }
 
 template <typename Tg, typename Tv, typename Te>
-typename std::map<uint32_t, typename Graph<Tg, Tv, Te>::EdgePointerType>::iterator
+typename Graph<Tg, Tv, Te>::EdgeMapType::iterator
 Graph<Tg, Tv, Te>::getInternalIterator(edge_iterator const &it)
 {
     return it.int_it;
@@ -317,7 +321,7 @@ Graph<Tg, Tv, Te>::Vertex::replaceAdjacentVertices(const std::map<Vertex *, Vert
 
 template <typename Tg, typename Tv, typename Te>
 typename Graph<Tg, Tv, Te>::Vertex *
-Graph<Tg, Tv, Te>::Vertex::getPtr(typename std::map<uint32_t, VertexPointerType >::const_iterator const &it)
+Graph<Tg, Tv, Te>::Vertex::getPtr(typename VertexMapType::const_iterator const &it)
 {
     return (it->second);
 }
@@ -577,7 +581,7 @@ Graph<Tg, Tv, Te>::Edge::~Edge()
 
 template <typename Tg, typename Tv, typename Te>
 typename Graph<Tg, Tv, Te>::Edge *
-Graph<Tg, Tv, Te>::Edge::getPtr(typename std::map<uint32_t, EdgePointerType >::const_iterator const &it)
+Graph<Tg, Tv, Te>::Edge::getPtr(typename EdgeMapType::const_iterator const &it)
 {
     return (it->second);
 }
@@ -786,7 +790,8 @@ Graph<Tg, Tv, Te>::Edge::getDestinationVertex() const
 template <typename Tg, typename Tv, typename Te>
 Graph<Tg, Tv, Te>::Graph(Tg const &graph_data) : vertices(*this) , edges(*this)
 {
-    this->graph_data = graph_data;
+    this->graph_data        = graph_data;
+    this->topology_version  = 0;
 }
 
 /* copy ctor */
@@ -798,6 +803,7 @@ Graph<Tg, Tv, Te>::Graph(const Graph<Tg, Tv, Te> &X) : vertices(*this), edges(*t
      * code in the copy ctor and use a swap trick in operator=(), which was deemed too inefficient,
      * since (partially quite large) graphes are often assigned, but not so much copy-constructed.
      * furthermore, the default construction is very little work. */
+    this->topology_version = 0;
     this->operator=(X);
 }
 
@@ -830,7 +836,7 @@ Graph<Tg, Tv, Te>::operator=(const Graph<Tg, Tv, Te>&X)
 
     /* deep copy */
     Vertex *v_new;
-    typename std::map<uint32_t, VertexPointerType >::iterator vit;
+    typename VertexMapType::iterator vit;
     for (vit = this->V.begin(); vit != this->V.end(); ++vit) {
         /* make a copy of the Vertex object currently pointed to by vit, which is a Vertex object
          * allocated by X, with the private copy ctor of Vertex */
@@ -911,6 +917,8 @@ template <typename Tg, typename Tv, typename Te>
 void
 Graph<Tg, Tv, Te>::clear()
 {
+    this->topology_version++;
+
     /* delete all allocated vertices */
     for (auto &v : this->vertices) {
         delete (&v);
@@ -935,6 +943,8 @@ template <typename Tg, typename Tv, typename Te>
 void
 Graph<Tg, Tv, Te>::clearEdges()
 {
+    this->topology_version++;
+
     /* delete all allocated edges */
     for (auto &e : this->edges) {
         delete (&e);
@@ -959,6 +969,8 @@ Graph<Tg, Tv, Te>::renumberConsecutively(
     uint32_t vertex_start_id,
     uint32_t edge_start_id)
 {
+    this->topology_version++;
+
     debugl(2, "Graph::renumberConsecutively(): vertex_start_id: %5d, edge_start_id: %5d.\n", vertex_start_id, edge_start_id);
     debugTabInc();
 
@@ -969,8 +981,8 @@ Graph<Tg, Tv, Te>::renumberConsecutively(
      * entire graph back to a consistent state.
      *
      * in general, all iterators are invalidated by this method */
-    std::map<uint32_t, VertexPointerType >    vertices_swap; 
-    std::map<uint32_t, EdgePointerType >      edges_swap;
+    VertexMapType    vertices_swap; 
+    EdgeMapType      edges_swap;
     
     /* swap vertices and edges with vertices_swap / edges_swap in-place */
     this->V.swap(vertices_swap);
@@ -982,7 +994,7 @@ Graph<Tg, Tv, Te>::renumberConsecutively(
 
     /* iterate through swap arrays and insert Vertex and Edge shared pointers into now empty 
      * maps this->V and this->E with correct ids */
-    typename std::map<uint32_t, VertexPointerType >::iterator vit;
+    typename VertexMapType::iterator vit;
     Vertex *v;
     for (uint32_t current_vertex_id = vertex_start_id; !vertices_swap.empty(); current_vertex_id++) {
         vit         = vertices_swap.begin();
@@ -1009,7 +1021,7 @@ Graph<Tg, Tv, Te>::renumberConsecutively(
     }
 
     /* same for all edges */
-    typename std::map<uint32_t, EdgePointerType >::iterator eit;
+    typename EdgeMapType::iterator eit;
     Edge *e;
 
     for (uint32_t current_edge_id = edge_start_id; !edges_swap.empty(); current_edge_id++) {
@@ -1046,6 +1058,13 @@ Graph<Tg, Tv, Te>::numEdges() const
     return this->edges.size();
 }
 
+template <typename Tg, typename Tv, typename Te>
+uint64_t
+Graph<Tg, Tv, Te>::getTopologyVersion() const
+{
+    return (this->topology_version);
+}
+
 template <typename Tg, typename Tv, typename Te>
 uint32_t
 Graph<Tg, Tv, Te>::getFreshTraversalId()
@@ -1067,6 +1086,8 @@ template <typename Tg, typename Tv, typename Te>
 void
 Graph<Tg, Tv, Te>::copyAppend(const Graph<Tg, Tv, Te>&B)
 {
+    this->topology_version++;
+
     std::map<uint32_t, vertex_iterator>                     new_vertex_its;
     typename std::map<uint32_t, vertex_iterator>::iterator  idit;
     vertex_iterator                                         new_it;
@@ -1103,21 +1124,19 @@ Graph<Tg, Tv, Te>::moveAppend(
     Graph<Tg, Tv, Te>              &B,
     std::list<vertex_iterator>     *update_vits)
 {
+    /* topology of both graphs changes */
+    this->topology_version++;
+    B.topology_version++;
+
     debugl(3, "Graph::moveAppend()\n");
     debugTabInc();
 
     uint32_t                            new_id;
     Vertex                             *v;
-    typename std::map<
-            uint32_t,
-            VertexPointerType
-        >::iterator                     v_newit;
+    typename VertexMapType::iterator                     v_newit;
 
     Edge                               *e;
-    typename std::map<
-            uint32_t,
-            EdgePointerType
-        >::iterator                     e_newit;
+    typename EdgeMapType::iterator                     e_newit;
     bool                                inserted;
         
     /* if update_vits != NULL, generate the list of vertex pointers from the given iterators.
@@ -1450,10 +1469,12 @@ template <typename Tg, typename Tv, typename Te>
 typename Graph<Tg, Tv, Te>::vertex_iterator
 Graph<Tg, Tv, Te>::VertexAccessor::insert(Tv const &data)
 {
+    this->graph.topology_version++;
+
     debugl(3, "Graph::VertexAccessor::insert().\n");
     debugTabInc();
 
-    std::pair<typename std::map<uint32_t, VertexPointerType >::iterator, bool> pair;
+    std::pair<typename VertexMapType::iterator, bool> pair;
 
     /* get fresh id for new vertex, allocate new vertex, insert pair (id, vertex) into map */
     uint32_t v_id   = this->graph.V_idq.getId();
@@ -1479,6 +1500,8 @@ template <typename Tg, typename Tv, typename Te>
 typename Graph<Tg, Tv, Te>::vertex_iterator
 Graph<Tg, Tv, Te>::VertexAccessor::erase(vertex_iterator it)
 {
+    this->graph.topology_version++;
+
     debugl(3, "Graph::VertexAccessor::erase(vertex_iterator it): vertex id: %6d. deleting %2zu and %2zu incident out and in edges, respectively.\n", it->id(), it->in_edges.size(), it->out_edges.size() );
     debugTabInc();
 
@@ -1695,6 +1718,8 @@ Graph<Tg, Tv, Te>::EdgeAccessor::insert(
     vertex_iterator     v_dst_it,
     Te const           &data)
 {
+    this->graph.topology_version++;
+
     debugl(3, "Graph::EdgeAccessor::insert().\n");
     debugTabInc();
 
@@ -1722,8 +1747,8 @@ Graph<Tg, Tv, Te>::EdgeAccessor::insert(
 
         /* topology information update */
         bool all_inserted = 
-            Aux::Alg::listSortedInsert(v_src_it->out_edges, e, false) &&
-            Aux::Alg::listSortedInsert(v_dst_it->in_edges, e, false);
+            Aux::Alg::vectorSortedInsert(v_src_it->out_edges, e, false) &&
+            Aux::Alg::vectorSortedInsert(v_dst_it->in_edges, e, false);
 
         if (all_inserted) {
             ret.first   = e->iterator();
@@ -1750,6 +1775,8 @@ Graph<Tg, Tv, Te>::EdgeAccessor::insert(
     uint32_t    v_dst_id,
     Te const   &data)
 {
+    this->graph.topology_version++;
+
     std::pair<
             typename Graph<Tg, Tv, Te>::edge_iterator,
             bool
@@ -1773,6 +1800,8 @@ template <typename Tg, typename Tv, typename Te>
 typename Graph<Tg, Tv, Te>::edge_iterator
 Graph<Tg, Tv, Te>::EdgeAccessor::erase(edge_iterator it)
 {
+    this->graph.topology_version++;
+
     debugl(3, "Graph::EdgeAccessor::erase(): erasing edge (%5d, %5d) with id %5d\n", it->v_src->id(), it->v_dst->id(), it->id());
     debugTabInc();
 
@@ -1794,8 +1823,8 @@ Graph<Tg, Tv, Te>::EdgeAccessor::erase(edge_iterator it)
     }
 
     if (
-        Aux::Alg::listContains(e->v_src->out_edges, e) ||
-        Aux::Alg::listContains(e->v_dst->in_edges, e)
+        Aux::Alg::vectorContains(e->v_src->out_edges, e) ||
+        Aux::Alg::vectorContains(e->v_dst->in_edges, e)
        )
     {
         throw GraphEx(GRAPH_LOGIC_ERROR, "Graph::EdgeAccessor::erase(): {src,dst} vertex {out,in} edge lists still contains edge to be deleted after removing first occurrence => edge has been in list multiple times. internal logic error.");
@@ -1834,6 +1863,8 @@ template <typename Tg, typename Tv, typename Te>
 typename Graph<Tg, Tv, Te>::vertex_iterator
 Graph<Tg, Tv, Te>::EdgeAccessor::collapse(edge_iterator it)
 {
+    this->graph.topology_version++;
+
     debugl(1, "Graph::EdgeAccessor::collapse(): edge e = (u, v) | %d = (%d, %d).\n",
         it->id(),
         it->getSourceVertex()->id(),
@@ -1902,8 +1933,8 @@ Graph<Tg, Tv, Te>::EdgeAccessor::collapse(edge_iterator it)
 
     /* sort edges of u */
     auto sort_fct = [] (const Edge* x, const Edge* y) -> bool {return (x->id() < y->id());};
-    u_it->in_edges.sort(sort_fct);
-    u_it->out_edges.sort(sort_fct);
+    std::sort(u_it->in_edges.begin(), u_it->in_edges.end(), sort_fct);
+    std::sort(u_it->out_edges.begin(), u_it->out_edges.end(), sort_fct);
 
     debugl(1, "neighbours of collapsed vertex: \n");
     debugTabInc();
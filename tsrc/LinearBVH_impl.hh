@@ -0,0 +1,350 @@
+/*
+ * This file is part of
+ *
+ * AnaMorph: a framework for geometric modelling, consistency analysis and surface
+ * mesh generation of anatomically reconstructed neuron morphologies.
+ * 
+ * Copyright (c) 2013-2017: G-CSC, Goethe University Frankfurt - Queisser group
+ * Author: Konstantin Mörschel
+ * 
+ * AnaMorph is free software: Redistribution and use in source and binary forms,
+ * with or without modification, are permitted under the terms of the
+ * GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works:
+ * "Based on AnaMorph (https://github.com/NeuroBox3D/AnaMorph)."
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works:
+ * "Based on AnaMorph (https://github.com/NeuroBox3D/AnaMorph)."
+ *
+ * (3) Neither the name "AnaMorph" nor the names of its contributors may be
+ * used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * (4) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Mörschel K, Breit M, Queisser G. Generating neuron geometries for detailed
+ *   three-dimensional simulations using AnaMorph. Neuroinformatics (2017)"
+ * "Grein S, Stepniewski M, Reiter S, Knodel MM, Queisser G.
+ *   1D-3D hybrid modelling – from multi-compartment models to full resolution
+ *   models in space and time. Frontiers in Neuroinformatics 8, 68 (2014)"
+ * "Breit M, Stepniewski M, Grein S, Gottmann P, Reinhardt L, Queisser G.
+ *   Anatomically detailed and large-scale simulations studying synapse loss
+ *   and synchrony using NeuroBox. Frontiers in Neuroanatomy 10 (2016)"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU Lesser General Public License for more details.
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* ----------------------------------------------------------------------------------------------------------------- *
+ *
+ *                        linear bounding volume hierarchy implementation ....
+ *
+ * ----------------------------------------------------------------------------------------------------------------- */
+
+template <typename T, typename R>
+LinearBVH<T, R>::LinearBVH(uint32_t leaf_size)
+{
+    this->leaf_size = (leaf_size > 0) ? leaf_size : 1;
+}
+
+template <typename T, typename R>
+void
+LinearBVH<T, R>::clear()
+{
+    /* swap with empty vectors to actually release the memory */
+    std::vector<T>().swap(this->items);
+    std::vector<BoundingBox<R>>().swap(this->item_bbs);
+    std::vector<BoundingBox<R>>().swap(this->nodes);
+    std::vector<size_t>().swap(this->level_offsets);
+}
+
+template <typename T, typename R>
+bool
+LinearBVH<T, R>::empty() const
+{
+    return (this->items.empty());
+}
+
+template <typename T, typename R>
+size_t
+LinearBVH<T, R>::size() const
+{
+    return (this->items.size());
+}
+
+template <typename T, typename R>
+size_t
+LinearBVH<T, R>::memoryFootprint() const
+{
+    return (
+        this->items.capacity() * sizeof(T) +
+        this->item_bbs.capacity() * sizeof(BoundingBox<R>) +
+        this->nodes.capacity() * sizeof(BoundingBox<R>) +
+        this->level_offsets.capacity() * sizeof(size_t) );
+}
+
+/* spread the lower 21 bits of x such that bit i ends up at bit 3i */
+template <typename T, typename R>
+uint64_t
+LinearBVH<T, R>::expandBits21(uint64_t x)
+{
+    x &= 0x1FFFFFull;
+    x = (x | (x << 32)) & 0x001F00000000FFFFull;
+    x = (x | (x << 16)) & 0x001F0000FF0000FFull;
+    x = (x | (x <<  8)) & 0x100F00F00F00F00Full;
+    x = (x | (x <<  4)) & 0x10C30C30C30C30C3ull;
+    x = (x | (x <<  2)) & 0x1249249249249249ull;
+    return x;
+}
+
+/* stable LSD radix sort of keys over 8-bit digits, applying the same permutation to perm. every pass computes one
+ * histogram per thread-owned contiguous chunk, so that the scatter can run on all chunks concurrently while
+ * remaining stable. passes whose digit is equal for all keys are skipped, which in particular skips the top byte of
+ * 63-bit Morton codes and all high bytes for small inputs quantized to a coarse grid. */
+template <typename T, typename R>
+void
+LinearBVH<T, R>::radixSort(
+    std::vector<uint64_t>  &keys,
+    std::vector<uint32_t>  &perm,
+    uint32_t                nthreads)
+{
+    size_t const n = keys.size();
+    if (n < 2) {
+        return;
+    }
+
+    /* at least 64k keys per thread, otherwise thread creation dominates */
+    uint32_t const nchunks = std::max<uint32_t>(1, std::min<size_t>(nthreads, n / 65536));
+    size_t const chunk_len = (n + nchunks - 1) / nchunks;
+
+    std::vector<uint64_t>               keys_tmp(n);
+    std::vector<uint32_t>               perm_tmp(n);
+    std::vector<std::array<size_t, 256>> hist(nchunks);
+
+    auto runChunks = [&] (std::function<void(uint32_t)> const &f) -> void
+    {
+        if (nchunks == 1) {
+            f(0);
+        }
+        else {
+            std::vector<std::thread> workers;
+            workers.reserve(nchunks - 1);
+            for (uint32_t c = 1; c < nchunks; c++) {
+                workers.emplace_back(f, c);
+            }
+            f(0);
+            for (auto &w : workers) {
+                w.join();
+            }
+        }
+    };
+
+    for (uint32_t shift = 0; shift < 64; shift += 8) {
+        /* per-chunk histograms */
+        runChunks([&] (uint32_t c) -> void
+            {
+                std::array<size_t, 256> &h = hist[c];
+                h.fill(0);
+
+                size_t const last = std::min(n, (c + 1) * chunk_len);
+                for (size_t i = c * chunk_len; i < last; i++) {
+                    h[(keys[i] >> shift) & 0xFF]++;
+                }
+            });
+
+        /* skip pass if all keys share this digit */
+        bool trivial = false;
+        for (uint32_t d = 0; d < 256; d++) {
+            size_t total = 0;
+            for (uint32_t c = 0; c < nchunks; c++) {
+                total += hist[c][d];
+            }
+            if (total == n) {
+                trivial = true;
+                break;
+            }
+            else if (total > 0) {
+                break;
+            }
+        }
+        if (trivial) {
+            continue;
+        }
+
+        /* convert to exclusive offsets, ordered by digit first and chunk second for stability */
+        size_t offset = 0;
+        for (uint32_t d = 0; d < 256; d++) {
+            for (uint32_t c = 0; c < nchunks; c++) {
+                size_t const cnt = hist[c][d];
+                hist[c][d]       = offset;
+                offset          += cnt;
+            }
+        }
+
+        /* scatter */
+        runChunks([&] (uint32_t c) -> void
+            {
+                std::array<size_t, 256> &h = hist[c];
+
+                size_t const last = std::min(n, (c + 1) * chunk_len);
+                for (size_t i = c * chunk_len; i < last; i++) {
+                    size_t const dst = h[(keys[i] >> shift) & 0xFF]++;
+                    keys_tmp[dst]    = keys[i];
+                    perm_tmp[dst]    = perm[i];
+                }
+            });
+
+        keys.swap(keys_tmp);
+        perm.swap(perm_tmp);
+    }
+}
+
+template <typename T, typename R>
+void
+LinearBVH<T, R>::build(
+    std::vector<std::pair<T, BoundingBox<R>>> const    &elements,
+    BoundingBox<R> const                               &scene_bb,
+    uint32_t                                            nthreads)
+{
+    this->clear();
+
+    size_t const n = elements.size();
+    if (n == 0) {
+        return;
+    }
+
+    if (n > 0xFFFFFFFFull) {
+        throw("LinearBVH::build(): too many elements.");
+    }
+
+    /* quantize bounding box centres relative to the scene bounding box and compute Morton codes */
+    Vec3<R> const   s_min   = scene_bb.min();
+    Vec3<R> const   s_ext   = scene_bb.max() - s_min;
+    R const         qmax    = (R)0x1FFFFF;
+
+    std::vector<uint64_t> codes(n);
+    std::vector<uint32_t> perm(n);
+
+    for (size_t i = 0; i < n; i++) {
+        Vec3<R> const c = (elements[i].second.min() + elements[i].second.max()) * 0.5;
+        uint64_t q[3];
+
+        for (uint32_t k = 0; k < 3; k++) {
+            R x = (s_ext[k] > 0) ? (c[k] - s_min[k]) / s_ext[k] * qmax : 0;
+            /* also catches NaN */
+            if (!(x > 0)) {
+                x = 0;
+            }
+            else if (x > qmax) {
+                x = qmax;
+            }
+            q[k] = (uint64_t)x;
+        }
+
+        codes[i] = (expandBits21(q[0]) << 2) | (expandBits21(q[1]) << 1) | expandBits21(q[2]);
+        perm[i]  = i;
+    }
+
+    LinearBVH::radixSort(codes, perm, nthreads);
+
+    this->items.resize(n);
+    this->item_bbs.resize(n);
+    for (size_t i = 0; i < n; i++) {
+        this->items[i]      = elements[perm[i]].first;
+        this->item_bbs[i]   = elements[perm[i]].second;
+    }
+
+    /* leaf level, then combine pairwise until a single root node remains */
+    size_t const nleaves = (n + this->leaf_size - 1) / this->leaf_size;
+    size_t total = 0;
+    for (size_t m = nleaves; ; m = (m + 1) / 2) {
+        total += m;
+        if (m == 1) {
+            break;
+        }
+    }
+    this->nodes.resize(total);
+
+    this->level_offsets.push_back(0);
+    for (size_t l = 0; l < nleaves; l++) {
+        BoundingBox<R> &bb  = this->nodes[l];
+        size_t const last   = std::min(n, (l + 1) * this->leaf_size);
+        for (size_t i = l * this->leaf_size; i < last; i++) {
+            bb.update(this->item_bbs[i]);
+        }
+    }
+    this->level_offsets.push_back(nleaves);
+
+    size_t m = nleaves;
+    while (m > 1) {
+        size_t const lower  = this->level_offsets[this->level_offsets.size() - 2];
+        size_t const upper  = this->level_offsets.back();
+        size_t const m_up   = (m + 1) / 2;
+
+        for (size_t i = 0; i < m_up; i++) {
+            BoundingBox<R> &bb = this->nodes[upper + i];
+            bb.update(this->nodes[lower + 2*i]);
+            if (2*i + 1 < m) {
+                bb.update(this->nodes[lower + 2*i + 1]);
+            }
+        }
+        this->level_offsets.push_back(upper + m_up);
+        m = m_up;
+    }
+}
+
+template <typename T, typename R>
+template <typename F>
+void
+LinearBVH<T, R>::query(
+    BoundingBox<R> const   &search_box,
+    F                      &&f) const
+{
+    if (this->items.empty()) {
+        return;
+    }
+
+    /* depth-first traversal with an explicit stack of (level, index) pairs. at most one sibling per level is pending
+     * plus the node being expanded, and there are at most 64 levels. */
+    std::array<std::pair<uint32_t, size_t>, 128>   stack;
+    uint32_t                                        top     = 0;
+    uint32_t const                                  nlevels = this->level_offsets.size() - 1;
+
+    stack[top++] = { nlevels - 1, 0 };
+
+    while (top > 0) {
+        uint32_t const  l = stack[top - 1].first;
+        size_t const    i = stack[top - 1].second;
+        top--;
+
+        if (!(search_box && this->nodes[this->level_offsets[l] + i])) {
+            continue;
+        }
+
+        if (l == 0) {
+            size_t const last = std::min(this->items.size(), (i + 1) * this->leaf_size);
+            for (size_t j = i * this->leaf_size; j < last; j++) {
+                if (search_box && this->item_bbs[j]) {
+                    f(this->items[j]);
+                }
+            }
+        }
+        else {
+            /* push right child first, so that the left one is visited first and elements are reported in order */
+            size_t const nlower = this->level_offsets[l] - this->level_offsets[l - 1];
+            if (2*i + 1 < nlower) {
+                stack[top++] = { l - 1, 2*i + 1 };
+            }
+            stack[top++] = { l - 1, 2*i };
+        }
+    }
+}
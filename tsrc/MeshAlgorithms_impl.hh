@@ -55,6 +55,8 @@
 #include "uTuple.hh"
 #include "PriorityQueue.hh"
 
+#include <unordered_set>
+
 
 template <typename Tm, typename Tv, typename Tf, typename R>
 void
@@ -369,7 +371,8 @@ MeshAlg::getPotentiallyIntersectingEdgeFacePairs(
     std::vector<EdgeFacePair<Mesh<Tm, Tv, Tf, R> > >&  X_edges_Y_faces_candidates,
     std::vector<EdgeFacePair<Mesh<Tm, Tv, Tf, R> > >&  Y_edges_X_faces_candidates,
     uint32_t                                    max_components,
-    uint32_t                                    max_recursion_depth)
+    uint32_t                                    max_recursion_depth,
+    uint32_t                                    nthreads)
 {
     typedef EdgeFacePair<Mesh<Tm, Tv, Tf, R> > EFPtype;
     typedef typename Mesh<Tm, Tv, Tf, R>::Face FaceType;
@@ -379,18 +382,46 @@ MeshAlg::getPotentiallyIntersectingEdgeFacePairs(
     debugl(2, "MeshAlg::getPotentialEdgeFacePairs(): max_components: %5d, max_recursion_depth: %5d.\n", max_components, max_recursion_depth);
     debugTabInc();
 
-    /* get bounding box surrounding both X and Y */
-    auto XY_bb  = (X.getBoundingBox()).update(Y.getBoundingBox());
-
-    /* store lists of all faces of X and Y in root lists for recursive top-down Octree-like algorithm 
-     * Common::Geometry::computeSpatialIntersectionCandidatePairs() */
+    /* store lists of faces of X and Y in root lists for recursive top-down Octree-like algorithm
+     * Common::Geometry::computeSpatialIntersectionCandidatePairs(). 
+     *
+     * the computation is localized: only faces of the larger mesh whose bounding boxes overlap the (extended)
+     * bounding box of the smaller mesh can possibly be part of a candidate pair, so only this local submesh is listed
+     * and the root box is chosen to enclose the smaller mesh and the local submesh only. this is the typical
+     * situation when merging a small neurite path mesh into a large partial cell mesh, where the partitioning would
+     * otherwise be spent on the entire cell and the recursion would operate on all of its faces. the candidate pairs
+     * are unaffected. the local submesh is located with the face hierarchy of the larger mesh, which is maintained
+     * incrementally across the local modifications of successive merges (see Mesh::findFaces()), so that the larger
+     * mesh is not scanned as a whole. */
     std::vector<std::pair<FaceType*, BoundingBox<R> > > X_face_info_list, Y_face_info_list;
-    X_face_info_list.reserve(X.numFaces());
-    Y_face_info_list.reserve(Y.numFaces());
-    for (auto &f : X.faces)
-        X_face_info_list.push_back({&f, f.getBoundingBox()});
-    for (auto &f : Y.faces)
-        Y_face_info_list.push_back({&f, f.getBoundingBox()});
+    const bool      X_local = (X.numFaces() >= Y.numFaces());
+    auto           &L       = X_local ? X : Y;
+    auto           &S       = X_local ? Y : X;
+    auto           &L_face_info_list = X_local ? X_face_info_list : Y_face_info_list;
+    auto           &S_face_info_list = X_local ? Y_face_info_list : X_face_info_list;
+
+    /* bounding box of S, which is extended by a small margin in Mesh::getBoundingBox() */
+    auto const      S_bb    = S.getBoundingBox();
+    auto            XY_bb   = S_bb;
+
+    S_face_info_list.reserve(S.numFaces());
+    for (auto &f : S.faces)
+        S_face_info_list.push_back({&f, f.getBoundingBox()});
+
+    if (S.numFaces() > 0) {
+        std::list<FaceType *> L_local_faces;
+        L.findFaces(S_bb, L_local_faces);
+
+        L_face_info_list.reserve(L_local_faces.size());
+        for (auto f : L_local_faces) {
+            auto f_bb = f->getBoundingBox();
+            XY_bb.update(f_bb);
+            L_face_info_list.push_back({f, f_bb});
+        }
+    }
+
+    debugl(2, "MeshAlg::getPotentialEdgeFacePairs(): local submesh of %s mesh: %ld of %d faces.\n",
+            X_local ? "X" : "Y", L_face_info_list.size(), L.numFaces());
 
     std::vector<std::pair<FaceType*, FaceType*> > candidate_pairs;
 
@@ -405,7 +436,8 @@ MeshAlg::getPotentiallyIntersectingEdgeFacePairs(
         //face_bb_getter, face_bb_getter,
         //NULL, NULL,
         0, max_components, max_recursion_depth,
-        candidate_pairs
+        candidate_pairs,
+        nthreads
     );
 
     debugl(1, "MeshAlg::getPotentialEdgeFacePairs(): done. time: %5.4f\n", Aux::Timing::tack(16));
@@ -427,7 +459,7 @@ MeshAlg::getPotentiallyIntersectingEdgeFacePairs(
             return x.second->id() < y.second->id();
         };
 
-    std::sort(candidate_pairs.begin(), candidate_pairs.end(), face_ptr_pair_cmp);
+    Aux::Alg::parallelSort(candidate_pairs.begin(), candidate_pairs.end(), face_ptr_pair_cmp, nthreads);
     auto newPairEnd = std::unique(candidate_pairs.begin(), candidate_pairs.end());
     candidate_pairs.erase(newPairEnd, candidate_pairs.end());
 
@@ -477,11 +509,13 @@ MeshAlg::getPotentiallyIntersectingEdgeFacePairs(
         }
     }
 
-    std::sort(X_edges_Y_faces_candidates.begin(), X_edges_Y_faces_candidates.end());
+    /* sort() and unique() result lists. EdgeFacePair::operator<() is a total order on the ids, so the result does not
+     * depend on the sorting algorithm */
+    Aux::Alg::parallelSort(X_edges_Y_faces_candidates.begin(), X_edges_Y_faces_candidates.end(), nthreads);
     auto newEnd = std::unique(X_edges_Y_faces_candidates.begin(), X_edges_Y_faces_candidates.end());
     X_edges_Y_faces_candidates.erase(newEnd, X_edges_Y_faces_candidates.end());
 
-    std::sort(Y_edges_X_faces_candidates.begin(), Y_edges_X_faces_candidates.end());
+    Aux::Alg::parallelSort(Y_edges_X_faces_candidates.begin(), Y_edges_X_faces_candidates.end(), nthreads);
     newEnd = std::unique(Y_edges_X_faces_candidates.begin(), Y_edges_X_faces_candidates.end());
     Y_edges_X_faces_candidates.erase(newEnd, Y_edges_X_faces_candidates.end());
 
@@ -625,7 +659,8 @@ MeshAlg::RedBlueAlgorithm(
     const bool                                             &keep_blue_outside_part,
     std::vector<
             typename Mesh<Tm, Tv, Tf, TR>::vertex_iterator
-        >                                                  *blue_update_its)
+        >                                                  *blue_update_its,
+    uint32_t                                                nthreads)
 {
     debugl(2, "MeshAlg::RedBlueAlgorithm(): keep_red_outside_part: %d, keep_blue_outside_part: %d.\n",
             keep_red_outside_part, keep_blue_outside_part);
@@ -647,7 +682,7 @@ MeshAlg::RedBlueAlgorithm(
     Aux::Timing::tick(15);
     debugl(1, "RedBlueAlgorithm(): getting pairs of potentially intersecting edges / faces.\n");
 
-    MeshAlg::getPotentiallyIntersectingEdgeFacePairs(R, B, R_edges_B_faces_candidates, B_edges_R_faces_candidates, 32, 8);
+    MeshAlg::getPotentiallyIntersectingEdgeFacePairs(R, B, R_edges_B_faces_candidates, B_edges_R_faces_candidates, 32, 8, nthreads);
 
     debugl(1, "RedBlueAlgorithm(): done getting pairs of potentially intersecting edges / faces. time: %5.4f\n\n", Aux::Timing::tack(15));
 
@@ -1003,9 +1038,10 @@ MeshAlg::RedBlueAlgorithm(
     debugl(3, "moveAppend()ing BLUE mesh B to RED mesh R. B is empty afterwards.\n");
     R.moveAppend(B);
 
-    /* merge all pairs of now "duplicate" intersection polygon corner vertices in R. */
+    /* merge all pairs of now "duplicate" intersection polygon corner vertices in R and tag the merged vertices as seam
+     * vertices. the faces incident to them are the faces created near the seam by RedBlue_cutHole(). */
     for (auto &p : RB_border_vertex_pairs) {
-        R.mergeUnrelatedVertices(p.first->iterator(), p.second->iterator());
+        R.mergeUnrelatedVertices(p.first->iterator(), p.second->iterator())->setSeam(true);
     }
 
     /* if desired by the caller, fill blue_update_its with (red) iterators of the corresponding vertices in the union
@@ -1045,13 +1081,14 @@ MeshAlg::RedBlueUnion(
     Mesh<Tm, Tv, Tf, TR>                               &B,
     std::vector<
             typename Mesh<Tm, Tv, Tf, TR>::vertex_iterator
-        >                                              *blue_update_its)
+        >                                              *blue_update_its,
+    uint32_t                                            nthreads)
 {
     debugl(1, "MeshAlg::RedBlueUnion()\n");
     debugTabInc();
 
     /* simple forward to RedBlueAlgorithm: keeping both OUTSIDE parts creates the union mesh */
-    try {MeshAlg::RedBlueAlgorithm(R, B, true, true, blue_update_its);}
+    try {MeshAlg::RedBlueAlgorithm(R, B, true, true, blue_update_its, nthreads);}
     catch (RedBlue_Ex&) {debugTabDec(); throw;}
     
     debugTabDec();
@@ -1066,14 +1103,15 @@ MeshAlg::RedBlueRedMinusBlue(
     Mesh<Tm, Tv, Tf, TR>                               &B,
     std::vector<
             typename Mesh<Tm, Tv, Tf, TR>::vertex_iterator
-        >                                              *blue_update_its)
+        >                                              *blue_update_its,
+    uint32_t                                            nthreads)
 {
     debugl(1, "MeshAlg::RedBlueRedMinusBlue()\n");
     debugTabInc();
 
     /* simple forward to RedBlueAlgorithm: for set diffrence, keep outside part of R, keep inside
      * part of B */
-    try {MeshAlg::RedBlueAlgorithm(R, B, true, false, blue_update_its);}
+    try {MeshAlg::RedBlueAlgorithm(R, B, true, false, blue_update_its, nthreads);}
     catch (RedBlue_Ex&) {debugTabDec(); throw;}
 
     debugTabDec();
@@ -1088,7 +1126,8 @@ MeshAlg::RedBlueIntersection(
     Mesh<Tm, Tv, Tf, TR>                               &B,
     std::vector<
             typename Mesh<Tm, Tv, Tf, TR>::vertex_iterator
-        >                                              *blue_update_its)
+        >                                              *blue_update_its,
+    uint32_t                                            nthreads)
 {
     debugl(1, "MeshAlg::RedBlueIntersection()\n");
     debugTabInc();
@@ -1097,7 +1136,7 @@ MeshAlg::RedBlueIntersection(
      * during the cutting with RedBlue_cutHole(), the inside parts are reoriented consistently.
      * however, only in the case of "set" intersection, the orientation of the result mesh has to
      * be inverted again to produce the usually desired orientation. */
-    try {MeshAlg::RedBlueAlgorithm(R, B, false, false, blue_update_its);}
+    try {MeshAlg::RedBlueAlgorithm(R, B, false, false, blue_update_its, nthreads);}
     catch (RedBlue_Ex&) {debugTabDec(); throw;}
 
     R.invertOrientation();
@@ -2004,6 +2043,69 @@ RedBlue_cutHole(
 }
 
 
+/* ---------------------------------------------------------------------------------------------- */
+/*                                                                                                */
+/*      post-processing: seam regions                                                             */
+/*                                                                                                */
+/* ---------------------------------------------------------------------------------------------- */
+template <typename Tm, typename Tv, typename Tf, typename R>
+void
+MeshAlg::getSeamRegion(
+    Mesh<Tm, Tv, Tf, R>            &M,
+    std::vector<uint32_t> const    &seam_vertex_ids,
+    uint32_t                        k,
+    std::vector<uint32_t>          &region)
+{
+    typedef typename Mesh<Tm, Tv, Tf, R>::Vertex    Vertex;
+    typedef typename Mesh<Tm, Tv, Tf, R>::Face      Face;
+
+    region.clear();
+
+    /* breadth-first search over the faces, ring by ring: ring 0 consists of the faces incident to the seam vertices,
+     * ring i + 1 of all unseen faces sharing a vertex with a face of ring i. */
+    std::unordered_set<Vertex const *>  seen_vertices;
+    std::unordered_set<uint32_t>        seen_faces;
+    std::vector<Vertex const *>         front;
+    std::vector<Face const *>           ring;
+
+    for (uint32_t v_id : seam_vertex_ids) {
+        auto v_it = M.vertices.find(v_id);
+        if (v_it != M.vertices.end() && seen_vertices.insert(&(*v_it)).second) {
+            front.push_back(&(*v_it));
+        }
+    }
+
+    for (uint32_t i = 0; i <= k && !front.empty(); i++) {
+        ring.clear();
+        for (Vertex const *v : front) {
+            for (Face const *f : v->getFaceStar()) {
+                if (seen_faces.insert(f->id()).second) {
+                    ring.push_back(f);
+                    region.push_back(f->id());
+                }
+            }
+        }
+
+        front.clear();
+        for (Face const *f : ring) {
+            Vertex *fv[4] = { NULL, NULL, NULL, NULL };
+            if (f->isQuad()) {
+                f->getQuadVertices(fv[0], fv[1], fv[2], fv[3]);
+            }
+            else {
+                f->getTriVertices(fv[0], fv[1], fv[2]);
+            }
+            for (Vertex const *v : fv) {
+                if (v && seen_vertices.insert(v).second) {
+                    front.push_back(v);
+                }
+            }
+        }
+    }
+
+    std::sort(region.begin(), region.end());
+}
+
 /* ---------------------------------------------------------------------------------------------- */
 /*                                                                                                */
 /*      post-processing: greedy edge collapse mesh optimisation / simplification                  */
@@ -2017,6 +2119,21 @@ GEC_getAvgAreaOfPermissibleSurroundingTriangles(
     R const                                        &max_ar,
     uint32_t                                        depth);
 
+template <typename Tm, typename Tv, typename Tf, typename R>
+inline R
+GEC_getAvgAreaOfPermissibleTriangles(
+    typename Mesh<Tm, Tv, Tf, R>::Face                         *tri,
+    std::vector<typename Mesh<Tm, Tv, Tf, R>::Face *> const    &surrounding_tris,
+    R const                                                    &max_ar,
+    uint32_t                                                    depth);
+
+template <typename Tm, typename Tv, typename Tf, typename R>
+void
+GEC_getFaceNeighbourhoodConcurrent(
+    typename Mesh<Tm, Tv, Tf, R>::Face                 *tri,
+    uint32_t                                            depth,
+    std::vector<typename Mesh<Tm, Tv, Tf, R>::Face *>  &nbhd);
+
 /* greedy edge collapsing of shortest edge of triangles sorted by aspect ratio.  additionally,
  * before reinserting affected triangles, check if their size is within the average of the
  * surrounding trinagles that have a valid ar, i.e. an ar < max_ar. if the triangle is too small,
@@ -2030,7 +2147,8 @@ MeshAlg::greedyEdgeCollapsePostProcessing(
     R const                &alpha,
     R const                &lambda,
     R const                &mu,
-    uint32_t                d)
+    uint32_t                d,
+    std::vector<uint32_t> const *region)
 {
     using namespace Aux::Timing;
     using Aux::Numbers::inf;
@@ -2064,9 +2182,15 @@ MeshAlg::greedyEdgeCollapsePostProcessing(
     /* define processing predicate for convenience */
     #define proc(ar, area, avg_nbhd_area, alpha, lambda, mu) (area < mu * avg_nbhd_area && (ar >= alpha || area < lambda * avg_nbhd_area) )
 
-    /* insert all "poor" triangles into Q, i.e. fill Q with the triangles that need processing */
+    /* insert all "poor" triangles into Q, i.e. fill Q with the triangles that need processing. if a region is given,
+     * only its triangles are considered. all other triangles get no entry in avg_surrounding_area, so their average
+     * area reads as zero below and they are never processed. */
     debugTabInc();
     for (auto &tri : M.faces) {
+        if (region && !std::binary_search(region->begin(), region->end(), tri.id())) {
+            continue;
+        }
+
         /* get triangle's aspect ratio, area and average over permissible triangles in the
          * d-neighbourhood of currently processed triangle */
         tri_ar                      = tri.getTriAspectRatio();
@@ -2279,6 +2403,219 @@ MeshAlg::greedyEdgeCollapsePostProcessing(
     debugl(1, "MeshAlg::greedyEdgeCollapsePostProcessing(): done.\n");
 }
 
+template <typename Tm, typename Tv, typename Tf, typename R>
+void
+MeshAlg::parallelGreedyEdgeCollapsePostProcessing(
+    Mesh<Tm, Tv, Tf, R>    &M,
+    R const                &alpha,
+    R const                &lambda,
+    R const                &mu,
+    uint32_t                d,
+    uint32_t                nthreads,
+    std::vector<uint32_t> const *region)
+{
+    typedef typename Mesh<Tm, Tv, Tf, R>::Face              Face;
+    typedef typename Mesh<Tm, Tv, Tf, R>::vertex_iterator   vertex_iterator;
+    typedef typename Mesh<Tm, Tv, Tf, R>::face_iterator     face_iterator;
+
+    debugl(1, "MeshAlg::parallelGreedyEdgeCollapsePostProcessing(): alpha: %f, lambda: %f, mu: %f, d: %d, nthreads: %d\n", alpha, lambda, mu, d, nthreads);
+    debugTabInc();
+
+    /* triangulate quads, if there are any.. */
+    M.triangulateQuads();
+
+    /* average areas of permissible triangles in the d-neighbourhoods of all faces, computed once as in the serial
+     * variant. collapsing only deletes faces, so the map is never modified afterwards and can be read concurrently. */
+    std::map<uint32_t, R>   avg_surrounding_area;
+    std::vector<uint32_t>   candidates;
+    {
+        std::vector<Face *> faces;
+        faces.reserve(region ? region->size() : M.faces.size());
+        for (auto &tri : M.faces) {
+            if (!region || std::binary_search(region->begin(), region->end(), tri.id())) {
+                faces.push_back(&tri);
+            }
+        }
+
+        std::vector<R>      avg(faces.size());
+        std::vector<char>   poor(faces.size());
+        Aux::Alg::parallelBlocks(faces.size(), 256, nthreads,
+            [&] (size_t b, size_t first, size_t last) -> void
+            {
+                std::vector<Face *> nbhd;
+                for (size_t i = first; i < last; i++) {
+                    GEC_getFaceNeighbourhoodConcurrent<Tm, Tv, Tf, R>(faces[i], d, nbhd);
+                    avg[i]  = GEC_getAvgAreaOfPermissibleTriangles<Tm, Tv, Tf, R>(faces[i], nbhd, alpha, d);
+                    poor[i] = proc(faces[i]->getTriAspectRatio(), faces[i]->getTriArea(), avg[i], alpha, lambda, mu);
+                }
+            }, 1);
+
+        for (size_t i = 0; i < faces.size(); i++) {
+            avg_surrounding_area.insert(avg_surrounding_area.end(), { faces[i]->id(), avg[i] });
+            if (poor[i]) {
+                candidates.push_back(faces[i]->id());
+            }
+        }
+    }
+
+    /* evaluation of one candidate triangle: processing predicate, shortest edge {u, v}, topological safety of its
+     * collapse as checked by Mesh::collapseTriEdge() and the one-rings of u and v, which the collapse modifies. */
+    struct Candidate {
+        uint32_t                id;
+        R                       ar;
+        bool                    poor;
+        bool                    safe;
+        vertex_iterator         u_it, v_it;
+        std::list<uint32_t>     region;
+    };
+
+    std::vector<uint32_t>   unsafe_tris, unsafe_tris_prev_iter;
+    bool                    fixed_point = false;
+    uint32_t                iter        = 0;
+
+    while (!fixed_point) {
+        debugl(3, "no fixed point reached yet => performing iteration %2d\n", iter);
+        unsafe_tris_prev_iter = unsafe_tris;
+        unsafe_tris.clear();
+
+        while (!candidates.empty()) {
+            /* look up the candidates that still exist */
+            std::vector<Candidate>  C;
+            std::vector<Face *>     C_faces;
+            for (uint32_t id : candidates) {
+                face_iterator tri_it = M.faces.find(id);
+                if (tri_it != M.faces.end()) {
+                    C.push_back(Candidate());
+                    C.back().id = id;
+                    C_faces.push_back(&(*tri_it));
+                }
+            }
+
+            /* evaluate all candidates concurrently. the mesh is not modified during this phase. */
+            Aux::Alg::parallelBlocks(C.size(), 64, nthreads,
+                [&] (size_t b, size_t first, size_t last) -> void
+                {
+                    std::list<uint32_t> u_nbs, v_nbs, shared_nbs;
+                    for (size_t i = first; i < last; i++) {
+                        Candidate  &c   = C[i];
+                        Face       *tri = C_faces[i];
+
+                        /* triangles outside the region have no average area and are never processed */
+                        auto const avg_it = avg_surrounding_area.find(c.id);
+                        c.ar    = tri->getTriAspectRatio();
+                        c.poor  = (avg_it != avg_surrounding_area.end())
+                                    && proc(c.ar, tri->getTriArea(), avg_it->second, alpha, lambda, mu);
+                        c.safe  = false;
+                        if (c.poor) {
+                            tri->getTriShortestEdge(c.u_it, c.v_it);
+                            c.u_it->getVertexStarIndices(u_nbs);
+                            c.v_it->getVertexStarIndices(v_nbs);
+                            c.safe = (Aux::Alg::listIntersection<uint32_t>(u_nbs, v_nbs, shared_nbs) == 2);
+                            if (c.safe) {
+                                c.region = u_nbs;
+                                c.region.insert(c.region.end(), v_nbs.begin(), v_nbs.end());
+                            }
+                        }
+                    }
+                }, 1);
+
+            /* process in order of decreasing aspect ratio, ties broken by id */
+            std::vector<uint32_t> order;
+            for (uint32_t i = 0; i < C.size(); i++) {
+                if (C[i].poor) {
+                    order.push_back(i);
+                }
+            }
+            std::sort(order.begin(), order.end(),
+                [&C] (uint32_t x, uint32_t y) -> bool
+                {
+                    return (C[x].ar > C[y].ar || (C[x].ar == C[y].ar && C[x].id < C[y].id));
+                });
+
+            /* select a maximal set of safe collapses with disjoint regions. u and v are contained in each other's
+             * one-ring, so the region contains the collapsed edge as well. disjoint regions guarantee that no
+             * collapse changes the vertex stars or the triangles examined by another one. */
+            std::unordered_set<uint32_t>    marked;
+            std::vector<uint32_t>           selected, next;
+            for (uint32_t i : order) {
+                Candidate &c = C[i];
+                if (!c.safe) {
+                    debugl(3, "collapse unsafe, pushing triangle %5d to unsafe tri list..\n", c.id);
+                    unsafe_tris.push_back(c.id);
+                    continue;
+                }
+
+                bool independent = true;
+                for (uint32_t x : c.region) {
+                    if (marked.count(x)) {
+                        independent = false;
+                        break;
+                    }
+                }
+
+                if (independent) {
+                    marked.insert(c.region.begin(), c.region.end());
+                    selected.push_back(i);
+                }
+                else {
+                    next.push_back(c.id);
+                }
+            }
+
+            /* perform the selected collapses. the faces incident to all new vertices are re-evaluated in the next
+             * round, as are the deferred candidates. */
+            vertex_iterator                 w_it;
+            std::list<face_iterator>        w_fstar;
+            bool                            collapsed = false;
+            for (uint32_t i : selected) {
+                if (M.collapseTriEdge(C[i].u_it, C[i].v_it, &w_it, NULL)) {
+                    collapsed = true;
+                    w_it->getFaceStarIterators(w_fstar);
+                    for (auto &w_inc_tri : w_fstar) {
+                        if (!w_inc_tri->isTri()) {
+                            throw ("MeshAlg::parallelGreedyEdgeCollapsePostProcessing(): discovered non-triangle face. only triangular meshes are supported.");
+                        }
+                        next.push_back(w_inc_tri->id());
+                    }
+                }
+                else {
+                    unsafe_tris.push_back(C[i].id);
+                }
+            }
+
+            /* as in the serial variant, all unsafe triangles are reconsidered after successful collapses */
+            if (collapsed) {
+                next.insert(next.end(), unsafe_tris.begin(), unsafe_tris.end());
+                unsafe_tris.clear();
+            }
+
+            std::sort(next.begin(), next.end());
+            next.erase(std::unique(next.begin(), next.end()), next.end());
+            candidates.swap(next);
+        }
+
+        std::sort(unsafe_tris.begin(), unsafe_tris.end());
+        unsafe_tris.erase(std::unique(unsafe_tris.begin(), unsafe_tris.end()), unsafe_tris.end());
+
+        /* fixed point reached iff the unsafe triangles have not changed. otherwise, retry the existing ones. */
+        if (unsafe_tris == unsafe_tris_prev_iter) {
+            fixed_point = true;
+        }
+        else {
+            for (uint32_t tri_id : unsafe_tris) {
+                if (M.faces.find(tri_id) != M.faces.end()) {
+                    candidates.push_back(tri_id);
+                }
+            }
+        }
+        iter++;
+    }
+    debugl(3, "fixed point reached. returning...\n");
+
+    debugTabDec();
+    debugl(1, "MeshAlg::parallelGreedyEdgeCollapsePostProcessing(): done.\n");
+}
+
 
 template <typename Tm, typename Tv, typename Tf, typename R>
 inline R
@@ -2286,6 +2623,58 @@ GEC_getAvgAreaOfPermissibleSurroundingTriangles(
     typename Mesh<Tm, Tv, Tf, R>::face_iterator     tri_it,
     R const                                        &max_ar,
     uint32_t                                        depth)
+{
+    /* get face-neighbourhood of depth "depth" for triangle tri_it */
+    std::vector<typename Mesh<Tm, Tv, Tf, R>::Face *> surrounding_tris;
+    tri_it->getFaceNeighbourhood(depth, surrounding_tris);
+
+    return GEC_getAvgAreaOfPermissibleTriangles<Tm, Tv, Tf, R>(&(*tri_it), surrounding_tris, max_ar, depth);
+}
+
+/* face neighbourhood of depth "depth" of tri in the same order as Mesh::Face::getFaceNeighbourhood(), but with
+ * local bookkeeping instead of the traversal states stored in the faces, so it can run on several threads. */
+template <typename Tm, typename Tv, typename Tf, typename R>
+void
+GEC_getFaceNeighbourhoodConcurrent(
+    typename Mesh<Tm, Tv, Tf, R>::Face                 *tri,
+    uint32_t                                            depth,
+    std::vector<typename Mesh<Tm, Tv, Tf, R>::Face *>  &nbhd)
+{
+    typedef typename Mesh<Tm, Tv, Tf, R>::Face Face;
+
+    std::queue<std::pair<Face *, uint32_t>> Q;
+    std::unordered_set<Face *>              seen;
+    std::vector<Face *>                     f_neighbours;
+
+    nbhd.clear();
+    Q.push({tri, 0});
+    seen.insert(tri);
+
+    while (!Q.empty()) {
+        Face           *f       = Q.front().first;
+        uint32_t const  f_depth = Q.front().second;
+        Q.pop();
+
+        nbhd.push_back(f);
+        if (f_depth <= depth) {
+            f_neighbours.clear();
+            f->getFaceNeighbours(f_neighbours);
+            for (Face *nb : f_neighbours) {
+                if (seen.insert(nb).second) {
+                    Q.push({nb, f_depth + 1});
+                }
+            }
+        }
+    }
+}
+
+template <typename Tm, typename Tv, typename Tf, typename R>
+inline R
+GEC_getAvgAreaOfPermissibleTriangles(
+    typename Mesh<Tm, Tv, Tf, R>::Face                         *tri,
+    std::vector<typename Mesh<Tm, Tv, Tf, R>::Face *> const    &surrounding_tris,
+    R const                                                    &max_ar,
+    uint32_t                                                    depth)
 {
     debugl(4, "GEC_getAvgAreaOfPermissibleSurroundingTriangles()\n");
     debugTabInc();
@@ -2293,12 +2682,8 @@ GEC_getAvgAreaOfPermissibleSurroundingTriangles(
     R           nbtri_ar, nbtri_area, avg_area;
     uint32_t    npermissible_triangles;
 
-    /* get face-neighbourhood of depth "depth" for triangle tri_it */
-    std::vector<typename Mesh<Tm, Tv, Tf, R>::Face *> surrounding_tris;
-    tri_it->getFaceNeighbourhood(depth, surrounding_tris);
-
     /* get average area of all permissible triangles in the depth-neighbourhood of the face
-     * tri_it */
+     * tri */
     avg_area                = 0.0;
     npermissible_triangles  = 0;
     for (auto &nbtri : surrounding_tris) {
@@ -2314,10 +2699,10 @@ GEC_getAvgAreaOfPermissibleSurroundingTriangles(
 
     if (npermissible_triangles == 0) {
         debugl(1, "MeshAlg::GEC_getAvgAreaOfPermissibleSurroundingTriangles(): WARNING: triangle %d: can't compute average, since no %5.4f-permissible triangle found in the %d-neighbour of %d. returning area %5.4f as \"average\"\n.",
-            tri_it->id(), max_ar, depth, tri_it->id(), tri_it->getTriArea());
+            tri->id(), max_ar, depth, tri->id(), tri->getTriArea());
 
         debugTabDec();
-        return (tri_it->getTriArea());
+        return (tri->getTriArea());
     }
     else {
         debugTabDec();
@@ -2326,6 +2711,255 @@ GEC_getAvgAreaOfPermissibleSurroundingTriangles(
     }
 }
 
+/* ---------------------------------------------------------------------------------------------- */
+/*                                                                                                */
+/*                          post-processing: quadric error metric decimation                      */
+/*                                                                                                */
+/* ---------------------------------------------------------------------------------------------- */
+/* symmetric 4x4 error quadric, stored as its upper triangle a11 a12 a13 a14 a22 a23 a24 a33 a34 a44 */
+template <typename R>
+struct QEM_Quadric {
+    R   a[10];
+
+    QEM_Quadric()
+    {
+        std::fill(a, a + 10, 0.0);
+    }
+
+    /* add the squared distance to the plane n * x + d = 0 with unit normal n, weighted by w */
+    void
+    addPlane(
+        Vec3<R> const  &n,
+        R               d,
+        R               w)
+    {
+        a[0] += w*n[0]*n[0];    a[1] += w*n[0]*n[1];    a[2] += w*n[0]*n[2];    a[3] += w*n[0]*d;
+        a[4] += w*n[1]*n[1];    a[5] += w*n[1]*n[2];    a[6] += w*n[1]*d;
+        a[7] += w*n[2]*n[2];    a[8] += w*n[2]*d;
+        a[9] += w*d*d;
+    }
+
+    QEM_Quadric &
+    operator+=(QEM_Quadric const &o)
+    {
+        for (uint32_t i = 0; i < 10; i++) {
+            a[i] += o.a[i];
+        }
+        return *this;
+    }
+
+    R
+    eval(Vec3<R> const &x) const
+    {
+        return (      a[0]*x[0]*x[0] + 2.0*a[1]*x[0]*x[1] + 2.0*a[2]*x[0]*x[2] + 2.0*a[3]*x[0]
+                    + a[4]*x[1]*x[1] + 2.0*a[5]*x[1]*x[2] + 2.0*a[6]*x[1]
+                    + a[7]*x[2]*x[2] + 2.0*a[8]*x[2]
+                    + a[9] );
+    }
+
+    /* minimizer of the quadric, if the 3x3 system is well-conditioned */
+    bool
+    minimizer(Vec3<R> &x) const
+    {
+        R const c00 = a[4]*a[7] - a[5]*a[5];
+        R const c01 = a[2]*a[5] - a[1]*a[7];
+        R const c02 = a[1]*a[5] - a[2]*a[4];
+        R const det = a[0]*c00 + a[1]*c01 + a[2]*c02;
+        R const tr  = a[0] + a[4] + a[7];
+
+        if (std::fabs(det) <= 1E-10 * tr*tr*tr) {
+            return false;
+        }
+
+        R const c11 = a[0]*a[7] - a[2]*a[2];
+        R const c12 = a[1]*a[2] - a[0]*a[5];
+        R const c22 = a[0]*a[4] - a[1]*a[1];
+
+        /* x = -A^-1 b with the symmetric adjugate of A */
+        x[0] = -(c00*a[3] + c01*a[6] + c02*a[8]) / det;
+        x[1] = -(c01*a[3] + c11*a[6] + c12*a[8]) / det;
+        x[2] = -(c02*a[3] + c12*a[6] + c22*a[8]) / det;
+        return true;
+    }
+};
+
+/* cost and target position of collapsing edge {u, v}: the minimizer of the summed quadric, or the best of u, v and
+ * their midpoint if the minimizer is not well-defined. */
+template <typename R>
+R
+QEM_edgeCost(
+    QEM_Quadric<R> const   &Qu,
+    QEM_Quadric<R> const   &Qv,
+    Vec3<R> const          &u_pos,
+    Vec3<R> const          &v_pos,
+    Vec3<R>                &pos)
+{
+    QEM_Quadric<R> Q = Qu;
+    Q += Qv;
+
+    if (!Q.minimizer(pos)) {
+        Vec3<R> const   cand[3] = { u_pos, v_pos, (u_pos + v_pos) * 0.5 };
+        R               cost    = Aux::Numbers::inf<R>();
+        for (auto &c : cand) {
+            R const cc = Q.eval(c);
+            if (cc < cost) {
+                cost    = cc;
+                pos     = c;
+            }
+        }
+    }
+    return std::max<R>(Q.eval(pos), 0.0);
+}
+
+template <typename Tm, typename Tv, typename Tf, typename R>
+void
+MeshAlg::quadricErrorDecimation(
+    Mesh<Tm, Tv, Tf, R>    &M,
+    uint32_t                target_faces,
+    R const                &max_error)
+{
+    typedef typename Mesh<Tm, Tv, Tf, R>::Face              Face;
+    typedef typename Mesh<Tm, Tv, Tf, R>::Vertex            Vertex;
+    typedef typename Mesh<Tm, Tv, Tf, R>::vertex_iterator   vertex_iterator;
+
+    debugl(1, "MeshAlg::quadricErrorDecimation(): target_faces: %d, max_error: %f\n", target_faces, max_error);
+    debugTabInc();
+
+    M.triangulateQuads();
+
+    /* vertex quadrics: sum of the area-weighted plane quadrics of all incident triangles */
+    std::unordered_map<uint32_t, QEM_Quadric<R>> Q;
+    Q.reserve(M.vertices.size());
+    for (auto &tri : M.faces) {
+        Vec3<R>     v0, v1, v2;
+        uint32_t    v0_id, v1_id, v2_id;
+
+        tri.getTriPositions(v0, v1, v2);
+        tri.getTriIndices(v0_id, v1_id, v2_id);
+
+        Vec3<R> n       = (v1 - v0).cross(v2 - v0);
+        R const n_len   = n.len2();
+        if (n_len > 0.0) {
+            n /= n_len;
+            R const d = -(n * v0);
+            Q[v0_id].addPlane(n, d, n_len / 2.0);
+            Q[v1_id].addPlane(n, d, n_len / 2.0);
+            Q[v2_id].addPlane(n, d, n_len / 2.0);
+        }
+    }
+
+    /* edges are identified by their sorted vertex ids packed into 64 bits. the ids of collapsed vertices may be taken
+     * by new vertices, whose edges are all (re)inserted, which updates the cost of an entry with the same key. entries
+     * of edges that no longer exist are discarded lazily. */
+    PriorityQueue<R, uint64_t>  E;
+    Vec3<R>                     pos;
+    std::vector<uint32_t>       nb_ids;
+
+    auto edgeKey = [] (uint32_t u, uint32_t v) -> uint64_t
+    {
+        return (u < v) ? (((uint64_t)u << 32) | v) : (((uint64_t)v << 32) | u);
+    };
+
+    auto insertEdges = [&] (Vertex const &u) -> void
+    {
+        u.getVertexStarIndicesVector(nb_ids);
+        for (uint32_t v_id : nb_ids) {
+            vertex_iterator v_it = M.vertices.find(v_id);
+            E.insert(QEM_edgeCost(Q[u.id()], Q[v_id], u.pos(), v_it->pos(), pos), edgeKey(u.id(), v_id));
+        }
+    };
+
+    for (auto &u : M.vertices) {
+        u.getVertexStarIndicesVector(nb_ids);
+        for (uint32_t v_id : nb_ids) {
+            if (u.id() < v_id) {
+                E.insert(QEM_edgeCost(Q[u.id()], Q[v_id], u.pos(), M.vertices.find(v_id)->pos(), pos), edgeKey(u.id(), v_id));
+            }
+        }
+    }
+
+    /* true if the orientation of triangle f, which contains vertex x_id, flips when x is moved to pos */
+    auto flips = [&pos] (uint32_t x_id, Face const *f) -> bool
+    {
+        Vec3<R>     v[3], w[3];
+        uint32_t    ids[3];
+
+        f->getTriPositions(v[0], v[1], v[2]);
+        f->getTriIndices(ids[0], ids[1], ids[2]);
+        for (uint32_t i = 0; i < 3; i++) {
+            w[i] = (ids[i] == x_id) ? pos : v[i];
+        }
+        Vec3<R> const n_old = (v[1] - v[0]).cross(v[2] - v[0]);
+        Vec3<R> const n_new = (w[1] - w[0]).cross(w[2] - w[0]);
+        return (n_old * n_new <= 0.0);
+    };
+
+    uint32_t ncollapsed = 0;
+    while (M.numFaces() > target_faces && !E.empty()) {
+        std::pair<R, uint64_t> const e = E.top();
+        E.deleteMin();
+
+        if (e.first > max_error) {
+            debugl(2, "next collapse exceeds max_error. stopping.\n");
+            break;
+        }
+
+        /* discard edges that no longer exist */
+        vertex_iterator u_it = M.vertices.find((uint32_t)(e.second >> 32));
+        vertex_iterator v_it = M.vertices.find((uint32_t)(e.second & 0xFFFFFFFF));
+        if (u_it == M.vertices.end() || v_it == M.vertices.end()) {
+            continue;
+        }
+
+        auto const &u_star = u_it->getVertexStar();
+        if (std::find(u_star.begin(), u_star.end(), &(*v_it)) == u_star.end()) {
+            continue;
+        }
+
+        /* only manifold edges with two incident triangles are collapsed */
+        Face   *uv_faces[8];
+        size_t  nuv_faces = 8;
+        M.getFacesIncidentToEdge(u_it, v_it, uv_faces, nuv_faces);
+        if (nuv_faces != 2) {
+            continue;
+        }
+
+        uint32_t const u_id = u_it->id(), v_id = v_it->id();
+        QEM_edgeCost(Q[u_id], Q[v_id], u_it->pos(), v_it->pos(), pos);
+
+        /* reject collapses that fold over any of the remaining triangles around u and v */
+        bool flip = false;
+        for (Vertex const *x : { &(*u_it), &(*v_it) }) {
+            for (Face const *f : x->getFaceStar()) {
+                if (f != uv_faces[0] && f != uv_faces[1] && flips(x->id(), f)) {
+                    flip = true;
+                    break;
+                }
+            }
+        }
+        if (flip) {
+            continue;
+        }
+
+        /* topologically unsafe collapses are skipped. the edge is reconsidered if a neighbouring collapse creates it
+         * anew. */
+        vertex_iterator w_it;
+        if (M.collapseTriEdge(u_it, v_it, &w_it, &pos)) {
+            QEM_Quadric<R> Qw = Q[u_id];
+            Qw += Q[v_id];
+            Q.erase(u_id);
+            Q.erase(v_id);
+            Q[w_it->id()] = Qw;
+
+            insertEdges(*w_it);
+            ncollapsed++;
+        }
+    }
+
+    debugTabDec();
+    debugl(1, "MeshAlg::quadricErrorDecimation(): done. collapses: %d, faces: %d\n", ncollapsed, M.numFaces());
+}
+
 /* ---------------------------------------------------------------------------------------------- */
 /*                                                                                                */
 /*                                post-processing: mesh smoothing algorithms                      */
@@ -2390,107 +3024,181 @@ MeshAlg::HCLaplacianSmoothing(
     Mesh<Tm, Tv, Tf, R>    &M,
     R const                &alpha,
     R const                &beta,
-    uint32_t                maxiter)
+    uint32_t                maxiter,
+    uint32_t                nthreads,
+    std::vector<uint32_t> const *region)
 {
-    uint32_t                                iter, m;
-
-    /* for vertex displacement calculation, a simple discrete version of the laplacian is used, the umbrella operator.
-     * dxi = 1/num_neighbours SUM_{all neighbours x_}{x_i - x_j}, so, the centroid the x_i's neighbours. */
-    std::vector<uint32_t>                                    vi_nbs_ids;
-
-    /* original vertex coordinates */
-    std::vector<Vec3<R> > o;
-
-    /* vertex coordinates before the step */
-    std::vector<Vec3<R> > q;
-
-    /* vertex coordinates after the step */
-    std::vector<Vec3<R> > p;
-
-    /* correction offsets, pushing back the vertices to a weighted sum of original and previous
-     * position to avoid volume shrinkage */
-    std::vector<Vec3<R> > b;
-
-    /* initialize original coordinates o and current coordinates q: prior to the first step,
-     * q = o */
-    size_t vsz = M.vertices.size();
-    o.resize(vsz);
-    p.resize(vsz);
-    q.resize(vsz);
-    b.resize(vsz);
-    std::map<uint32_t, size_t> indexMap;
-    size_t i = 0;
-    for (auto& v : M.vertices)
-    {
-        o[i] = q[i] = v.pos();
-        indexMap[v.id()] = i;
-        ++i;
+    typedef typename Mesh<Tm, Tv, Tf, R>::Vertex Vertex;
+
+    /* the mesh is converted once into a compressed sparse row (CSR) adjacency and structure-of-arrays coordinates,
+     * all sweeps run on these arrays and the positions are written back at the end. vertex i is the i-th vertex of
+     * M.vertices, i.e. vertices are numbered in id order. */
+    size_t const            vsz = M.vertices.size();
+    std::vector<Vertex *>   verts;
+    std::vector<uint32_t>   ids;
+    verts.reserve(vsz);
+    ids.reserve(vsz);
+    for (auto &v : M.vertices) {
+        verts.push_back(&v);
+        ids.push_back(v.id());
     }
 
-    for (iter = 0; iter < maxiter; iter++)
+    auto index = [&ids] (uint32_t id) -> uint32_t
     {
-        i = 0;
-        for (auto &vi : M.vertices)
+        return (std::lower_bound(ids.begin(), ids.end(), id) - ids.begin());
+    };
+
+    /* two adjacencies are needed to reproduce the original operator exactly: the umbrella operator averages over the
+     * adjacency list including multiple entries in list order ("star"), the correction over the sorted distinct
+     * neighbours ("nbs"). */
+    std::vector<size_t>     star_off(vsz + 1, 0), nbs_off(vsz + 1, 0);
+    std::vector<uint32_t>   star_idx, nbs_idx;
+
+    size_t const block_len = 4096;
+    Aux::Alg::parallelBlocks(vsz, block_len, nthreads,
+        [&] (size_t b, size_t first, size_t last) -> void
         {
-            /* get vertex id, vertex star and vertex star size */
-            const std::list<typename Mesh<Tm, Tv, Tf, R>::Vertex *>& vi_nbs = vi.getVertexStar();
-            m = vi_nbs.size();
-             
-            /* throw exception here? isolated vertex .. */
-            if (m > 0) {
-                /* compute new position with "umbrella" discrete laplacian operator, store in
-                 * temporary xi_new. */
-                p[i] = Aux::VecMat::nullvec<R>();
-                for (auto &w : vi_nbs) {
-                    p[i] += w->pos();
+            std::vector<uint32_t> nb_ids;
+            for (size_t i = first; i < last; i++) {
+                verts[i]->getVertexStarIndicesVector(nb_ids);
+                star_off[i + 1] = verts[i]->getVertexStar().size();
+                nbs_off[i + 1]  = nb_ids.size();
+            }
+        }, 1);
+
+    for (size_t i = 0; i < vsz; i++) {
+        star_off[i + 1] += star_off[i];
+        nbs_off[i + 1]  += nbs_off[i];
+    }
+
+    /* if a region is given, only the vertices of its (remaining) faces are moved, all others are kept fixed. */
+    std::vector<char> movable(vsz, region ? 0 : 1);
+    if (region) {
+        for (uint32_t f_id : *region) {
+            auto f_it = M.faces.find(f_id);
+            if (f_it != M.faces.end()) {
+                std::array<uint32_t, 4> f_vids = {{ 0, 0, 0, 0 }};
+                if (f_it->isQuad()) {
+                    f_it->getQuadIndices(f_vids[0], f_vids[1], f_vids[2], f_vids[3]);
+                }
+                else {
+                    f_it->getTriIndices(f_vids[0], f_vids[1], f_vids[2]);
+                    f_vids[3] = f_vids[2];
+                }
+                for (uint32_t v_id : f_vids) {
+                    movable[index(v_id)] = 1;
                 }
-                p[i] /= (R) m;
-
-                /* compute offset value b[i] for vertex i */
-                b[i] = p[i] - ( o[i]*alpha + q[i]*(1.0 - alpha) );
             }
-
-            ++i;
         }
+    }
+    star_idx.resize(star_off[vsz]);
+    nbs_idx.resize(nbs_off[vsz]);
 
-        /* iterate over all vertices again, correct new position p[i] with offsets b[j] of the
-         * neighbours AND the offset value for the currently processed "centre" vertex vi
-         * itself.. */
-        Vec3<R> p_i_correction;
-        R       nbfactor;
-        i = 0;
-        for (auto &vi : M.vertices)
+    Aux::Alg::parallelBlocks(vsz, block_len, nthreads,
+        [&] (size_t b, size_t first, size_t last) -> void
         {
-            vi.getVertexStarIndicesVector(vi_nbs_ids);
-            m = vi_nbs_ids.size();
+            std::vector<uint32_t> nb_ids;
+            for (size_t i = first; i < last; i++) {
+                size_t k = star_off[i];
+                for (Vertex *w : verts[i]->getVertexStar()) {
+                    star_idx[k++] = index(w->id());
+                }
 
-            /* throw exception here? isolated vertex .. */
-            if (m > 0) {
-                p_i_correction  = b[i] * beta;
-                nbfactor        = (1.0 - beta) / (R)m;
-
-                for (uint32_t w_id : vi_nbs_ids) {
-                    p_i_correction += (b[indexMap[w_id]] * nbfactor);
+                verts[i]->getVertexStarIndicesVector(nb_ids);
+                k = nbs_off[i];
+                for (uint32_t w_id : nb_ids) {
+                    nbs_idx[k++] = index(w_id);
                 }
-
-                vi.pos() = p[i] - p_i_correction;
             }
+        }, 1);
+
+    /* per coordinate d: original coordinates o, coordinates before the step q, coordinates after the step p,
+     * current coordinates x and correction offsets b, which push back the vertices to a weighted sum of original and
+     * previous position to avoid volume shrinkage. prior to the first step, q = o. */
+    typedef std::array<std::vector<R>, 3> SoA;
+    SoA o, q, p, x, b;
+    for (uint32_t d = 0; d < 3; d++) {
+        o[d].resize(vsz);
+        p[d].assign(vsz, 0.0);
+        b[d].assign(vsz, 0.0);
+        for (size_t i = 0; i < vsz; i++) {
+            o[d][i] = verts[i]->pos()[d];
+        }
+        q[d] = o[d];
+        x[d] = o[d];
+    }
+
+    for (uint32_t iter = 0; iter < maxiter; iter++) {
+        /* first sweep: new position p[i] with the "umbrella" discrete laplacian operator, i.e. the centroid of vi's
+         * neighbours, and offset b[i]. isolated vertices are skipped. */
+        Aux::Alg::parallelBlocks(vsz, block_len, nthreads,
+            [&] (size_t blk, size_t first, size_t last) -> void
+            {
+                for (uint32_t d = 0; d < 3; d++) {
+                    R const        *xd  = x[d].data();
+                    R const        *od  = o[d].data();
+                    R const        *qd  = q[d].data();
+                    R              *pd  = p[d].data();
+                    R              *bd  = b[d].data();
+
+                    for (size_t i = first; i < last; i++) {
+                        size_t const m = star_off[i + 1] - star_off[i];
+                        if (!movable[i]) {
+                            /* fixed vertex: stays in place and pushes back none of its neighbours */
+                            pd[i] = xd[i];
+                            bd[i] = 0.0;
+                        }
+                        else if (m > 0) {
+                            R sum = 0.0;
+                            for (size_t k = star_off[i]; k < star_off[i + 1]; k++) {
+                                sum += xd[star_idx[k]];
+                            }
+                            pd[i] = sum / (R)m;
+                            bd[i] = pd[i] - ( od[i]*alpha + qd[i]*(1.0 - alpha) );
+                        }
+                    }
+                }
+            });
 
-            ++i;
-        }
+        /* second sweep: correct p[i] with the offsets b[j] of the neighbours and the offset of vi itself */
+        Aux::Alg::parallelBlocks(vsz, block_len, nthreads,
+            [&] (size_t blk, size_t first, size_t last) -> void
+            {
+                for (uint32_t d = 0; d < 3; d++) {
+                    R const        *pd  = p[d].data();
+                    R const        *bd  = b[d].data();
+                    R              *xd  = x[d].data();
+
+                    for (size_t i = first; i < last; i++) {
+                        size_t const m = nbs_off[i + 1] - nbs_off[i];
+                        if (m > 0 && movable[i]) {
+                            R const nbfactor        = (1.0 - beta) / (R)m;
+                            R       p_i_correction  = bd[i] * beta;
+                            for (size_t k = nbs_off[i]; k < nbs_off[i + 1]; k++) {
+                                p_i_correction += bd[nbs_idx[k]] * nbfactor;
+                            }
+                            xd[i] = pd[i] - p_i_correction;
+                        }
+                    }
+                }
+            });
 
         // update q
         q.swap(p);
     }
+
+    /* write back positions */
+    for (size_t i = 0; i < vsz; i++) {
+        verts[i]->pos() = Vec3<R>(x[0][i], x[1][i], x[2][i]);
+    }
 }
 
 #endif
 
 template <typename Tm, typename Tv, typename Tf, typename R>
 void
-MeshAlg::partialFlushToObjFile(
+MeshAlg::partialFlush(
     Mesh<Tm, Tv, Tf, R>                                        &M,
-    std::pair<FILE **, std::string> const                      &obj_file_info,
     std::list<typename Mesh<Tm, Tv, Tf, R>::Face *>            &face_list,
     std::list<
             std::pair<
@@ -2505,32 +3213,22 @@ MeshAlg::partialFlushToObjFile(
                 uint32_t          
             >
         >                                                      &out_boundary_vertices,
-    uint32_t                                                   &out_last_flush_vertex_id)
+    uint32_t                                                   &out_last_flush_vertex_id,
+    std::function<
+            void(
+                std::vector<Vec3<R>>                           &new_vertex_positions,
+                std::vector<std::array<uint32_t, 4>>           &flush_faces,
+                std::vector<
+                        std::array<typename Mesh<Tm, Tv, Tf, R>::Vertex *, 4>
+                    >                                          &flush_face_vertices)
+        > const                                                &write)
 {
+    typedef typename Mesh<Tm, Tv, Tf, R>::Vertex Vertex;
+
     debugl(1, "MeshAlg::partialFlush().\n");
     debugTabInc();
     /* copy out information about all faces in face_list, the list of faces to be flushed, and subsequently delete them
-     * in M. */
-
-    /* struct to hold information about face */
-    struct IdFace {
-        bool                    quad;
-        std::vector<uint32_t>   v_ids;
-
-        IdFace(
-            bool                            _quad,
-            const std::vector<uint32_t>&    _v_ids)
-        : quad(_quad), v_ids(_v_ids)
-        {
-            if (    (this->quad && v_ids.size() != 4) ||
-                    (!this->quad && v_ids.size() != 3) )
-            {
-                debugl(1, "ERROR: quad: %d. v_ids.size(): %d\n", quad, v_ids.size());
-                throw("MeshAlg::partialFlush(..)::IdFace::IdFace(): given vertex index vector has wrong size (neither tri / 3 nor quad / 4). internal logic error.");
-            }
-        }
-    };
-
+     * in M. faces are stored by their vertices, the last one being NULL for triangles. */
     debugl(1, "in_boundary_vertices.size(): %zu. in_last_flush_vertex_id: %d, face_list.size(): %zu\n",
         in_boundary_vertices.size(), in_last_flush_vertex_id, face_list.size());
 
@@ -2542,18 +3240,22 @@ MeshAlg::partialFlushToObjFile(
     debugTabDec();
 #endif
 
-    std::list<IdFace> flush_face_list;
+    std::vector<std::array<Vertex *, 4>> flush_face_vertices;
+    flush_face_vertices.reserve(face_list.size());
     for (auto &f : face_list) {
+        std::array<Vertex *, 4> fv;
         if (f->isQuad()) {
-            flush_face_list.push_back({ true, f->getIndices() });
+            f->getQuadVertices(fv[0], fv[1], fv[2], fv[3]);
         }
         else if (f->isTri()) {
-            flush_face_list.push_back({ false, f->getIndices() });
+            f->getTriVertices(fv[0], fv[1], fv[2]);
+            fv[3] = NULL;
         }
         else {
             debugTabDec();
             throw("MeshAlg::partialFlush(): discovered face that is neither quad nor triangle. flushing not (yet) supported.");
         }
+        flush_face_vertices.push_back(fv);
 
         M.faces.erase(f->iterator());
     }
@@ -2634,8 +3336,8 @@ MeshAlg::partialFlushToObjFile(
     debugl(1, "after sort: new_isolated_vertices.size(): %zu, new_boundary_vertices.size(): %zu.\n",
             new_isolated_vertices.size(), new_boundary_vertices.size());
 
-    /* consecutively number all new isolated vertices and new boundary vertices. compile id replacement map and update
-     * flush_face_list ids */
+    /* consecutively number all new isolated vertices and new boundary vertices. compile id replacement map and compute
+     * flush ids of all flushed faces */
     uint32_t                        last_flush_vertex_id = in_last_flush_vertex_id;
 
     /* initialize id replacement map. associate mesh ids of all in_boundary_vertices with flush ids. number all new
@@ -2663,153 +3365,190 @@ MeshAlg::partialFlushToObjFile(
     /* write out_last_vertex_id back to the caller. */
     out_last_flush_vertex_id = last_flush_vertex_id;
 
-    /* replace all indices in flush_face_list using the generated id map above. */
-    debugl(1, "replacing vertex indices in all flush faces with flush indices..\n"); 
-    debugTabInc();
-    for (auto &f : flush_face_list) {
-        debugl(2, "replacing ids in face (%d, %d, %d)\n", f.v_ids[0], f.v_ids[1], f.v_ids[2]);
-        for (auto &id : f.v_ids) {
-            auto it = id_replace_map.find(id);
+    /* compute flush ids of all flushed faces using the generated id map above. */
+    debugl(1, "computing flush indices of all flush faces..\n"); 
+    std::vector<std::array<uint32_t, 4>> flush_faces;
+    flush_faces.reserve(flush_face_vertices.size());
+    for (auto &fv : flush_face_vertices) {
+        std::array<uint32_t, 4> ids;
+        for (uint32_t k = 0; k < 4; k++) {
+            if (!fv[k]) {
+                ids[k] = UINT32_MAX;
+                continue;
+            }
+
+            auto it = id_replace_map.find(fv[k]->id());
             if (it != id_replace_map.end()) {
-                id = it->second;
+                ids[k] = it->second;
             }
             else {
-                debugTabDec(); debugTabDec();
+                debugTabDec();
                 throw("MeshAlgorithms::partialFlush(): failed to locate vertex index in id_replace_map. internal logic error.");
             }
         }
-        debugl(2, "replaced ids: (%d, %d, %d)\n", f.v_ids[0], f.v_ids[1], f.v_ids[2]);
+        flush_faces.push_back(ids);
+    }
+
+    /* new vertex positions in flush id order */
+    std::vector<Vec3<R>> new_vertex_positions;
+    new_vertex_positions.reserve(new_isolated_vertices.size() + new_boundary_vertices.size());
+    for (auto &vp : new_isolated_vertices) {
+        new_vertex_positions.push_back(vp.first->pos());
+    }
+    for (auto &vp : new_boundary_vertices) {
+        new_vertex_positions.push_back(vp.first->pos());
+    }
+
+    /* write new isolated vertices (with correct id), all NEW boundary vertices and all faces. as part of the
+     * invariant, all old boundary vertices had already been written when the call started. */
+    try {
+        write(new_vertex_positions, flush_faces, flush_face_vertices);
+    }
+    catch (...) {
+        debugTabDec();
+        throw;
+    }
+
+    debugl(2, "finishing invariants ..\n");
+
+    /* write out_boundary_vertices for the caller: out_boundary_vertices is the union of new_boundary_vertices and all
+     * old boundary vertices that have not become isolated. since a boundary vertex can either stay a boundary vertex or
+     * become isolated (losing the boundary status) and no vertices have yet been deleted (and thus all pointers are
+     * still intact), it's possible to simply iterate over in_boundary_vertices and extract all vertices that have not
+     * become isolated.  note that the correct ids are copied as well: these are contained in in_boundary_vertices from
+     * the beginning of the call. */
+
+    /* copy in_boundary_vertices so as to enable the caller to use the same list for both references
+     * in_boundary_vertices and out_boundary_vertices */
+    auto in_boundary_vertices_copy = in_boundary_vertices;
+
+    /* initialize (and overwrite) out_boundary_vertices with new_boundary_vertices. this might also overwrite
+     * in_boundary_vertices if both references are identical. */
+    out_boundary_vertices = new_boundary_vertices;
+
+    /* handle input boundary vertices via copy. */
+    for (auto &ibv : in_boundary_vertices_copy) {
+        if (!ibv.first->isIsolated()) {
+            out_boundary_vertices.push_back(ibv);
+        }
+    }
+
+    /* sort */
+    out_boundary_vertices.sort(cmp);
+
+    /* delete all isolated vertices, old and new, from M. note that only old boundary vertices, which have become
+     * isolated during the call, are thereby deleted. no other boundary vertex is deleted, but they have been written to
+     * the file already to guarantee the invariant for the next flushing or the finalizing call. */
+    debugl(2, "deleting all new isolated vertices.\n");
+    debugTabInc();
+    for (auto &vp : isolated_vertices) {
+        debugl(3, "deleting isolated vertex %d.\n", vp.first->id());
+        M.vertices.erase(vp.first->iterator());
     }
     debugTabDec();
 
-    /* write new isolated vertices (with correct id) and all NEW boundary vertices to obj file. as part of the
-     * invariant, all old boundary vertices had already been written to the obj file when the call started. */
+    debugTabDec();
+    debugl(1, "MeshAlg::partialFlush(): done.\n");
+}
+
+template <typename R>
+void
+MeshAlg::appendToObjFile(
+    FILE                                                      **obj_file_ptr,
+    std::string const                                          &filename,
+    std::vector<Vec3<R>> const                                 &new_vertex_positions,
+    std::vector<std::array<uint32_t, 4>> const                 &flush_faces,
+    uint32_t                                                    nthreads,
+    uint32_t                                                    precision)
+{
+    using Aux::File::formatSci;
+    using Aux::File::formatUInt;
 
-    /* since vertices should be the first block and the face definition block (which use vertex indices) should be
-     * below, it is necessary to insert new vertex definition lines in the middle of obj_file, an operation that is
-     * generally unsupported by most file systems. instead, "merge" the file and the new information into a temporary
-     * file, rename to correct filename and adjust the file descriptor. 
+    /* since vertices should be the first block and the face definition block (which use vertex indices) should
+     * be below, it is necessary to insert new vertex definition lines in the middle of obj_file, an operation
+     * that is generally unsupported by most file systems. instead, "merge" the file and the new information into
+     * a temporary file, rename to correct filename and adjust the file descriptor. 
      *
-     * first, scan obj_file for the vertex block delimiter "# ____~V____". as long as it is not found, copy lines to
-     * swap file. after delimiter has been found, insert new vertex lines into swap file, followed by the rest of
-     * obj_file and finally the new faces. */
+     * first, scan obj_file for the vertex block delimiter "# ____~V____". as long as it is not found, copy lines
+     * to swap file. after delimiter has been found, insert new vertex lines into swap file, followed by the rest
+     * of obj_file and finally the new faces. */
     debugl(1, "writing new partial mesh to swap file..\n");
 
     /* get "original" obj file */
-    FILE               *obj_file    = *(obj_file_info.first);
+    FILE               *obj_file    = *obj_file_ptr;
 
     /* open swap file */
-    std::string const &filename     = obj_file_info.second;
     std::string swap_filename       = filename + "_swap";
     FILE *swap_file                 = fopen( (swap_filename + ".obj").c_str(), "w");
     const char v_delim[]            = "# ____~V____";
-    char line[1024];
 
     if (!swap_file) {
-        debugTabDec();
-        throw("MeshAlg::partialFlush(): can't open swap file for writing.");
-    }
-
-    /* if orig file is empty, write new vertices / faces directly */
-    if (Aux::File::isEmpty(obj_file)) {
-        debugl(1, "given obj file empty..\n");
-
-        fprintf(swap_file, "# %5zu flushed vertices\n", new_isolated_vertices.size() + new_boundary_vertices.size());
-        Vec3<R> vpos;
-        for (auto &vp : new_isolated_vertices) {
-            vpos = vp.first->pos();
-            fprintf(swap_file, "v %+.10e %+.10e %+.10e\n", vpos[0], vpos[1], vpos[2]);
-        }
-        for (auto &vp : new_boundary_vertices) {
-            vpos = vp.first->pos();
-            fprintf(swap_file, "v %+.10e %+.10e %+.10e\n", vpos[0], vpos[1], vpos[2]);
-        }
-
-        /* and write delimiter again */
-        fprintf(swap_file, "%s\n", v_delim);
-
-        debugl(1, "done writing new vertices and delimiter.\n");
+        throw("MeshAlg::appendToObjFile(): can't open swap file for writing.");
     }
-    /* otherwise assemble swap_file from new information and obj_file */
-    else {
-        debugl(1, "given obj file non-empty.. \"merging\" together old and new information into swap_file..\n");
-        rewind(obj_file);
-        debugTabInc();
-        while ( fgets(line, sizeof(line), obj_file) == line) {
-            if (line[strlen(line) - 1] == '\n') {
-                /* overwrite newline with zero-termination */
-                line[strlen(line) - 1] = '\0';
-                debugl(2, "line from original file: \"%s\".\n", line);
-                if (strncmp(line, v_delim, sizeof(v_delim)) == 0) {
-                    debugl(3, "writing new vertices and delimiter.\n");
-
-                    /* delimiter found. write new vertices */
-                    fprintf(swap_file, "# %5zu flushed vertices\n", new_isolated_vertices.size() + new_boundary_vertices.size());
-                    Vec3<R> vpos;
-                    for (auto &vp : new_isolated_vertices) {
-                        vpos = vp.first->pos();
-                        fprintf(swap_file, "v %+.10e %+.10e %+.10e\n", vpos[0], vpos[1], vpos[2]);
-                    }
-                    for (auto &vp : new_boundary_vertices) {
-                        vpos = vp.first->pos();
-                        fprintf(swap_file, "v %+.10e %+.10e %+.10e\n", vpos[0], vpos[1], vpos[2]);
-                    }
+    setvbuf(swap_file, NULL, _IOFBF, 1 << 20);
 
-                    /* and write delimiter again */
-                    fprintf(swap_file, "%s\n", v_delim);
+    /* writes the new vertices, followed by the delimiter */
+    auto writeNewVertices = [&] (FILE *dst) -> void
+    {
+        fprintf(dst, "# %5zu flushed vertices\n", new_vertex_positions.size());
+        Aux::File::writeLines(dst, new_vertex_positions.size(), 96,
+            [&] (size_t i, char *buf) -> size_t
+            {
+                Vec3<R> const  &vpos    = new_vertex_positions[i];
+                char           *s       = buf;
 
-                    debugl(3, "done writing new vertices and delimiter.\n");
-                }
-                /* copy line to swap_file */
-                else {
-                    fprintf(swap_file, "%s\n", line);
+                *s++ = 'v';
+                for (uint32_t k = 0; k < 3; k++) {
+                    *s++ = ' ';
+                    s += formatSci(s, vpos[k], precision);
                 }
-            }
-            else {
-                debugTabDec(); debugTabDec();
-                throw("MeshAlg::partialFlush(): obj line longer than 1024 characters. please limit comments to reasonable line width.");
-            }
-        }
-        debugTabDec();
-    }
+                *s++ = '\n';
 
-    /* append all faces to swap file */
-    fprintf(swap_file, "# %5zu flushed faces.\n", flush_face_list.size());
-    for (auto &f : flush_face_list) {
-        if (f.quad) {
-            /*
-            fprintf(swap_file, "f %d//%d %d//%d %d//%d %d//%d\n",
-                    f.v_ids[0] + 1, 
-                    f.v_ids[0] + 1, 
-                    f.v_ids[1] + 1,
-                    f.v_ids[1] + 1,
-                    f.v_ids[2] + 1,
-                    f.v_ids[2] + 1,
-                    f.v_ids[3] + 1,
-                    f.v_ids[3] + 1);
-             */
-            fprintf(swap_file, "f %d %d %d %d\n",
-                    f.v_ids[0] + 1,
-                    f.v_ids[1] + 1,
-                    f.v_ids[2] + 1,
-                    f.v_ids[3] + 1);
+                return (s - buf);
+            },
+            nthreads);
+        fprintf(dst, "%s\n", v_delim);
+    };
 
+    try {
+        /* if orig file is empty, write new vertices / faces directly */
+        if (Aux::File::isEmpty(obj_file)) {
+            debugl(1, "given obj file empty..\n");
+            writeNewVertices(swap_file);
+            debugl(1, "done writing new vertices and delimiter.\n");
         }
+        /* otherwise assemble swap_file from new information and obj_file, replacing the delimiter line of
+         * obj_file with the new vertices and the delimiter. */
         else {
-            /*
-            fprintf(swap_file, "f %d//%d %d//%d %d//%d\n",
-                    f.v_ids[0] + 1, 
-                    f.v_ids[0] + 1, 
-                    f.v_ids[1] + 1,
-                    f.v_ids[1] + 1,
-                    f.v_ids[2] + 1,
-                    f.v_ids[2] + 1);
-            */
-            fprintf(swap_file, "f %d %d %d\n",
-                    f.v_ids[0] + 1,
-                    f.v_ids[1] + 1,
-                    f.v_ids[2] + 1 );
+            debugl(1, "given obj file non-empty.. \"merging\" together old and new information into swap_file..\n");
+            if (!Aux::File::copyReplacingLine(obj_file, swap_file, v_delim, writeNewVertices)) {
+                throw("MeshAlg::appendToObjFile(): vertex block delimiter not found in obj file.");
+            }
         }
+
+        /* append all faces to swap file */
+        fprintf(swap_file, "# %5zu flushed faces.\n", flush_faces.size());
+        Aux::File::writeLines(swap_file, flush_faces.size(), 64,
+            [&] (size_t i, char *buf) -> size_t
+            {
+                std::array<uint32_t, 4> const  &ids     = flush_faces[i];
+                uint32_t const                  nids    = (ids[3] == UINT32_MAX) ? 3 : 4;
+                char                           *s       = buf;
+
+                *s++ = 'f';
+                for (uint32_t k = 0; k < nids; k++) {
+                    *s++ = ' ';
+                    s += formatUInt(s, ids[k] + 1);
+                }
+                *s++ = '\n';
+
+                return (s - buf);
+            },
+            nthreads);
+    }
+    catch (...) {
+        fclose(swap_file);
+        throw;
     }
 
     debugl(2, "flushing / synching / closing obj_file\n");
@@ -2825,89 +3564,410 @@ MeshAlg::partialFlushToObjFile(
 
     debugl(2, "removing original file, rename swap file to original file.\n");
 
-    /* remove original file, rename swap_file to original file, adjust FILE * reference in file_info */
+    /* remove original file, rename swap_file to original file, adjust FILE * reference */
     if ( remove( (filename + ".obj").c_str() ) != 0) {
-        debugTabDec();
-        throw("MeshAlg::partialFlush(): can't remove old obj file before overwriting with swap file.");
+        throw("MeshAlg::appendToObjFile(): can't remove old obj file before overwriting with swap file.");
     }
     if (rename( (swap_filename + ".obj").c_str(), (filename + ".obj").c_str() ) != 0) {
-        debugTabDec();
-        throw("MeshAlg::partialFlush(): can't rename swap file to filename of obj file.");
+        throw("MeshAlg::appendToObjFile(): can't rename swap file to filename of obj file.");
     }
 
-    debugl(2, "assigning new FILE * to obj_file_info pair by reopening filename, which now contains moved swap file...\n");
-    /* update file pointer in obj_file_info: reopen new obj file (moved swap file) in append mode and rewind() */
+    debugl(2, "assigning new FILE * by reopening filename, which now contains moved swap file...\n");
+    /* update file pointer: reopen new obj file (moved swap file) in append mode and rewind() */
     FILE *tmp = fopen( (filename + ".obj").c_str(), "r+");
     if (!tmp) {
-        debugTabDec();
-        throw("MeshAlg::partialFlush(): can't re-open obj file after having removed and overwritten old one with swap file.");
+        throw("MeshAlg::appendToObjFile(): can't re-open obj file after having removed and overwritten old one with swap file.");
     }
     else {
         rewind(tmp);
-        *(obj_file_info).first = tmp;
+        *obj_file_ptr = tmp;
     }
-    
-    debugl(2, "finishing invariants ..\n");
+}
 
-    /* write out_boundary_vertices for the caller: out_boundary_vertices is the union of new_boundary_vertices and all
-     * old boundary vertices that have not become isolated. since a boundary vertex can either stay a boundary vertex or
-     * become isolated (losing the boundary status) and no vertices have yet been deleted (and thus all pointers are
-     * still intact), it's possible to simply iterate over in_boundary_vertices and extract all vertices that have not
-     * become isolated.  note that the correct ids are copied as well: these are contained in in_boundary_vertices from
-     * the beginning of the call. */
+template <typename Tm, typename Tv, typename Tf, typename R>
+void
+MeshAlg::partialFlushToObjFile(
+    Mesh<Tm, Tv, Tf, R>                                        &M,
+    std::pair<FILE **, std::string> const                      &obj_file_info,
+    std::list<typename Mesh<Tm, Tv, Tf, R>::Face *>            &face_list,
+    std::list<
+            std::pair<
+                typename Mesh<Tm, Tv, Tf, R>::Vertex *,
+                uint32_t
+            >
+        >                                                      &in_boundary_vertices,
+    uint32_t const                                             &in_last_flush_vertex_id,
+    std::list<
+            std::pair<
+                typename Mesh<Tm, Tv, Tf, R>::Vertex *,
+                uint32_t          
+            >
+        >                                                      &out_boundary_vertices,
+    uint32_t                                                   &out_last_flush_vertex_id,
+    uint32_t                                                    nthreads,
+    uint32_t                                                    precision)
+{
+    MeshAlg::partialFlush<Tm, Tv, Tf, R>(
+        M,
+        face_list,
+        in_boundary_vertices,
+        in_last_flush_vertex_id,
+        out_boundary_vertices,
+        out_last_flush_vertex_id,
+        [&] (
+            std::vector<Vec3<R>>                                                &new_vertex_positions,
+            std::vector<std::array<uint32_t, 4>>                                &flush_faces,
+            std::vector<std::array<typename Mesh<Tm, Tv, Tf, R>::Vertex *, 4>>  &)
+        -> void
+        {
+            MeshAlg::appendToObjFile<R>(
+                obj_file_info.first,
+                obj_file_info.second,
+                new_vertex_positions,
+                flush_faces,
+                nthreads,
+                precision);
+        });
+}
 
-    /* copy in_boundary_vertices so as to enable the caller to use the same list for both references
-     * in_boundary_vertices and out_boundary_vertices */
-    auto in_boundary_vertices_copy = in_boundary_vertices;
+template<typename Tm, typename Tv, typename Tf, typename R>
+MeshAlg::MeshFlushInfo<Tm, Tv, Tf, R>::MeshFlushInfo()
+: open(false), writer_pending_bytes(0), writer_max_pending(2), writer_stop(false), format(MESH_FILE_OBJ), file(NULL),
+    face_file(NULL),
+    last_flush_vertex_id(0), nfaces(0), nthreads(1), precision(10), write_seams(false)
+{}
+
+template<typename Tm, typename Tv, typename Tf, typename R>
+MeshAlg::MeshFlushInfo<Tm, Tv, Tf, R>::MeshFlushInfo(
+    std::string const  &_filename,
+    MeshFileFormat      _format)
+: open(false), writer_pending_bytes(0), writer_max_pending(2), writer_stop(false), filename(_filename),
+    format(_format), file(NULL),
+    face_file(NULL), last_flush_vertex_id(0), nfaces(0), nthreads(1), precision(10), write_seams(false)
+{
+    std::string const ext = meshFileExtension(this->format);
 
-    /* initialize (and overwrite) out_boundary_vertices with new_boundary_vertices. this might also overwrite
-     * in_boundary_vertices if both references are identical. */
-    out_boundary_vertices = new_boundary_vertices;
+    this->file = fopen( (this->filename + "." + ext).c_str(), (this->format == MESH_FILE_OBJ) ? "w" : "wb");
+    if (!this->file) {
+        throw("MeshAlg::MeshFlushInfo::MeshFlushInfo(): couldn't open given mesh file for writing..\n");
+    }
 
-    /* handle input boundary vertices via copy. */
-    for (auto &ibv : in_boundary_vertices_copy) {
-        if (!ibv.first->isIsolated()) {
-            out_boundary_vertices.push_back(ibv);
+    /* reserve the fixed-length headers, which are rewritten by finalize() */
+    if (this->format == MESH_FILE_PLY) {
+        this->face_file = fopen( (this->filename + "_faces.tmp").c_str(), "w+b");
+        if (!this->face_file) {
+            fclose(this->file);
+            throw("MeshAlg::MeshFlushInfo::MeshFlushInfo(): couldn't open ply face side file for writing..\n");
         }
+        Aux::File::writePlyHeader(this->file, 0, 0);
+    }
+    else if (this->format == MESH_FILE_STL) {
+        Aux::File::writeStlHeader(this->file, 0);
     }
+    this->open = true;
+}
 
-    /* sort */
-    out_boundary_vertices.sort(cmp);
+template<typename Tm, typename Tv, typename Tf, typename R>
+MeshAlg::MeshFlushInfo<Tm, Tv, Tf, R>::~MeshFlushInfo()
+{
+    /* not finalized, e.g. during stack unwinding: stop the writer and leave the incomplete file behind */
+    this->stopWriter();
+    if (this->file) {
+        fclose(this->file);
+    }
+    if (this->face_file) {
+        fclose(this->face_file);
+    }
+}
 
-    /* delete all isolated vertices, old and new, from M. note that only old boundary vertices, which have become
-     * isolated during the call, are thereby deleted. no other boundary vertex is deleted, but they have been written to
-     * the obj file already to guarantee the invariant for the next flushing or the finalizing call. */
-    debugl(2, "deleting all new isolated vertices.\n");
-    debugTabInc();
-    for (auto &vp : isolated_vertices) {
-        debugl(3, "deleting isolated vertex %d.\n", vp.first->id());
-        M.vertices.erase(vp.first->iterator());
+template<typename Tm, typename Tv, typename Tf, typename R>
+bool
+MeshAlg::MeshFlushInfo<Tm, Tv, Tf, R>::isOpen() const
+{
+    return this->open;
+}
+
+template<typename Tm, typename Tv, typename Tf, typename R>
+void
+MeshAlg::MeshFlushInfo<Tm, Tv, Tf, R>::writerLoop()
+{
+    while (true) {
+        std::function<void()> job;
+        {
+            std::unique_lock<std::mutex> lock(this->writer_mutex);
+            this->writer_cv.wait(lock, [this] () -> bool { return this->writer_stop || !this->writer_jobs.empty(); });
+            if (this->writer_jobs.empty()) {
+                return;
+            }
+            job = this->writer_jobs.front();
+        }
+
+        /* once an error occurred, all remaining jobs are skipped */
+        try {
+            if (!this->writer_error) {
+                job();
+            }
+        }
+        catch (...) {
+            std::lock_guard<std::mutex> lock(this->writer_mutex);
+            this->writer_error = std::current_exception();
+        }
+
+        /* the job leaves the queue only when done, so that it counts as pending while running */
+        job = std::function<void()>();
+        {
+            std::lock_guard<std::mutex> lock(this->writer_mutex);
+            this->writer_jobs.pop_front();
+            this->writer_pending_bytes -= this->writer_job_bytes.front();
+            this->writer_job_bytes.pop_front();
+        }
+        this->writer_cv.notify_all();
     }
-    debugTabDec();
+}
 
-    debugTabDec();
-    debugl(1, "MeshAlg::partialFlush(): done.\n");
+template<typename Tm, typename Tv, typename Tf, typename R>
+void
+MeshAlg::MeshFlushInfo<Tm, Tv, Tf, R>::stopWriter()
+{
+    if (this->writer.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock(this->writer_mutex);
+            this->writer_stop = true;
+        }
+        this->writer_cv.notify_all();
+        this->writer.join();
+        this->writer_stop = false;
+    }
+}
+
+template<typename Tm, typename Tv, typename Tf, typename R>
+void
+MeshAlg::MeshFlushInfo<Tm, Tv, Tf, R>::startWriter(uint32_t max_pending)
+{
+    if (!this->writer.joinable()) {
+        this->writer_max_pending    = std::max<uint32_t>(1, max_pending);
+        this->writer                = std::thread(&MeshFlushInfo<Tm, Tv, Tf, R>::writerLoop, this);
+    }
+}
+
+template<typename Tm, typename Tv, typename Tf, typename R>
+void
+MeshAlg::MeshFlushInfo<Tm, Tv, Tf, R>::submit(
+    std::function<void()> const    &job,
+    size_t                          bytes)
+{
+    if (!this->writer.joinable()) {
+        job();
+        return;
+    }
+
+    {
+        std::unique_lock<std::mutex> lock(this->writer_mutex);
+        this->writer_cv.wait(lock,
+            [this] () -> bool
+            {
+                return this->writer_error || this->writer_jobs.size() < this->writer_max_pending;
+            });
+
+        if (this->writer_error) {
+            std::rethrow_exception(this->writer_error);
+        }
+        this->writer_jobs.push_back(job);
+        this->writer_job_bytes.push_back(bytes);
+        this->writer_pending_bytes += bytes;
+    }
+    this->writer_cv.notify_all();
+}
+
+template<typename Tm, typename Tv, typename Tf, typename R>
+size_t
+MeshAlg::MeshFlushInfo<Tm, Tv, Tf, R>::pendingBytes()
+{
+    std::lock_guard<std::mutex> lock(this->writer_mutex);
+    return this->writer_pending_bytes;
+}
+
+template<typename Tm, typename Tv, typename Tf, typename R>
+void
+MeshAlg::MeshFlushInfo<Tm, Tv, Tf, R>::waitForWriter()
+{
+    std::unique_lock<std::mutex> lock(this->writer_mutex);
+    this->writer_cv.wait(lock, [this] () -> bool { return this->writer_error || this->writer_jobs.empty(); });
+    if (this->writer_error) {
+        std::rethrow_exception(this->writer_error);
+    }
+}
+
+template<typename Tm, typename Tv, typename Tf, typename R>
+void
+MeshAlg::MeshFlushInfo<Tm, Tv, Tf, R>::finalize()
+{
+    /* wait for all queued output */
+    this->stopWriter();
+    if (this->writer_error) {
+        std::exception_ptr error = this->writer_error;
+        this->writer_error = std::exception_ptr();
+        std::rethrow_exception(error);
+    }
+
+    if (this->file) {
+        if (this->format == MESH_FILE_PLY) {
+            /* append all faces after all vertices */
+            std::vector<char>   block(1 << 22);
+            size_t              n;
+
+            fflush(this->face_file);
+            rewind(this->face_file);
+            while ((n = fread(block.data(), 1, block.size(), this->face_file)) > 0) {
+                if (fwrite(block.data(), 1, n, this->file) != n) {
+                    throw("MeshAlg::MeshFlushInfo::finalize(): write error.");
+                }
+            }
+            fclose(this->face_file);
+            remove( (this->filename + "_faces.tmp").c_str() );
+            this->face_file = NULL;
+
+            rewind(this->file);
+            Aux::File::writePlyHeader(this->file, this->last_flush_vertex_id, this->nfaces);
+        }
+        else if (this->format == MESH_FILE_STL) {
+            rewind(this->file);
+            Aux::File::writeStlHeader(this->file, this->nfaces);
+        }
+        fclose(this->file);
+        this->file = NULL;
+    }
+
+    if (this->write_seams && this->format != MESH_FILE_STL) {
+        std::sort(this->seam_vertices.begin(), this->seam_vertices.end());
+        this->seam_vertices.erase(std::unique(this->seam_vertices.begin(), this->seam_vertices.end()), this->seam_vertices.end());
+        if (!Aux::File::writeIndexFile( (this->filename + "_seams.txt").c_str(), this->seam_vertices)) {
+            throw("MeshAlg::MeshFlushInfo::finalize(): couldn't open seam file for writing.");
+        }
+    }
+    std::vector<uint32_t>().swap(this->seam_vertices);
+    this->open = false;
+    this->filename = std::string();
+    this->last_boundary_vertices.clear();
+    this->last_flush_vertex_id = 0;
+    this->nfaces = 0;
 }
 
 template <typename Tm, typename Tv, typename Tf, typename R>
 void
-MeshAlg::partialFlushToObjFile(
+MeshAlg::partialFlushToFile(
     Mesh<Tm, Tv, Tf, R>                                        &M,
-    MeshObjFlushInfo<Tm, Tv, Tf, R>                            &M_flush_info,
+    MeshFlushInfo<Tm, Tv, Tf, R>                               &M_flush_info,
     std::list<typename Mesh<Tm, Tv, Tf, R>::Face *>            &face_list)
 {
+    typedef typename Mesh<Tm, Tv, Tf, R>::Vertex Vertex;
+
+    /* flushed data, detached from the mesh. stl triangles are stored by their positions, since the vertices are
+     * deleted once partialFlush() returns. */
+    struct FlushBatch {
+        std::vector<Vec3<R>>                    vertex_positions;
+        std::vector<std::array<uint32_t, 4>>    faces;
+        std::vector<std::array<Vec3<R>, 3>>     triangles;
+    };
+
     /* check if info has been prepared */
-    if (!M_flush_info.obj_file) {
-        throw("MeshAlg::partialFlushToObjFile(): given obj flush info struct not properly initialized. file handle is NULL.");
+    if (!M_flush_info.isOpen()) {
+        throw("MeshAlg::partialFlushToFile(): given flush info object not properly initialized. file not open.");
     }
 
-    /* call above overload version with full parameter list */
-    MeshAlg::partialFlushToObjFile<Tm, Tv, Tf, R>(
+    MeshFlushInfo<Tm, Tv, Tf, R>   *info = &M_flush_info;
+
+    MeshAlg::partialFlush<Tm, Tv, Tf, R>(
         M,
-        { &M_flush_info.obj_file, M_flush_info.filename },
         face_list,
         M_flush_info.last_boundary_vertices,
         M_flush_info.last_flush_vertex_id,
         M_flush_info.last_boundary_vertices,
-        M_flush_info.last_flush_vertex_id);
+        M_flush_info.last_flush_vertex_id,
+        [&] (
+            std::vector<Vec3<R>>                   &new_vertex_positions,
+            std::vector<std::array<uint32_t, 4>>   &flush_faces,
+            std::vector<std::array<Vertex *, 4>>   &flush_face_vertices)
+        -> void
+        {
+            std::shared_ptr<FlushBatch> batch(new FlushBatch());
+
+            /* collect file indices of seam vertices while the vertices still exist. a seam vertex shared by faces of
+             * several flushes is collected several times, finalize() removes duplicates. */
+            if (info->write_seams) {
+                for (size_t i = 0; i < flush_face_vertices.size(); i++) {
+                    for (uint32_t k = 0; k < 4; k++) {
+                        if (flush_face_vertices[i][k] && flush_face_vertices[i][k]->isSeam()) {
+                            info->seam_vertices.push_back(flush_faces[i][k]);
+                        }
+                    }
+                }
+            }
+
+            if (info->format == MESH_FILE_STL) {
+                /* quads are split along their 0-2 diagonal as in Mesh::writeStlFile() */
+                batch->triangles.reserve(flush_face_vertices.size());
+                for (auto &fv : flush_face_vertices) {
+                    batch->triangles.push_back({{ fv[0]->pos(), fv[1]->pos(), fv[2]->pos() }});
+                    if (fv[3]) {
+                        batch->triangles.push_back({{ fv[0]->pos(), fv[2]->pos(), fv[3]->pos() }});
+                    }
+                }
+            }
+            else {
+                batch->vertex_positions.swap(new_vertex_positions);
+                batch->faces.swap(flush_faces);
+            }
+
+            size_t const batch_bytes =
+                batch->vertex_positions.capacity() * sizeof(Vec3<R>) +
+                batch->faces.capacity() * sizeof(std::array<uint32_t, 4>) +
+                batch->triangles.capacity() * sizeof(std::array<Vec3<R>, 3>);
+
+            /* format and write batch. for obj, it is merged into the file, for the binary formats, new vertices and
+             * faces are appended to the end of the respective files. */
+            info->submit(
+                [info, batch] () -> void
+                {
+                    if (info->format == MESH_FILE_OBJ) {
+                        MeshAlg::appendToObjFile<R>(
+                            &info->file,
+                            info->filename,
+                            batch->vertex_positions,
+                            batch->faces,
+                            info->nthreads,
+                            info->precision);
+                    }
+                    else if (info->format == MESH_FILE_PLY) {
+                        Aux::File::writeLines(info->file, batch->vertex_positions.size(), Aux::File::plyVertexMaxLength,
+                            [&] (size_t i, char *buf) -> size_t
+                            {
+                                Vec3<R> const &vpos = batch->vertex_positions[i];
+                                return Aux::File::formatPlyVertex(buf, vpos[0], vpos[1], vpos[2]);
+                            },
+                            info->nthreads);
+
+                        Aux::File::writeLines(info->face_file, batch->faces.size(), Aux::File::plyFaceMaxLength,
+                            [&] (size_t i, char *buf) -> size_t
+                            {
+                                return Aux::File::formatPlyFace(buf, batch->faces[i]);
+                            },
+                            info->nthreads);
+
+                        info->nfaces += batch->faces.size();
+                    }
+                    else {
+                        Aux::File::writeLines(info->file, batch->triangles.size(), Aux::File::stlTriangleLength,
+                            [&] (size_t i, char *buf) -> size_t
+                            {
+                                std::array<Vec3<R>, 3> const &t = batch->triangles[i];
+                                return Aux::File::formatStlTriangle(buf, t[0], t[1], t[2]);
+                            },
+                            info->nthreads);
+
+                        info->nfaces += batch->triangles.size();
+                    }
+                },
+                batch_bytes);
+        });
 }
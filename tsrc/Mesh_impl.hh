@@ -63,6 +63,7 @@ Mesh<Tm, Tv, Tf, R>::Vertex::Vertex()
     this->position              = Aux::VecMat::nullvec<R>;
     this->current_traversal_id  = 0;
     this->traversal_state       = TRAV_UNSEEN;
+    this->seam                  = 0;
 }
 
 template <typename Tm, typename Tv, typename Tf, typename R>
@@ -75,6 +76,7 @@ Mesh<Tm, Tv, Tf, R>::Vertex::Vertex(
     this->position              = pos;
     this->current_traversal_id  = 0;
     this->traversal_state       = TRAV_UNSEEN;
+    this->seam                  = 0;
     if (data) {
         this->data              = *data;
     }
@@ -94,6 +96,7 @@ Mesh<Tm, Tv, Tf, R>::Vertex::Vertex(const Vertex &x)
     this->position              = x.position;
     this->current_traversal_id  = x.current_traversal_id;
     this->traversal_state       = x.traversal_state;
+    this->seam                  = x.seam;
     this->adjacent_vertices     = x.adjacent_vertices;
     this->incident_faces        = x.incident_faces;
     this->data                  = x.data;
@@ -110,6 +113,7 @@ Mesh<Tm, Tv, Tf, R>::Vertex::operator=(const Vertex &x)
     this->position              = x.position;
     this->current_traversal_id  = x.current_traversal_id;
     this->traversal_state       = x.traversal_state;
+    this->seam                  = x.seam;
     this->adjacent_vertices     = x.adjacent_vertices;
     this->incident_faces        = x.incident_faces;
     this->data                  = x.data;
@@ -141,6 +145,8 @@ Mesh<Tm, Tv, Tf, R>::Vertex::replaceAdjacentVertices(const std::map<Vertex *, Ve
     typename std::list<Vertex *>::iterator                   nbit;
     typename std::map<Vertex *, Vertex *>::const_iterator    mit;
 
+    this->mesh->journalVertex(this);
+
     for (nbit = this->adjacent_vertices.begin(); nbit != this->adjacent_vertices.end(); ++nbit) {
         /* if nb is is found in index change map, replace it */
         if ( (mit = replace_map.find(*nbit)) != replace_map.end() ) {
@@ -163,6 +169,7 @@ template <typename Tm, typename Tv, typename Tf, typename R>
 void
 Mesh<Tm, Tv, Tf, R>::Vertex::insertAdjacentVertex(Vertex *v)
 {
+    this->mesh->journalVertex(this);
     Aux::Alg::listSortedInsert(this->adjacent_vertices, v, true);
 }
 
@@ -170,6 +177,7 @@ template <typename Tm, typename Tv, typename Tf, typename R>
 bool
 Mesh<Tm, Tv, Tf, R>::Vertex::eraseAdjacentVertex(Vertex *v)
 {
+    this->mesh->journalVertex(this);
     return Aux::Alg::removeFirstOccurrenceFromList(this->adjacent_vertices, v);
 }
 
@@ -177,6 +185,7 @@ template <typename Tm, typename Tv, typename Tf, typename R>
 void
 Mesh<Tm, Tv, Tf, R>::Vertex::insertIncidentFace(Face *f)
 {
+    this->mesh->journalVertex(this);
     Aux::Alg::listSortedInsert(this->incident_faces, f, false);
 }
 
@@ -184,6 +193,7 @@ template <typename Tm, typename Tv, typename Tf, typename R>
 bool
 Mesh<Tm, Tv, Tf, R>::Vertex::eraseIncidentFace(Face *f)
 {
+    this->mesh->journalVertex(this);
     return Aux::Alg::removeFirstOccurrenceFromList(this->incident_faces, f);
 }
 
@@ -408,6 +418,20 @@ Mesh<Tm, Tv, Tf, R>::Vertex::isManifold() const
     }
 }
 
+template <typename Tm, typename Tv, typename Tf, typename R>
+bool
+Mesh<Tm, Tv, Tf, R>::Vertex::isSeam() const
+{
+    return (this->seam != 0);
+}
+
+template <typename Tm, typename Tv, typename Tf, typename R>
+void
+Mesh<Tm, Tv, Tf, R>::Vertex::setSeam(bool seam)
+{
+    this->seam = (seam ? 1 : 0);
+}
+
 
 /* ----------------------------------------------------------------------------------------------------------------- *
  *
@@ -422,6 +446,9 @@ Mesh<Tm, Tv, Tf, R>::Face::replaceVertices(const std::map<Vertex *, Vertex*> &re
 {
     typename std::map<Vertex *, Vertex *>::const_iterator mit;
 
+    this->mesh->journalFace(this);
+    this->mesh->bvhFaceChanged(this);
+
     /* for all four vertex pointers: if not NULL, search in replace_map and replace if found */
     for (int i = 0; i < 4; i++) {
         if (this->vertices[i]) {
@@ -1059,6 +1086,8 @@ void
 Mesh<Tm, Tv, Tf, R>::Face::invertOrientation()
 {
     this->checkTriQuad("Mesh::Face::invertOrientation()");
+    this->mesh->journalFace(this);
+    this->mesh->bvhFaceChanged(this);
 
     /* for triangles, vertices[3] contains NULL, reverse only first three elements of array */
     if (this->isTri()) {
@@ -1753,16 +1782,22 @@ Mesh<Tm, Tv, Tf, R>::Face::getTriSharedAndRemainingVertex(
 template <typename Tm, typename Tv, typename Tf, typename R>
 Mesh<Tm, Tv, Tf, R>::Mesh() : vertices(*this) , faces(*this)
 {
-    this->O                 = NULL;
-    this->octree_updated    = false;
+    this->spatial_index_updated     = false;
+    this->spatial_index_nthreads    = 1;
+    this->face_bvh_tracked          = false;
+    this->bvh_next_serial           = 1;
+    this->journal_active            = false;
 }
 
 /* copy ctor */
 template <typename Tm, typename Tv, typename Tf, typename R>
 Mesh<Tm, Tv, Tf, R>::Mesh(const Mesh &X) : vertices(*this), faces(*this) {
     /* default init */
-    this->O                 = NULL;
-    this->octree_updated    = false;
+    this->spatial_index_updated     = false;
+    this->spatial_index_nthreads    = 1;
+    this->face_bvh_tracked          = false;
+    this->bvh_next_serial           = 1;
+    this->journal_active            = false;
 
     /* use assignment operator. although this initializes all members with the default ctor and
      * immediately overwrites them again, this was deemed preferable to copying the code of
@@ -1852,9 +1887,10 @@ Mesh<Tm, Tv, Tf, R>::operator=(const Mesh &X)
     /* copy mesh boudning box */
     this->bb                = X.bb;
 
-    /* we could copy the entire octee by value, but well... */
-    this->O                 = NULL;
-    this->octree_updated    = false;
+    /* the hierarchies refer to the faces / vertices of X, so they are rebuilt on demand */
+    this->face_bvh.clear();
+    this->vertex_bvh.clear();
+    this->bvhDropTracking();
 
     return (*this);
 }
@@ -1863,9 +1899,8 @@ Mesh<Tm, Tv, Tf, R>::operator=(const Mesh &X)
 template <typename Tm, typename Tv, typename Tf, typename R>
 Mesh<Tm, Tv, Tf, R>::~Mesh()
 {
-    if (this->O != NULL) {
-        delete this->O;
-    }
+    /* delete objects retained by the undo journal, if any */
+    this->journalDiscard();
 
     /* delete all allocated vertices */
     for (auto &v : this->vertices) {
@@ -1882,6 +1917,9 @@ template <typename Tm, typename Tv, typename Tf, typename R>
 void
 Mesh<Tm, Tv, Tf, R>::clear()
 {
+    /* drop checkpoint, if any */
+    this->journalDiscard();
+
     /* delete all allocated vertices */
     for (auto &v : this->vertices) {
         delete (&v);
@@ -1901,18 +1939,20 @@ Mesh<Tm, Tv, Tf, R>::clear()
     this->F_idq.clear();
     this->traversal_idq.clear();
 
-    /* delete octree */
-    if (this->O != NULL) {
-        delete this->O;
-    }
-    this->O                 = NULL;
-    this->octree_updated    = false;
+    /* drop bounding volume hierarchies */
+    this->face_bvh.clear();
+    this->vertex_bvh.clear();
+    this->bvhDropTracking();
 }
 
 template <typename Tm, typename Tv, typename Tf, typename R>
 void
 Mesh<Tm, Tv, Tf, R>::clearFaces()
 {
+    if (this->journal_active) {
+        throw MeshEx(MESH_LOGIC_ERROR, "Mesh::clearFaces(): can't clear faces while a checkpoint is set.");
+    }
+
     /* delete all allocated faces */
     for (auto &f : this->faces) {
         delete (&f);
@@ -1921,6 +1961,7 @@ Mesh<Tm, Tv, Tf, R>::clearFaces()
     /* clear faces map and face id queue.*/
     this->F.clear();
     this->F_idq.clear();
+    this->bvhDropTracking();
 
     /* since there are no isolated edges, simply clear all adjacency and incidence information in
      * all vertices. */
@@ -1939,6 +1980,10 @@ Mesh<Tm, Tv, Tf, R>::renumberConsecutively(
     uint32_t face_start_id)
 {
     debugl(2, "Mesh::renumberConsecutively(): vertex_start_id: %5d, face_start_id: %5d.\n", vertex_start_id, face_start_id);
+
+    if (this->journal_active) {
+        throw MeshEx(MESH_LOGIC_ERROR, "Mesh::renumberConsecutively(): can't renumber while a checkpoint is set.");
+    }
     debugTabInc();
 
     /* renumber indices of vertices and faces in a consecutive fashion. since the internal maps
@@ -2014,6 +2059,56 @@ Mesh<Tm, Tv, Tf, R>::numFaces() const
     return (this->faces.size());
 }
 
+template <typename Tm, typename Tv, typename Tf, typename R>
+size_t
+Mesh<Tm, Tv, Tf, R>::memoryFootprint() const
+{
+    /* heap chunk of an n byte allocation with 8 bytes of malloc bookkeeping and 16 byte alignment, as in glibc. tree
+     * nodes of std::map / std::set carry a header of three pointers and a colour, list nodes two pointers. */
+    auto chunk = [] (size_t n) -> size_t
+    {
+        return std::max<size_t>(32, (n + 8 + 15) & ~(size_t)15);
+    };
+    size_t const tree_node_header   = 4 * sizeof(void *);
+    size_t const list_node          = chunk(3 * sizeof(void *));
+
+    size_t const vertex_bytes       = chunk(sizeof(Vertex)) +
+                                        chunk(tree_node_header + sizeof(std::pair<const uint32_t, VertexPointerType>));
+    size_t const face_bytes         = chunk(sizeof(Face)) +
+                                        chunk(tree_node_header + sizeof(std::pair<const uint32_t, FacePointerType>));
+
+    /* adjacency lists are not walked: every triangle contributes three incident face entries and six adjacent vertex
+     * entries, since adjacent vertices are inserted with duplicates, once per incident face of the edge. */
+    size_t const nV                 = this->V.size();
+    size_t const nF                 = this->F.size();
+    size_t const adjacency_nodes    = 9 * nF;
+
+    size_t bytes = nV * vertex_bytes + nF * face_bytes + adjacency_nodes * list_node;
+
+    bytes += this->face_bvh.memoryFootprint() + this->vertex_bvh.memoryFootprint();
+
+    /* incremental face hierarchy levels and change records */
+    for (auto &level : this->bvh_levels) {
+        bytes += level.bvh.memoryFootprint() + level.faces.capacity() * sizeof(Face *);
+    }
+    bytes += this->bvh_stale_faces.size() * chunk(tree_node_header + sizeof(Face *));
+    bytes += this->bvh_changed_faces.size() * chunk(tree_node_header + sizeof(std::pair<Face * const, uint32_t>));
+    bytes += this->bvh_pending_faces.capacity() * sizeof(Face *);
+
+    /* undo journal while a checkpoint is set. recorded adjacency lists are assumed to be of average length. */
+    bytes += (this->journal_inserted_vertices.size() + this->journal_inserted_faces.size()) *
+                chunk(tree_node_header + sizeof(void *));
+    bytes += this->journal_face_records.size() *
+                chunk(tree_node_header + sizeof(std::pair<Face * const, JournalFaceRecord>));
+    bytes += this->journal_vertex_records.size() *
+                chunk(tree_node_header + sizeof(std::pair<Vertex * const, JournalVertexRecord>));
+    if (nV > 0) {
+        bytes += (this->journal_vertex_records.size() * adjacency_nodes / nV) * list_node;
+    }
+
+    return bytes;
+}
+
 template <typename Tm, typename Tv, typename Tf, typename R>
 uint32_t
 Mesh<Tm, Tv, Tf, R>::numEdges() const
@@ -2027,83 +2122,245 @@ Mesh<Tm, Tv, Tf, R>::numEdges() const
 
 template <typename Tm, typename Tv, typename Tf, typename R>
 uint32_t
-Mesh<Tm, Tv, Tf, R>::numObtuseTriangles() const
+Mesh<Tm, Tv, Tf, R>::numObtuseTriangles(uint32_t nthreads) const
 {
-    Vec3<R>     v0, v1, v2;
-    R           a, b, c;
-    R           aa, bb, cc;
-
-    uint32_t    nobtuse_tris = 0;
-    for (auto &f : this->faces) {
-        f.checkTri("Mesh::numObtuseTriangles():");
-        f.getTriPositions(v0, v1, v2);
-
-        a       = (v1 - v0).len2();
-        b       = (v2 - v1).len2();
-        c       = (v0 - v2).len2();
-        aa      = a*a;
-        bb      = b*b;
-        cc      = c*c;
-
-        if (aa + bb < cc || bb + cc < aa || cc + aa < bb) {
-            nobtuse_tris++;
-        }
-    }
-    return nobtuse_tris;
+    TriQuality q;
+    this->getTriQuality(q, nthreads, TRI_OBTUSE);
+    return q.nobtuse;
 }
 
 /* area, volume, ar statistics */
 template <typename Tm, typename Tv, typename Tf, typename R>
 R     
-Mesh<Tm, Tv, Tf, R>::getTotalArea() const
+Mesh<Tm, Tv, Tf, R>::getTotalArea(uint32_t nthreads) const
 {
-    R      area = 0.0;
-    for (auto &f : this->faces) {
-        f.checkTri("Mesh::getTotalArea():");
-        area += f.getTriArea();
-    }
-    return area;
+    TriQuality q;
+    this->getTriQuality(q, nthreads, TRI_AREA);
+    return q.area;
 }
 
 template <typename Tm, typename Tv, typename Tf, typename R>
 R     
-Mesh<Tm, Tv, Tf, R>::getTotalVolume() const
+Mesh<Tm, Tv, Tf, R>::getTotalVolume(uint32_t nthreads) const
 {
-    R      volume = 0.0;
-    for (auto &f : this->faces) {
-        f.checkTri("Mesh::getTotalVolume():");
-        volume += f.getTriSignedVolume();
-    }
-    return fabs(volume);
+    TriQuality q;
+    this->getTriQuality(q, nthreads, TRI_VOLUME);
+    return fabs(q.volume);
 }
 
 template <typename Tm, typename Tv, typename Tf, typename R>
 void
 Mesh<Tm, Tv, Tf, R>::getAvgAspectRatio(
-    R       &ar_avg,
-    R       &ar_sigma,
-    R       *ar_max,
-    R       *ar_min) const
+    R          &ar_avg,
+    R          &ar_sigma,
+    R          *ar_max,
+    R          *ar_min,
+    uint32_t    nthreads) const
 {
-    using Aux::Numbers::inf;
+    TriQuality q;
+    this->getTriQuality(q, nthreads, TRI_ASPECT_RATIO);
+
+    ar_avg      = q.ar_avg;
+    ar_sigma    = q.ar_sigma;
+    if (ar_max) *ar_max = q.ar_max;
+    if (ar_min) *ar_min = q.ar_min;
+}
 
-    std::vector<R> ratios;
+template <typename Tm, typename Tv, typename Tf, typename R>
+void
+Mesh<Tm, Tv, Tf, R>::getTriPositionSnapshot(TriPositions &P) const
+{
+    size_t const n = this->faces.size();
+    for (auto &ci : P.c) {
+        for (auto &cd : ci) {
+            cd.resize(n);
+        }
+    }
 
+    Vec3<R> v[3];
+    size_t  j = 0;
     for (auto &f : this->faces) {
-        f.checkTri("Mesh::getAvgAspectRatio():");
-        ratios.push_back( f.getTriAspectRatio() );
+        f.checkTri("Mesh::getTriPositionSnapshot():");
+        f.getTriPositions(v[0], v[1], v[2]);
+        for (uint32_t i = 0; i < 3; i++) {
+            for (uint32_t d = 0; d < 3; d++) {
+                P.c[i][d][j] = v[i][d];
+            }
+        }
+        j++;
     }
+}
+
+template <typename Tm, typename Tv, typename Tf, typename R>
+void
+Mesh<Tm, Tv, Tf, R>::getTriQuality(
+    TriQuality &q,
+    uint32_t    nthreads,
+    uint32_t    metrics) const
+{
+    TriPositions P;
+    this->getTriPositionSnapshot(P);
+    computeTriQuality(P, q, nthreads, metrics);
+}
+
+template <typename Tm, typename Tv, typename Tf, typename R>
+void
+Mesh<Tm, Tv, Tf, R>::computeTriQuality(
+    TriPositions const &P,
+    TriQuality         &q,
+    uint32_t            nthreads,
+    uint32_t            metrics)
+{
+    using Aux::Numbers::inf;
+
+    /* the block length is fixed, independent of nthreads. */
+    size_t const    block_len   = 1024;
+    size_t const    n           = P.size();
+    size_t const    nblocks     = (n + block_len - 1) / block_len;
+    bool const      want_ar     = (metrics & TRI_ASPECT_RATIO);
+
+    struct BlockResult {
+        R           area, volume, ar_sum, ar_min, ar_max, ar_var;
+        uint32_t    nobtuse;
+    };
+    std::vector<BlockResult>    blocks(nblocks);
+    std::vector<R>              ar(want_ar ? n : 0);
+
+    /* sum of v[0 .. m) in four interleaved lanes, which are added pairwise at the end. */
+    auto laneSum = [] (R const *v, size_t m) -> R
+    {
+        R       acc[4]  = { 0.0, 0.0, 0.0, 0.0 };
+        size_t  j       = 0;
+        for (; j + 4 <= m; j += 4) {
+            for (uint32_t l = 0; l < 4; l++) {
+                acc[l] += v[j + l];
+            }
+        }
+        for (uint32_t l = 0; j < m; j++, l++) {
+            acc[l] += v[j];
+        }
+        return (acc[0] + acc[1]) + (acc[2] + acc[3]);
+    };
+
+    /* first pass: per-triangle metrics into block-local arrays with independent iterations, then block sums. each
+     * selected metric has its own loop, so that unselected metrics cost nothing. */
+    Aux::Alg::parallelBlocks(n, block_len, nthreads,
+        [&] (size_t b, size_t first, size_t last) -> void
+        {
+            R const *x0 = P.c[0][0].data() + first, *y0 = P.c[0][1].data() + first, *z0 = P.c[0][2].data() + first;
+            R const *x1 = P.c[1][0].data() + first, *y1 = P.c[1][1].data() + first, *z1 = P.c[1][2].data() + first;
+            R const *x2 = P.c[2][0].data() + first, *y2 = P.c[2][1].data() + first, *z2 = P.c[2][2].data() + first;
+            size_t const m      = last - first;
+            BlockResult &r      = blocks[b];
+            R            tmp[block_len];
+
+            r.area      = 0.0;
+            r.volume    = 0.0;
+            r.ar_sum    = 0.0;
+            r.nobtuse   = 0;
+            r.ar_min    = inf<R>();
+            r.ar_max    = -inf<R>();
+
+            if (metrics & TRI_AREA) {
+                for (size_t j = 0; j < m; j++) {
+                    /* (v1 - v0) x (v2 - v0) */
+                    R const ux  = x1[j] - x0[j], uy = y1[j] - y0[j], uz = z1[j] - z0[j];
+                    R const tx  = x2[j] - x0[j], ty = y2[j] - y0[j], tz = z2[j] - z0[j];
+                    R const nx  = uy*tz - uz*ty;
+                    R const ny  = uz*tx - ux*tz;
+                    R const nz  = ux*ty - uy*tx;
+
+                    tmp[j]      = std::sqrt(nx*nx + ny*ny + nz*nz) / 2.0;
+                }
+                r.area = laneSum(tmp, m);
+            }
+
+            if (metrics & TRI_VOLUME) {
+                for (size_t j = 0; j < m; j++) {
+                    tmp[j]      = ( x0[j]*(y1[j]*z2[j] - z1[j]*y2[j])
+                                  + y0[j]*(z1[j]*x2[j] - x1[j]*z2[j])
+                                  + z0[j]*(x1[j]*y2[j] - y1[j]*x2[j]) ) / 6.0;
+                }
+                r.volume = laneSum(tmp, m);
+            }
+
+            if (metrics & (TRI_OBTUSE | TRI_ASPECT_RATIO)) {
+                R *ar_b = want_ar ? ar.data() + first : NULL;
+
+                for (size_t j = 0; j < m; j++) {
+                    /* edges v1 - v0, v2 - v1, v0 - v2 */
+                    R const ux = x1[j] - x0[j], uy = y1[j] - y0[j], uz = z1[j] - z0[j];
+                    R const vx = x2[j] - x1[j], vy = y2[j] - y1[j], vz = z2[j] - z1[j];
+                    R const wx = x0[j] - x2[j], wy = y0[j] - y2[j], wz = z0[j] - z2[j];
+
+                    R const aa  = ux*ux + uy*uy + uz*uz;
+                    R const bb  = vx*vx + vy*vy + vz*vz;
+                    R const cc  = wx*wx + wy*wy + wz*wz;
+
+                    tmp[j]      = (aa + bb < cc || bb + cc < aa || cc + aa < bb) ? 1.0 : 0.0;
+                    if (want_ar) {
+                        R const a   = std::sqrt(aa);
+                        R const b   = std::sqrt(bb);
+                        R const c   = std::sqrt(cc);
+                        R const s   = 0.5*(a + b + c);
+
+                        ar_b[j]     = (a*b*c) / (8.0*(s - a)*(s - b)*(s - c));
+                    }
+                }
+                r.nobtuse = (uint32_t)laneSum(tmp, m);
 
-    R ar_min_tmp, ar_max_tmp;
-    Aux::Stat::computeMinMaxAvgSigma<R>(
-            ratios, 
-            ar_min_tmp,
-            ar_max_tmp,
-            ar_avg,
-            ar_sigma);
+                if (want_ar) {
+                    r.ar_sum = laneSum(ar_b, m);
+                    for (size_t j = 0; j < m; j++) {
+                        r.ar_min    = std::min(r.ar_min, ar_b[j]);
+                        r.ar_max    = std::max(r.ar_max, ar_b[j]);
+                    }
+                }
+            }
+        });
+
+    q.area      = 0.0;
+    q.volume    = 0.0;
+    q.nobtuse   = 0;
+    q.ar_min    = inf<R>();
+    q.ar_max    = -inf<R>();
+
+    R ar_sum    = 0.0;
+    for (auto &r : blocks) {
+        q.area     += r.area;
+        q.volume   += r.volume;
+        q.nobtuse  += r.nobtuse;
+        ar_sum     += r.ar_sum;
+        q.ar_min    = std::min(q.ar_min, r.ar_min);
+        q.ar_max    = std::max(q.ar_max, r.ar_max);
+    }
+    q.ar_avg = ar_sum / (R)n;
+
+    if (!want_ar) {
+        q.ar_sigma = 0.0;
+        return;
+    }
+
+    /* second pass: squared deviations from the mean, sigma with bessel correction */
+    R const ar_avg = q.ar_avg;
+    Aux::Alg::parallelBlocks(n, block_len, nthreads,
+        [&] (size_t b, size_t first, size_t last) -> void
+        {
+            R const        *ar_b    = ar.data() + first;
+            size_t const    m       = last - first;
+            R               dev[block_len];
 
-    if (ar_max) *ar_max = ar_max_tmp;
-    if (ar_min) *ar_min = ar_min_tmp;
+            for (size_t j = 0; j < m; j++) {
+                dev[j] = (ar_b[j] - ar_avg)*(ar_b[j] - ar_avg);
+            }
+            blocks[b].ar_var = laneSum(dev, m);
+        });
+
+    R var = 0.0;
+    for (auto &r : blocks) {
+        var += r.ar_var;
+    }
+    q.ar_sigma = std::sqrt( var / ((R)n - 1.0) );
 }
 
 template <typename Tm, typename Tv, typename Tf, typename R>
@@ -2114,7 +2371,7 @@ Mesh<Tm, Tv, Tf, R>::getBoundingBox() const
     using Aux::VecMat::minVec3;
     using Aux::VecMat::maxVec3;
     
-    if (this->octree_updated) {
+    if (this->spatial_index_updated) {
         return (this->bb);
     }
     else {
@@ -2145,23 +2402,35 @@ template <typename Tm, typename Tv, typename Tf, typename R>
 void
 Mesh<Tm, Tv, Tf, R>::copyAppend(const Mesh &B)
 {
-    std::map<uint32_t, vertex_iterator>                     new_vertex_its;
-    typename std::map<uint32_t, vertex_iterator>::iterator  idit;
-    vertex_iterator                                         new_it;
+    uint32_t                new_id, v_first;
+    Vertex                 *v;
 
     debugl(4, "Mesh::appendCopy()\n");
     debugTabInc();
-    /* add all vertices of B to (this) mesh, store iterators to new vertices */
-    for (auto &B_v : B.vertices) {
-        new_it  = this->vertices.insert( B_v.pos() );
 
-        if ( (idit = new_vertex_its.find( B_v.id() )) != new_vertex_its.end()) {
-            throw MeshEx(MESH_LOGIC_ERROR, "Mesh::appendCopy(): duplicate entry in new_vertex_ids map, should be impossible.");
+    /* dense table mapping ids of B to the new vertices, whose size is bounded by the largest vertex id of B */
+    std::vector<Vertex *>   new_vertices(B.V.empty() ? 0 : B.V.rbegin()->first + 1, NULL);
+
+    /* add all vertices of B to (this) mesh. if a consecutive range of fresh ids is available, all new ids exceed all
+     * existing ids and every insertion with hint end() takes amortized constant time. */
+    bool const v_range = this->V_idq.getIdRange(B.V.size(), v_first);
+    for (auto &B_vp : B.V) {
+        new_id      = v_range ? v_first++ : this->V_idq.getId();
+        v           = new Vertex(this, B_vp.second->pos());
+
+        size_t const nV = this->V.size();
+        auto vit    = this->V.insert(this->V.end(), { new_id, VertexPointerType(v) });
+        if (this->V.size() == nV) {
+            delete v;
+            debugTabDec();
+            throw MeshEx(MESH_LOGIC_ERROR, "Mesh::copyAppend(): vertex with fresh id already present in vertex map. internal logic error.");
         }
-        new_vertex_its[B_v.id()] = new_it;  
+        v->m_vit    = vit;
+        this->journalInsertedVertex(v);
+
+        new_vertices[B_vp.first] = v;
 
-        debugl(5, "added vertex %5d from b under new id %5d. position: \n", B_v.id(), new_it->id() );
-        B_v.pos().print_debugl(5);
+        debugl(5, "added vertex %5d from b under new id %5d.\n", B_vp.first, new_id);
     }
 
     /* add all faces of B to (this) mesh while taking care to replace old vertex ids from B with the
@@ -2171,22 +2440,22 @@ Mesh<Tm, Tv, Tf, R>::copyAppend(const Mesh &B)
         if (B_f.isQuad()) {
             B_f.getQuadIndices(v0_id, v1_id, v2_id, v3_id);
             this->faces.insert(
-                new_vertex_its[v0_id],
-                new_vertex_its[v1_id],
-                new_vertex_its[v2_id],
-                new_vertex_its[v3_id]);
+                new_vertices[v0_id]->iterator(),
+                new_vertices[v1_id]->iterator(),
+                new_vertices[v2_id]->iterator(),
+                new_vertices[v3_id]->iterator());
         }
         else if (B_f.isTri()) {
             B_f.getTriIndices(v0_id, v1_id, v2_id);
             this->faces.insert(
-                new_vertex_its[v0_id],
-                new_vertex_its[v1_id],
-                new_vertex_its[v2_id]);
+                new_vertices[v0_id]->iterator(),
+                new_vertices[v1_id]->iterator(),
+                new_vertices[v2_id]->iterator());
         }
         else throw MeshEx(MESH_LOGIC_ERROR, "Mesh::copyAppend(): found face that is neither quad nor triangle. general case intentionally unsupported right now => internal logic error.");
     }
 
-    this->octree_updated    = false;
+    this->spatial_index_updated = false;
 
     debugTabDec();
     debugl(4, "Mesh::appendCopy(): done.\n");
@@ -2198,19 +2467,9 @@ Mesh<Tm, Tv, Tf, R>::moveAppend(
     Mesh                           &B,
     std::list<vertex_iterator>     *update_vits)
 {
-    uint32_t                            new_id;
+    uint32_t                            new_id, v_first, f_first;
     Vertex                             *v;
-    typename std::map<
-            uint32_t,
-            VertexPointerType
-        >::iterator                     v_newit;
     Face                               *f;
-    typename std::map<
-            uint32_t,
-            FacePointerType
-        >::iterator                     f_newit;
-    bool                                inserted;
-        
 
     debugl(2, "Mesh::moveAppend()\n");
     debugTabInc();
@@ -2230,73 +2489,55 @@ Mesh<Tm, Tv, Tf, R>::moveAppend(
         }
     }
 
-    /* add all vertices of B to (this) mesh, store iterators to new vertices */
-    std::pair<
-            typename std::map<uint32_t, VertexPointerType>::iterator,
-            bool
-        > v_rpair;
-    auto B_vit = B.V.begin();
-    while (B_vit != B.V.end()) {
-        /* get fresh vertex id */
-        new_id      = this->V_idq.getId();
-
-        /* insert pair (new_id, pointer B_vit->second) into this->V */
-        v_rpair     = this->V.insert( { new_id, VertexPointerType(B_vit->second) } );
-        inserted    = v_rpair.second;
-        if (inserted) {
-            /* the vertex pointer has been moved to (this) mesh: update mesh pointer Vertex::mesh
-             * and iterator Vertex::m_vit */
-            /* get pointer to vertex */
-            v_newit     = v_rpair.first;
-            v           = v_newit->second;
-            v->mesh     = this;
-            v->m_vit    = v_newit;
-
-            /* erase B_vit from B.V */
-            B_vit       = B.V.erase(B_vit); 
-        }
-        else {
+    /* move all vertices of B to (this) mesh. fresh ids are assigned in the order of B's ids. if the id queue can hand
+     * out a consecutive range, all new ids exceed all existing ids, and every insertion with hint end() takes
+     * amortized constant time. otherwise, ids are drawn one by one and the hint is merely ignored. */
+    bool const v_range = this->V_idq.getIdRange(B.V.size(), v_first);
+    for (auto &B_vp : B.V) {
+        new_id      = v_range ? v_first++ : this->V_idq.getId();
+
+        size_t const nV = this->V.size();
+        auto v_newit = this->V.insert(this->V.end(), { new_id, B_vp.second });
+        if (this->V.size() == nV) {
             debugTabDec();
             throw MeshEx(MESH_LOGIC_ERROR, "Mesh::moveAppend(): insertion of vertex pointer into this->V with fresh id failed. internal logic error.");
         }
+
+        /* the vertex pointer has been moved to (this) mesh: update mesh pointer Vertex::mesh
+         * and iterator Vertex::m_vit */
+        v           = v_newit->second;
+        v->mesh     = this;
+        v->m_vit    = v_newit;
+        this->journalInsertedVertex(v);
     }
 
     /* move all faces of B to (this) mesh in very much the same way */
-    std::pair<
-            typename std::map<uint32_t, FacePointerType >::iterator,
-            bool
-        > f_rpair;
-    auto B_fit = B.F.begin();
-    while (B_fit != B.F.end()) {
-        new_id      = this->F_idq.getId();
-        auto it = this->F.find(new_id);
-        if ( it != this->F.end()) {
-            debugTabDec();
-            throw MeshEx(MESH_LOGIC_ERROR, "Mesh::moveAppend(): fresh id already taken in this->F. internal logic error.\n");
-        }
-        f_rpair     = this->F.insert( { new_id, FacePointerType(B_fit->second) } );
-        inserted    = f_rpair.second;
-        if (!inserted) {
+    bool const f_range = this->F_idq.getIdRange(B.F.size(), f_first);
+    for (auto &B_fp : B.F) {
+        new_id      = f_range ? f_first++ : this->F_idq.getId();
+
+        size_t const nF = this->F.size();
+        auto f_newit = this->F.insert(this->F.end(), { new_id, B_fp.second });
+        if (this->F.size() == nF) {
             debugTabDec();
             throw MeshEx(MESH_LOGIC_ERROR, "Mesh::moveAppend(): insertion of face pointer into this->F with fresh id failed. internal logic error.");
         }
-        else {
-            f_newit     = f_rpair.first;
-            f           = f_newit->second;
-            f->mesh     = this;
-            f->m_fit    = f_newit;
-            B_fit       = B.F.erase(B_fit); 
-        }
+
+        f           = f_newit->second;
+        f->mesh     = this;
+        f->m_fit    = f_newit;
+        this->journalInsertedFace(f);
+        this->bvhFaceChanged(f);
     }
 
-    /* mesh octree needs update */
-    this->octree_updated    = false;
+    /* all pointers have been moved: drop B's map nodes at once instead of erasing them one by one */
+    B.V.clear();
+    B.F.clear();
+
+    /* mesh spatial index needs update */
+    this->spatial_index_updated = false;
 
     /* clear all information from B (B.V and B.F are empty, yet id queues etc are still set */
-    if (!B.F.empty() || !B.V.empty()) {
-        debugTabDec();
-        throw MeshEx(MESH_LOGIC_ERROR, "Mesh::moveAppend(): internal vertex and face maps of appended mesh not empty at the end of process. internal logic error.");
-    }
     B.clear();
 
     /* if update_vits != NULL, the list update_list of vertex pointers corresponding to the list of
@@ -2371,7 +2612,7 @@ Mesh<Tm, Tv, Tf, R>::deleteConnectedComponent(vertex_iterator vstart_it)
     }
     debugTabDec();
 
-    this->octree_updated = false;
+    this->spatial_index_updated = false;
 
     debugTabDec();
     debugl(2, "Mesh::deleteConnectedComponent(). done.\n");
@@ -2586,529 +2827,549 @@ restart_loop:
         debugTabDec();
     }
 
-    /* octree no longer up to date */
-    this->octree_updated = false;
+    /* spatial index no longer up to date */
+    this->spatial_index_updated = false;
 
     debugTabDec();
     debugl(2, "Mesh::deleteBorderCCsAndIsolatedVertices(): done.\n");
 }
 
+/* ----------------------------------------------------------------------------------------------------------------- *
+ *
+ *                       undo journal
+ *
+ * ----------------------------------------------------------------------------------------------------------------- */
 template <typename Tm, typename Tv, typename Tf, typename R>
 void
-Mesh<Tm, Tv, Tf, R>::updateOctree()
+Mesh<Tm, Tv, Tf, R>::checkpoint()
 {
-    using namespace Aux::Timing;
-    using Aux::Numbers::inf;
-    using Aux::VecMat::minVec3;
-    using Aux::VecMat::maxVec3;
-    using Aux::VecMat::fabsVec3;
-
-    debugl(1, "Mesh::updateOctree():..\n");
-    debugTabInc();
+    /* accept all changes since a possibly existing previous checkpoint */
+    this->journalDiscard();
 
-    if (!this->octree_updated) {
-        R                       rootcube_len;
-        Mesh_OctreeInfo         tree_info;
-        Mesh_OctreeNodeInfo     root_info;
-        std::list<Face *>       root_face_list;
-        std::list<Vertex *>     root_vertex_list;
-
-        tick(15);
-
-        /* compute AABB fore entire mesh */
-        this->bb    = BoundingBox<R>();
+    /* the id queues are snapshot as a whole: ids freed and retaken after the checkpoint must be available again in
+     * the same order after a rollback. */
+    this->journal_V_idq     = this->V_idq;
+    this->journal_F_idq     = this->F_idq;
+    this->journal_active    = true;
+}
 
-        for (auto &f : this->faces) {
-            this->bb.update(f.getBoundingBox());
-        }
+template <typename Tm, typename Tv, typename Tf, typename R>
+void
+Mesh<Tm, Tv, Tf, R>::rollback()
+{
+    debugl(2, "Mesh::rollback(): %zu inserted vertices, %zu inserted faces, %zu journaled vertices, %zu journaled faces.\n",
+        this->journal_inserted_vertices.size(), this->journal_inserted_faces.size(),
+        this->journal_vertex_records.size(), this->journal_face_records.size());
 
-        this->bb.extend(0.025, Vec3<R>(1E-3, 1E-3, 1E-3));
+    if (!this->journal_active) {
+        throw MeshEx(MESH_LOGIC_ERROR, "Mesh::rollback(): no checkpoint set.");
+    }
 
-        /* compute root cube length with mesh bounding box */
-        Vec3<R> aabb_min = this->bb.min();
-        Vec3<R> aabb_max = this->bb.max();
+    /* firstly, remove all vertices / faces that have been inserted since the checkpoint and still exist. their
+     * adjacency / incidence information is not updated, since all vertices existing at the checkpoint which refer to
+     * them are restored from the journal below. */
+    for (auto f : this->journal_inserted_faces) {
+        this->F.erase(f->m_fit);
+        this->bvhFaceErased(f);
+        delete f;
+    }
+    for (auto v : this->journal_inserted_vertices) {
+        this->V.erase(v->m_vit);
+        delete v;
+    }
 
-        debugl(1, "bounding box for entire mesh: (%5.4f, %5.4f, %5.4f) - (%5.4f, %5.4f, %5.4f)\n", 
-                aabb_min[0], aabb_min[1], aabb_min[2],
-                aabb_max[0], aabb_max[1], aabb_max[2]);
+    /* secondly, re-attach all erased faces / vertices under their original ids and restore the recorded state. this
+     * has to happen after the removal above, since an original id might have been retaken by an inserted element. */
+    std::pair<typename std::map<uint32_t, FacePointerType>::iterator, bool> f_rpair;
+    for (auto &fr : this->journal_face_records) {
+        Face                   *f   = fr.first;
+        JournalFaceRecord      &rec = fr.second;
 
-        /* fresh Octree .. */
-        if (O) {
-            delete O;
+        if (rec.erased) {
+            f_rpair = this->F.insert( { rec.id, FacePointerType(f) } );
+            if (!f_rpair.second) {
+                throw MeshEx(MESH_LOGIC_ERROR, "Mesh::rollback(): original id of erased face already taken. internal logic error.");
+            }
+            f->m_fit = f_rpair.first;
         }
+        f->vertices = rec.vertices;
+        f->quad     = rec.quad;
+        this->bvhFaceChanged(f);
+    }
 
-        rootcube_len = std::max(aabb_max[0] - aabb_min[0], aabb_max[1] - aabb_min[1]);
-        rootcube_len = std::max(rootcube_len, aabb_max[2] - aabb_min[2]);
-
-        root_info.cube_min      = aabb_min;
-        root_info.cube_max[0]   = aabb_min[0] + rootcube_len;
-        root_info.cube_max[1]   = aabb_min[1] + rootcube_len;
-        root_info.cube_max[2]   = aabb_min[2] + rootcube_len;
+    std::pair<typename std::map<uint32_t, VertexPointerType>::iterator, bool> v_rpair;
+    for (auto &vr : this->journal_vertex_records) {
+        Vertex                 *v   = vr.first;
+        JournalVertexRecord    &rec = vr.second;
 
-        debugl(1, "root cube:: (%5.4f, %5.4f, %5.4f) len: (%5.4f, %5.4f, %5.4f)\n", 
-                root_info.cube_min[0], root_info.cube_min[1], root_info.cube_min[2],
-                root_info.cube_max[0], root_info.cube_max[1], root_info.cube_max[2]);
+        if (rec.erased) {
+            v_rpair = this->V.insert( { rec.id, VertexPointerType(v) } );
+            if (!v_rpair.second) {
+                throw MeshEx(MESH_LOGIC_ERROR, "Mesh::rollback(): original id of erased vertex already taken. internal logic error.");
+            }
+            v->m_vit = v_rpair.first;
+        }
+        v->adjacent_vertices.swap(rec.adjacent_vertices);
+        v->incident_faces.swap(rec.incident_faces);
+    }
 
+    /* restore id queues, clear journal, but keep the checkpoint */
+    this->V_idq = this->journal_V_idq;
+    this->F_idq = this->journal_F_idq;
 
-        /* init face list containing pointers to all mesh faces, which is passed to the partitioning
-         * function */
-        for (auto &f : this->faces) {
-            root_face_list.push_back( &f );
-        }
+    this->journal_inserted_vertices.clear();
+    this->journal_inserted_faces.clear();
+    this->journal_vertex_records.clear();
+    this->journal_face_records.clear();
 
-        for (auto &v : this->vertices) {
-            root_vertex_list.push_back( &v );
-        }
+    /* mesh spatial index needs update */
+    this->spatial_index_updated = false;
 
-        /* topoloy information is updated -> bounding box is up to date as well */
-        O = new Octree<Mesh_OctreeInfo, Mesh_OctreeNodeInfo, R>(
-                tree_info,
-                root_info,
-                aabb_min,
-                rootcube_len);
+    debugl(2, "Mesh::rollback(): done.\n");
+}
 
-        /* call recursive partitioning algorithm */
-        debugl(2, "calling recursive partitioning / construction algorithm.\n", time);
-        Mesh::partitionOctree(*O, (*this), &(O->root), root_face_list, root_vertex_list, 0, 64, 9);
+template <typename Tm, typename Tv, typename Tf, typename R>
+void
+Mesh<Tm, Tv, Tf, R>::releaseCheckpoint()
+{
+    this->journalDiscard();
+}
 
-        debugl(2, "recursive octree construction done. time: %10.5f\n", tack(15));
+template <typename Tm, typename Tv, typename Tf, typename R>
+bool
+Mesh<Tm, Tv, Tf, R>::gotCheckpoint() const
+{
+    return (this->journal_active);
+}
 
-        /* octree has been updated */
-        this->octree_updated = true;
+template <typename Tm, typename Tv, typename Tf, typename R>
+void
+Mesh<Tm, Tv, Tf, R>::journalVertex(Vertex *v)
+{
+    if (!this->journal_active || this->journal_inserted_vertices.count(v) > 0) {
+        return;
     }
 
-    debugTabDec();
-    debugl(1, "Mesh::updateOctree(). done.\n");
+    /* record state only on first modification, i.e. the state at the checkpoint */
+    auto rpair = this->journal_vertex_records.insert( { v, JournalVertexRecord() } );
+    if (rpair.second) {
+        JournalVertexRecord &rec    = rpair.first->second;
+        rec.id                      = v->id();
+        rec.erased                  = false;
+        rec.adjacent_vertices       = v->adjacent_vertices;
+        rec.incident_faces          = v->incident_faces;
+    }
 }
 
-/* locate vertices in or very nearly in bounding box (octree is not fully constructed due to massive
- * overhead, to the vicinity might be returned as well, but not much..) */
 template <typename Tm, typename Tv, typename Tf, typename R>
 void
-Mesh<Tm, Tv, Tf, R>::findVertices(
-    BoundingBox<R> const   &search_box,
-    std::list<Vertex *>    &vertex_list)
+Mesh<Tm, Tv, Tf, R>::journalFace(Face *f)
 {
-    using namespace Aux::Geometry::IntersectionTestResults;
+    if (!this->journal_active || this->journal_inserted_faces.count(f) > 0) {
+        return;
+    }
 
-    Vec3<R> aabb_min = search_box.min(), aabb_max = search_box.max();
+    auto rpair = this->journal_face_records.insert( { f, JournalFaceRecord() } );
+    if (rpair.second) {
+        JournalFaceRecord &rec      = rpair.first->second;
+        rec.id                      = f->id();
+        rec.erased                  = false;
+        rec.quad                    = f->quad;
+        rec.vertices                = f->vertices;
+    }
+}
 
-    debugl(2, "Mesh::findVertices(): input bb (%5.4f, %5.4f, %5.4f) - (%5.4f, %5.4f, %5.4f)(\n",
-            aabb_min[0], aabb_min[1], aabb_min[2],
-            aabb_max[0], aabb_max[1], aabb_max[2]);
-    debugTabInc();
+template <typename Tm, typename Tv, typename Tf, typename R>
+void
+Mesh<Tm, Tv, Tf, R>::journalInsertedVertex(Vertex *v)
+{
+    if (this->journal_active) {
+        this->journal_inserted_vertices.insert(v);
+    }
+}
 
-    if (!octree_updated) {
-        this->updateOctree();
+template <typename Tm, typename Tv, typename Tf, typename R>
+void
+Mesh<Tm, Tv, Tf, R>::journalInsertedFace(Face *f)
+{
+    if (this->journal_active) {
+        this->journal_inserted_faces.insert(f);
     }
+}
 
-    /* recursive octree location traversal, set face list argument to NULL since only faces need to
-     * be found */
-    Mesh::findOctreeRecursive(O, &(O->root), aabb_min, aabb_max, &vertex_list, NULL);
+template <typename Tm, typename Tv, typename Tf, typename R>
+bool
+Mesh<Tm, Tv, Tf, R>::journalRetainVertex(Vertex *v)
+{
+    if (!this->journal_active) {
+        return false;
+    }
+    /* vertex inserted after the checkpoint: forget about it, it can be deleted right away. */
+    else if (this->journal_inserted_vertices.erase(v) > 0) {
+        return false;
+    }
+    /* vertex existed at the checkpoint: keep it alive. isolated vertices might not have been journaled yet. */
+    else {
+        this->journalVertex(v);
+        this->journal_vertex_records[v].erased = true;
+        return true;
+    }
+}
 
-    /* we want unique lists */
-    vertex_list.sort([] (const Vertex* x, const Vertex* y) -> bool {return (x->id() < y->id());});
-    vertex_list.unique([] (const Vertex* x, const Vertex* y) -> bool {return (x->id() == y->id());});
+template <typename Tm, typename Tv, typename Tf, typename R>
+bool
+Mesh<Tm, Tv, Tf, R>::journalRetainFace(Face *f)
+{
+    if (!this->journal_active) {
+        return false;
+    }
+    else if (this->journal_inserted_faces.erase(f) > 0) {
+        return false;
+    }
+    else {
+        this->journalFace(f);
+        this->journal_face_records[f].erased = true;
+        return true;
+    }
+}
 
-    /* delete vertices whose bounding box does not intersect the given search box */
-    for (auto it = vertex_list.begin(); it != vertex_list.end(); ) {
-        if (search_box && (*it)->getBoundingBox()) {
-            ++it;
+template <typename Tm, typename Tv, typename Tf, typename R>
+void
+Mesh<Tm, Tv, Tf, R>::journalDiscard()
+{
+    /* erased elements kept alive for a potential rollback are no longer referenced by the mesh => deallocate */
+    for (auto &vr : this->journal_vertex_records) {
+        if (vr.second.erased) {
+            delete vr.first;
         }
-        else {
-            it = vertex_list.erase(it);
+    }
+    for (auto &fr : this->journal_face_records) {
+        if (fr.second.erased) {
+            delete fr.first;
         }
     }
 
-    debugTabDec();
-    debugl(2, "Mesh::findVertices(): done. %d vertices found.\n", vertex_list.size() );
+    this->journal_inserted_vertices.clear();
+    this->journal_inserted_faces.clear();
+    this->journal_vertex_records.clear();
+    this->journal_face_records.clear();
+    this->journal_active = false;
 }
 
 template <typename Tm, typename Tv, typename Tf, typename R>
 void
-Mesh<Tm, Tv, Tf, R>::findFaces(
-    BoundingBox<R> const   &search_box,
-    std::list<Face *>      &face_list)
+Mesh<Tm, Tv, Tf, R>::updateSpatialIndex(uint32_t nthreads)
 {
-    using namespace Aux::Geometry::IntersectionTestResults;
-
-    Vec3<R> aabb_min = search_box.min(), aabb_max = search_box.max();
+    using namespace Aux::Timing;
 
-    debugl(2, "Mesh::findFaces(): input bb (%5.4f, %5.4f, %5.4f) - (%5.4f, %5.4f, %5.4f)(\n",
-            aabb_min[0], aabb_min[1], aabb_min[2],
-            aabb_max[0], aabb_max[1], aabb_max[2]);
+    debugl(1, "Mesh::updateSpatialIndex():..\n");
     debugTabInc();
 
-    if (aabb_min >= aabb_max) {
-        debugl(1, "Mesh::findFaces(): invalid bounding box: (%5.4f, %5.4f, %20.10e) - (%5.4f, %5.4f, %20.10e)\n",
-                aabb_min[0], aabb_min[1], aabb_min[2],
-                aabb_max[0], aabb_max[1], aabb_max[2]);
+    if (!this->spatial_index_updated) {
+        std::vector<std::pair<Face *, BoundingBox<R>>>     face_elements;
+        std::vector<std::pair<Vertex *, BoundingBox<R>>>   vertex_elements;
 
-        throw MeshEx(MESH_LOGIC_ERROR, "Mesh::findFaces(): invalid input bounding boxes: minimum value >= maximum value for some component.");
-    }
+        tick(15);
 
-    /* clear face_list */
-    face_list.clear();
+        /* collect elements with their bounding boxes and compute AABB for entire mesh */
+        this->bb    = BoundingBox<R>();
 
-    if (!octree_updated) {
-        this->updateOctree();
-    }
+        face_elements.reserve(this->F.size());
+        for (auto &f : this->faces) {
+            face_elements.push_back({ &f, f.getBoundingBox() });
+            this->bb.update(face_elements.back().second);
+        }
 
-    /* recursive octree location traversal, set vertex list argument to NULL since only faces need
-     * to be found */
-    Mesh::findOctreeRecursive(O, &(O->root), aabb_min, aabb_max, NULL, &face_list);
+        vertex_elements.reserve(this->V.size());
+        for (auto &v : this->vertices) {
+            vertex_elements.push_back({ &v, v.getBoundingBox() });
+        }
 
-    /* we want unique lists */
-    face_list.sort([] (const Face* x, const Face* y) -> bool {return (x->id() < y->id());});
-    face_list.unique([] (const Face* x, const Face* y) -> bool {return (x->id() == y->id());});
+        this->bb.extend(0.025, Vec3<R>(1E-3, 1E-3, 1E-3));
 
-    /* delete faces whose bounding box does not intersect the given search box */
-    for (auto it = face_list.begin(); it != face_list.end(); ) {
-        if (search_box && (*it)->getBoundingBox()) {
-            ++it;
-        }
-        else {
-            it = face_list.erase(it);
-        }
+        Vec3<R> aabb_min = this->bb.min();
+        Vec3<R> aabb_max = this->bb.max();
+
+        debugl(1, "bounding box for entire mesh: (%5.4f, %5.4f, %5.4f) - (%5.4f, %5.4f, %5.4f)\n", 
+                aabb_min[0], aabb_min[1], aabb_min[2],
+                aabb_max[0], aabb_max[1], aabb_max[2]);
+
+        /* only large meshes are sorted in parallel, see LinearBVH::radixSort(). */
+        nthreads = std::max(1u, nthreads);
+
+        this->face_bvh.build(face_elements, this->bb, nthreads);
+        this->vertex_bvh.build(vertex_elements, this->bb, nthreads);
+
+        debugl(2, "bounding volume hierarchy construction done. time: %10.5f\n", tack(15));
+
+        /* spatial index has been updated, start tracking face changes from here */
+        this->bvhDropTracking();
+        this->spatial_index_updated = true;
+        this->face_bvh_tracked      = true;
     }
 
     debugTabDec();
-    debugl(2, "Mesh::findFaces(): done. %d faces found.\n", face_list.size() );
+    debugl(1, "Mesh::updateSpatialIndex(). done.\n");
 }
 
 template <typename Tm, typename Tv, typename Tf, typename R>
 void
-Mesh<Tm, Tv, Tf, R>::find(
-    BoundingBox<R> const   &search_box,
-    std::list<Vertex *>    *vertex_list,
-    std::list<Face *>      *face_list)
+Mesh<Tm, Tv, Tf, R>::setSpatialIndexThreads(uint32_t nthreads)
 {
-    using namespace Aux::Geometry::IntersectionTestResults;
+    this->spatial_index_nthreads = std::max(1u, nthreads);
+}
 
-    Vec3<R> aabb_min = search_box.min(), aabb_max = search_box.max();
+/* f has been inserted or modified: its entry in face_bvh, if any, is stale, and it becomes pending. */
+template <typename Tm, typename Tv, typename Tf, typename R>
+void
+Mesh<Tm, Tv, Tf, R>::bvhFaceChanged(Face *f)
+{
+    if (this->face_bvh_tracked) {
+        this->bvh_stale_faces.insert(f);
+        this->bvh_changed_faces[f] = 0;
+        this->bvh_pending_faces.push_back(f);
 
-    debugl(2, "Mesh::findFaces(): input bb (%5.4f, %5.4f, %5.4f) - (%5.4f, %5.4f, %5.4f)(\n",
-            aabb_min[0], aabb_min[1], aabb_min[2],
-            aabb_max[0], aabb_max[1], aabb_max[2]);
-    debugTabInc();
+        if (this->bvh_stale_faces.size() > 1024 + this->face_bvh.size() / 2) {
+            this->bvhDropTracking();
+        }
+    }
+}
 
-    if (aabb_min >= aabb_max) {
-        debugl(1, "Mesh::findFaces(): invalid bounding box: (%5.4f, %5.4f, %20.10e) - (%5.4f, %5.4f, %20.10e)\n",
-                aabb_min[0], aabb_min[1], aabb_min[2],
-                aabb_max[0], aabb_max[1], aabb_max[2]);
+/* f is about to be erased. its pointer is only used as a key from now on, since it might be deallocated and reused by
+ * a face inserted later, which is then recorded as changed. */
+template <typename Tm, typename Tv, typename Tf, typename R>
+void
+Mesh<Tm, Tv, Tf, R>::bvhFaceErased(Face *f)
+{
+    if (this->face_bvh_tracked) {
+        this->bvh_stale_faces.insert(f);
+        this->bvh_changed_faces.erase(f);
 
-        throw MeshEx(MESH_LOGIC_ERROR, "Mesh::findFaces(): invalid input bounding boxes: minimum value >= maximum value for some component.");
+        if (this->bvh_stale_faces.size() > 1024 + this->face_bvh.size() / 2) {
+            this->bvhDropTracking();
+        }
     }
+}
 
-    /* clear input lists */
-    if (vertex_list)    vertex_list->clear();
-    if (face_list)      face_list->clear();
+template <typename Tm, typename Tv, typename Tf, typename R>
+void
+Mesh<Tm, Tv, Tf, R>::bvhDropTracking()
+{
+    this->bvh_stale_faces.clear();
+    this->bvh_changed_faces.clear();
+    this->bvh_pending_faces.clear();
+    this->bvh_levels.clear();
+    this->bvh_next_serial       = 1;
+    this->face_bvh_tracked      = false;
+    this->spatial_index_updated = false;
+}
 
-    if (!octree_updated) {
-        this->updateOctree();
+/* collect all pending faces into a new level and merge it with all preceding levels that are not larger. entries of
+ * faces that have been erased or modified since are recognized by their serial and dropped on the way. */
+template <typename Tm, typename Tv, typename Tf, typename R>
+void
+Mesh<Tm, Tv, Tf, R>::bvhUpdateLevels()
+{
+    if (this->bvh_pending_faces.empty()) {
+        return;
     }
 
-    /* if not both vertex_list and face_list are NULL, call recursive octree location traversal */
-    if (vertex_list || face_list) {
-        Mesh::findOctreeRecursive(O, &(O->root), aabb_min, aabb_max, vertex_list, face_list);
-
-        /* we want unique lists */
-        vertex_list->sort([] (const Vertex* x, const Vertex* y) -> bool {return (x->id() < y->id());});
-        vertex_list->unique([] (const Vertex* x, const Vertex* y) -> bool {return (x->id() == y->id());});
+    uint32_t const      serial = this->bvh_next_serial++;
+    std::vector<Face *> faces;
 
-        /* delete vertices whose bounding box does not intersect the given search box */
-        Vec3<R> v_bb_min, v_bb_max;
-        for (auto it = vertex_list->begin(); it != vertex_list->end(); ) {
-            if (search_box && (*it)->getBoundingBox()) {
-                ++it;
-            }
-            else {
-                it = vertex_list->erase(it);
+    auto take = [&] (Face *f, uint32_t old_serial) -> void
+        {
+            auto it = this->bvh_changed_faces.find(f);
+            if (it != this->bvh_changed_faces.end() && it->second == old_serial) {
+                it->second = serial;
+                faces.push_back(f);
             }
+        };
+
+    for (auto f : this->bvh_pending_faces) {
+        take(f, 0);
+    }
+    this->bvh_pending_faces.clear();
+
+    while (!this->bvh_levels.empty() && this->bvh_levels.back().faces.size() <= faces.size()) {
+        for (auto f : this->bvh_levels.back().faces) {
+            take(f, this->bvh_levels.back().serial);
         }
+        this->bvh_levels.pop_back();
+    }
 
-        face_list->sort([] (const Face* x, const Face* y) -> bool {return (x->id() < y->id());});
-        face_list->unique([] (const Vertex* x, const Vertex* y) -> bool {return (x->id() == y->id());});
+    if (!faces.empty()) {
+        std::vector<std::pair<Face *, BoundingBox<R>>>  elements;
+        BoundingBox<R>                                  level_bb;
 
-        /* delete faces whose bounding box does not intersect the given search box */
-        for (auto it = face_list->begin(); it != face_list->end(); ) {
-            if (search_box && (*it)->getBoundingBox()) {
-                ++it;
-            }
-            else {
-                it = face_list->erase(it);
-            }
+        elements.reserve(faces.size());
+        for (auto f : faces) {
+            elements.push_back({ f, f->getBoundingBox() });
+            level_bb.update(elements.back().second);
         }
+        level_bb.extend(0.025, Vec3<R>(1E-3, 1E-3, 1E-3));
 
+        this->bvh_levels.push_back(FaceBVHLevel());
+        this->bvh_levels.back().serial = serial;
+        this->bvh_levels.back().faces.swap(faces);
+        this->bvh_levels.back().bvh.build(elements, level_bb);
     }
-
-    debugTabDec();
-    debugl(2, "Mesh::findFaces(): done. %d faces found.\n", face_list->size() );
 }
 
-/* static recursive partitioning function for Octree construction */
 template <typename Tm, typename Tv, typename Tf, typename R>
+template <typename FaceCallback>
 void
-Mesh<Tm, Tv, Tf, R>::partitionOctree(
-    Octree<Mesh_OctreeInfo, Mesh_OctreeNodeInfo, R>    &O,
-    Mesh const                                         &m,
-    OctreeNode<Mesh_OctreeNodeInfo>                    *n,
-    std::list<Face *>                                  &rec_facelist,
-    std::list<Vertex *>                                &rec_vertexlist,
-    uint32_t                                            rec_depth,
-    uint32_t                                            max_elements,
-    uint32_t                                            max_rec_depth)
-{
-    using namespace Aux::Geometry::IntersectionTestResults;
-
-    debugl(5, "Mesh::partitionOctree() (recursive)\n");
-    debugTabInc();
-
-    debugl(5, "depth %4d. facelist.size(): %6ld\n", rec_depth, rec_facelist.size() );
-    /* leaf reached. save face_list */
-    if (rec_depth >= max_rec_depth) {
-        n->data.face_list   = rec_facelist;
-        n->data.vertex_list = rec_vertexlist;
-        debugl(5, "max depth reached => creating leaf.\n");
+Mesh<Tm, Tv, Tf, R>::queryFaces(
+    BoundingBox<R> const   &search_box,
+    FaceCallback          &&f)
+{
+    if (!this->face_bvh_tracked) {
+        this->updateSpatialIndex(this->spatial_index_nthreads);
     }
-    /* partition face list with current cube, recursive call */
-    else {
-        /* if rec_facelist contains more than max_faces, process it */
-        if (rec_facelist.size() + rec_vertexlist.size() > max_elements) {
-            debugl(5, "max depth not yet reached => partitioning %8ld faces and %8ld vertices among children..\n", rec_facelist.size(), rec_vertexlist.size() );
-            uint32_t                            i;
-            Vec3<R>                             nc_min, nc_max, nc_m;
-            Vec3<R>                             xdisp, ydisp, zdisp;
-
-            std::list<Face *>                  *children_facelists[8];
-            std::list<Vertex *>                *children_vertexlists[8];
-            OctreeNode<Mesh_OctreeNodeInfo>    *children[8];
-
-            /* split node n, which is currently still a leaf */
-            O.splitLeaf(n);
-
-            /* get child pointers and allocate face lists for children */
-            for (i = 0; i < 8; i++) {
-                children[i]             = n->getChild(i);
-                children_facelists[i]   = new std::list<Face *>;
-                children_vertexlists[i] = new std::list<Vertex *>;
-            }
+    this->bvhUpdateLevels();
 
-            /* compute midpoint of n's cube and init children's cube min / max vectors.
-             * incidentally, this does not need to be a cube here.. but who cares. the OtId thing
-             * has been designed for DMC and is not used here. space.. well.. o_O */
-            nc_min                      = n->data.cube_min;
-            nc_max                      = n->data.cube_max;
-            nc_m                        = (nc_min + nc_max) * 0.5;
-
-            xdisp                       = Vec3<R>( (nc_max[0] - nc_min[0]) / 2.0, 0.0, 0.0);
-            ydisp                       = Vec3<R>( 0.0, (nc_max[1] - nc_min[1]) / 2.0, 0.0);
-            zdisp                       = Vec3<R>( 0.0, 0.0, (nc_max[2] - nc_min[2]) / 2.0);
-
-            /* child 0: n_min and midpoint. offsetting from there with displacement vectors */
-            children[0]->data.cube_min  = nc_min;
-            children[0]->data.cube_max  = nc_m;
-
-            children[1]->data.cube_min  = nc_min + xdisp;
-            children[1]->data.cube_max  = nc_m + xdisp;
-
-            children[2]->data.cube_min  = nc_min + xdisp + ydisp;
-            children[2]->data.cube_max  = nc_m + xdisp + ydisp;
-
-            children[3]->data.cube_min  = nc_min + ydisp;
-            children[3]->data.cube_max  = nc_m + ydisp;
-
-            children[4]->data.cube_min  = nc_min + zdisp;
-            children[4]->data.cube_max  = nc_m + zdisp;
-
-            children[5]->data.cube_min  = nc_min + xdisp + zdisp;
-            children[5]->data.cube_max  = nc_m + xdisp + zdisp;
-
-            /* special case: child 6 has min corner m and max corner nc_max */
-            children[6]->data.cube_min  = nc_m;
-            children[6]->data.cube_max  = nc_max;
-
-            children[7]->data.cube_min  = nc_min + ydisp + zdisp;
-            children[7]->data.cube_max  = nc_m + ydisp + zdisp;
-
-            /* iterate over all faces in rec_facelist and partition them into the child lists.
-             * recursive call */
-            Vec3<R> f_aabb_min, f_aabb_max;
-            for (auto &f : rec_facelist) {
-                auto f_bb   = f->getBoundingBox();
-                f_aabb_min  = f_bb.min();
-                f_aabb_max  = f_bb.max();
-
-                /* check for intersections with all eight child cubes. */
-                for (i = 0; i < 8; i++) {
-                    /* mesh face bb intersecting child cube -> push intro children list */
-                    if (Aux::Geometry::simpleIntersect2AABB(
-                            f_aabb_min, 
-                            f_aabb_max,
-                            children[i]->data.cube_min,
-                            children[i]->data.cube_max) == INTERSECTION)
-                    {
-                        children_facelists[i]->push_back(f);
-                    }
-                }
+    /* candidates are filtered with their current bounding box (see findVertices()) */
+    this->face_bvh.query(search_box, [&] (Face *g) -> void
+        {
+            if (this->bvh_stale_faces.count(g) == 0 && (search_box && g->getBoundingBox())) {
+                f(g);
             }
+        });
 
-            /* iterate over all vertices in the list, get the vector, construct a tiny AABB and
-             * distribute among children. AABB length: 2.0*1E-8 */
-            Vec3<R> vpos;
-            Vec3<R> v_aabb_min, v_aabb_max;
-            for (auto &v : rec_vertexlist) {
-                vpos        = v->pos();
-                auto v_bb   = v->getBoundingBox();
-                v_aabb_min  = v_bb.min();
-                v_aabb_max  = v_bb.max();
-
-                /* check for intersections with all eight child cubes. */
-                for (i = 0; i < 8; i++) {
-                    /* mesh face bb intersecting child cube -> push intro children list */
-                    if (Aux::Geometry::simpleIntersect2AABB(
-                            v_aabb_min,
-                            v_aabb_max,
-                            children[i]->data.cube_min,
-                            children[i]->data.cube_max) == INTERSECTION)
-                    {
-                        children_vertexlists[i]->push_back(v);
-                    }
+    for (auto &level : this->bvh_levels) {
+        level.bvh.query(search_box, [&] (Face *g) -> void
+            {
+                auto it = this->bvh_changed_faces.find(g);
+                if (it != this->bvh_changed_faces.end() && it->second == level.serial &&
+                        (search_box && g->getBoundingBox()))
+                {
+                    f(g);
                 }
-            }
-
-            /* clear recursion lists, since they are not needed anymore */
-            rec_facelist.clear();
-            rec_vertexlist.clear();
+            });
+    }
+}
 
-            /* issue recursive calls */
-            for (i = 0; i < 8; i++) {
-                debugl(5, "recursive call for child %02d..\n", i);
+/* locate vertices whose bounding box intersects the given search box. the found vertices are appended to
+ * vertex_list, which is then sorted by id and made unique. */
+template <typename Tm, typename Tv, typename Tf, typename R>
+void
+Mesh<Tm, Tv, Tf, R>::findVertices(
+    BoundingBox<R> const   &search_box,
+    std::list<Vertex *>    &vertex_list)
+{
+    Vec3<R> aabb_min = search_box.min(), aabb_max = search_box.max();
 
-                debugTabInc();
-                /* here we go.. */
-                partitionOctree(O, m, children[i], *(children_facelists[i]), *(children_vertexlists[i]), rec_depth + 1, max_elements, max_rec_depth);
-                debugTabDec();
+    debugl(2, "Mesh::findVertices(): input bb (%5.4f, %5.4f, %5.4f) - (%5.4f, %5.4f, %5.4f)(\n",
+            aabb_min[0], aabb_min[1], aabb_min[2],
+            aabb_max[0], aabb_max[1], aabb_max[2]);
+    debugTabInc();
 
-                debugl(5, "finished recursive call for child %02d..\n", i);
+    if (!spatial_index_updated) {
+        this->updateSpatialIndex(this->spatial_index_nthreads);
+    }
 
-                /* delete child lists allocated above */
-                delete children_facelists[i];
-                delete children_vertexlists[i];
+    /* vertex positions may have been modified through pos() since the last update, so candidates are filtered
+     * with their current bounding box */
+    this->vertex_bvh.query(search_box, [&] (Vertex *v) -> void
+        {
+            if (search_box && v->getBoundingBox()) {
+                vertex_list.push_back(v);
             }
-        }
-        /* otherwise, facelist contains <= max_faces faces and will be turned into a leaf */
-        else {
-            debugl(5, "numer of vertices and faces small enough => creating leaf. \n");
-            n->data.face_list   = rec_facelist;
-            n->data.vertex_list = rec_vertexlist;
-        }
-    }
+        });
+
+    /* we want unique lists */
+    vertex_list.sort([] (const Vertex* x, const Vertex* y) -> bool {return (x->id() < y->id());});
+    vertex_list.unique([] (const Vertex* x, const Vertex* y) -> bool {return (x->id() == y->id());});
 
     debugTabDec();
-    debugl(5, "Mesh::partitionOctree() (recursive): done.\n");
+    debugl(2, "Mesh::findVertices(): done. %d vertices found.\n", vertex_list.size() );
 }
 
-
-/* static recursive octree location traversal: given a bounding box, find all leafs in the octree
- * that intersect the bounding box and return the union of their face lists */
 template <typename Tm, typename Tv, typename Tf, typename R>
 void
-Mesh<Tm, Tv, Tf, R>::findOctreeRecursive(
-    Octree<Mesh_OctreeInfo, Mesh_OctreeNodeInfo, R>    *O,
-    OctreeNode<Mesh_OctreeNodeInfo>                    *n,
-    Vec3<R>                                             aabb_min,
-    Vec3<R>                                             aabb_max,
-    std::list<Vertex *>                                *vertex_list,
-    std::list<Face *>                                  *face_list)
+Mesh<Tm, Tv, Tf, R>::findFaces(
+    BoundingBox<R> const   &search_box,
+    std::list<Face *>      &face_list)
 {
-    using namespace Aux::Geometry::IntersectionTestResults;
+    Vec3<R> aabb_min = search_box.min(), aabb_max = search_box.max();
 
-    debugl(5, "Mesh::findOctreeRecursive() (recursive)\n");
+    debugl(2, "Mesh::findFaces(): input bb (%5.4f, %5.4f, %5.4f) - (%5.4f, %5.4f, %5.4f)(\n",
+            aabb_min[0], aabb_min[1], aabb_min[2],
+            aabb_max[0], aabb_max[1], aabb_max[2]);
     debugTabInc();
 
-    /* n is a leaf, append n's facelist to argument face_list */
-    if (n->isLeaf()) {
-        debugl(5, "given bb (%5.4f, %5.4f, %5.4f) - (%5.4f, %5.4f, %5.4f), n->bb: (%5.4f, %5.4f, %5.4f) - (%5.4f, %5.4f, %5.4f): leaf => appending %5d faces and / or %d vertices.\n",
-                aabb_min[0], aabb_min[1], aabb_min[2], 
-                aabb_max[0], aabb_max[1], aabb_max[2], 
-                n->data.cube_min[0], n->data.cube_min[1], n->data.cube_min[2],
-                n->data.cube_max[0], n->data.cube_max[1], n->data.cube_max[2],
-                n->data.vertex_list.size(), n->data.face_list.size());
+    if (aabb_min >= aabb_max) {
+        debugl(1, "Mesh::findFaces(): invalid bounding box: (%5.4f, %5.4f, %20.10e) - (%5.4f, %5.4f, %20.10e)\n",
+                aabb_min[0], aabb_min[1], aabb_min[2],
+                aabb_max[0], aabb_max[1], aabb_max[2]);
 
-        if (vertex_list)    vertex_list->insert( vertex_list->end(), n->data.vertex_list.begin(), n->data.vertex_list.end() );
-        if (face_list)      face_list->insert( face_list->end(), n->data.face_list.begin(), n->data.face_list.end() );
+        throw MeshEx(MESH_LOGIC_ERROR, "Mesh::findFaces(): invalid input bounding boxes: minimum value >= maximum value for some component.");
     }
-    /* otherwise, get all children of n, and call recursively if given bounding box and cube
-     * intersect */
-    else {
-        debugl(5, "given bb (%5.4f, %5.4f, %5.4f) - (%5.4f, %5.4f, %5.4f), n->bb: (%5.4f, %5.4f, %5.4f) - (%5.4f, %5.4f, %5.4f): no leaf => recursive calls..\n",
-                aabb_min[0], aabb_min[1], aabb_min[2], 
-                aabb_max[0], aabb_max[1], aabb_max[2], 
-                n->data.cube_min[0], n->data.cube_min[1], n->data.cube_min[2],
-                n->data.cube_max[0], n->data.cube_max[1], n->data.cube_max[2]);
-
-        OctreeNode<Mesh_OctreeNodeInfo>    *child;
-        uint32_t                            i;
-        for (i = 0; i < 8; i++) {
-            child = n->getChild(i);
-            if (child && Aux::Geometry::simpleIntersect2AABB(
-                        child->data.cube_min,
-                        child->data.cube_max,
-                        aabb_min,
-                        aabb_max) == INTERSECTION)
-            {
-                debugl(5, "child %2d's bb intersects => calling.\n", i);
 
-                debugTabInc();
-                Mesh::findOctreeRecursive(O, child, aabb_min, aabb_max, vertex_list, face_list);
-                debugTabDec();
+    /* clear face_list */
+    face_list.clear();
 
-                debugl(5, "child %2d's call done.\n", i);
-            }
-        }
-    }
+    /* every face is reported exactly once, so sorting suffices */
+    this->queryFaces(search_box, [&] (Face *f) -> void
+        {
+            face_list.push_back(f);
+        });
+    face_list.sort([] (const Face* x, const Face* y) -> bool {return (x->id() < y->id());});
 
     debugTabDec();
-    debugl(5, "Mesh::findOctreeRecursive() (recursive): done.\n");
+    debugl(2, "Mesh::findFaces(): done. %d faces found.\n", face_list.size() );
 }
 
-/* DEBUG: for debugging, output cubes of all leafs */
 template <typename Tm, typename Tv, typename Tf, typename R>
 void
-Mesh<Tm, Tv, Tf, R>::getOctreeLeafCubes(
-    Octree<Mesh_OctreeInfo, Mesh_OctreeNodeInfo, R>    *O,
-    OctreeNode<Mesh_OctreeNodeInfo>                    *n,
-    std::list<std::pair<Vec3<R>, Vec3<R>>>             *cube_list)
+Mesh<Tm, Tv, Tf, R>::find(
+    BoundingBox<R> const   &search_box,
+    std::list<Vertex *>    *vertex_list,
+    std::list<Face *>      *face_list)
 {
-    debugl(5, "Mesh::getOctreeLeafCubes() (recursive)\n");
+    Vec3<R> aabb_min = search_box.min(), aabb_max = search_box.max();
+
+    debugl(2, "Mesh::find(): input bb (%5.4f, %5.4f, %5.4f) - (%5.4f, %5.4f, %5.4f)(\n",
+            aabb_min[0], aabb_min[1], aabb_min[2],
+            aabb_max[0], aabb_max[1], aabb_max[2]);
     debugTabInc();
 
-    /* n is a leaf, append n's facelist to argument face_list */
-    if (n->isLeaf()) {
-        debugl(5, "get_leaf_cubes: leaf => appending cube to list.\n");
-        cube_list->push_back( {n->data.cube_min, n->data.cube_max} );
+    if (aabb_min >= aabb_max) {
+        debugl(1, "Mesh::find(): invalid bounding box: (%5.4f, %5.4f, %20.10e) - (%5.4f, %5.4f, %20.10e)\n",
+                aabb_min[0], aabb_min[1], aabb_min[2],
+                aabb_max[0], aabb_max[1], aabb_max[2]);
+
+        throw MeshEx(MESH_LOGIC_ERROR, "Mesh::find(): invalid input bounding boxes: minimum value >= maximum value for some component.");
     }
-    /* otherwise, get all children of n, and call recursively if given bounding box and cube
-     * intersect */
-    else {
-        OctreeNode<Mesh_OctreeNodeInfo>    *child;
-        uint32_t                            i;
-        debugl(5, "get_leaf_cubes: no leaf => recursive calls for children\n");
-        for (i = 0; i < 8; i++) {
-            child = n->getChild(i);
-            debugl(5, "child %2d's bb intersects => calling.\n", i);
 
-            debugTabInc();
-            Mesh::getOctreeLeafCubes(O, child, cube_list);
-            debugTabDec();
+    /* clear input lists */
+    if (vertex_list)    vertex_list->clear();
+    if (face_list)      face_list->clear();
 
-            debugl(5, "child %2d's call done.\n", i);
-        }
+    if (vertex_list && !spatial_index_updated) {
+        this->updateSpatialIndex(this->spatial_index_nthreads);
+    }
+
+    if (vertex_list) {
+        this->vertex_bvh.query(search_box, [&] (Vertex *v) -> void
+            {
+                if (search_box && v->getBoundingBox()) {
+                    vertex_list->push_back(v);
+                }
+            });
+        vertex_list->sort([] (const Vertex* x, const Vertex* y) -> bool {return (x->id() < y->id());});
+    }
+
+    if (face_list) {
+        this->queryFaces(search_box, [&] (Face *f) -> void
+            {
+                face_list->push_back(f);
+            });
+        face_list->sort([] (const Face* x, const Face* y) -> bool {return (x->id() < y->id());});
     }
 
     debugTabDec();
-    debugl(5, "Mesh::getOctreeLeafCubes() (recursive): done.\n");
+    debugl(2, "Mesh::find(): done.\n");
 }
 
 template <typename Tm, typename Tv, typename Tf, typename R>
@@ -4052,6 +4313,8 @@ Mesh<Tm, Tv, Tf, R>::collapseTriEdge(
         /* finally, delete the vertices u and v, which have now been entirely replaced by w.
          * manually reset adjacency / incidence data to prevent VertexAccessor::erase() from erasing
          * the faces u and v are (were) contained in */
+        this->journalVertex(u_vertex);
+        this->journalVertex(v_vertex);
         u_it->adjacent_vertices.clear();
         u_it->incident_faces.clear();
         v_it->adjacent_vertices.clear();
@@ -4132,6 +4395,8 @@ Mesh<Tm, Tv, Tf, R>::mergeUnrelatedVertices(
     w_it->adjacent_vertices.sort([] (const Vertex* x, const Vertex* y) -> bool {return (x->id() < y->id());});
 
     /* clear adjacent_vertices of u and v */
+    this->journalVertex(&(*u_it));
+    this->journalVertex(&(*v_it));
     u_it->adjacent_vertices.clear();
     v_it->adjacent_vertices.clear();
 
@@ -4392,11 +4657,11 @@ Mesh<Tm, Tv, Tf, R>::checkGeometry(
     R const &eps_v,
     R const &eps_T)
 {
-    debugl(1, "Mesh::checkGeometry(): updating Octree..\n");
+    debugl(1, "Mesh::checkGeometry(): updating spatial index..\n");
     debugTabInc();
 
-    /* update octree if necessary */
-    this->updateOctree();
+    /* update spatial index if necessary */
+    this->updateSpatialIndex(this->spatial_index_nthreads);
 
     Vec3<R>                 v_pos, n_pos;
     R                       v_n_dist;
@@ -4583,164 +4848,39 @@ Mesh<Tm, Tv, Tf, R>::checkGeometry(
 }
 
 /* I/O */
-struct obj_face {
-    bool        quad;
-    uint32_t    v_idx[4];
-    uint32_t    n_idx[4];
-
-    obj_face(
-        bool        quad,
-        bool        use_normals,
-        uint32_t    v0,
-        uint32_t    v1,
-        uint32_t    v2,
-        uint32_t    v3,
-        uint32_t    n0 = 0,
-        uint32_t    n1 = 0,
-        uint32_t    n2 = 0,
-        uint32_t    n3 = 0)
-    {
-        this->quad      = quad;
-        this->v_idx[0]  = v0 - 1;
-        this->v_idx[1]  = v1 - 1;  
-        this->v_idx[2]  = v2 - 1;  
-        if (quad) {
-            this->v_idx[3]  = v3 - 1;
-        }
-
-        if (use_normals) {
-            n_idx[0]    = n0 - 1;
-            n_idx[1]    = n1 - 1;
-            n_idx[2]    = n2 - 1;
-            if (quad) {
-                n_idx[3]    = n3 - 1;
-            }
-        }
-        else {
-            n_idx[0] = 0;
-            n_idx[1] = 0;
-            n_idx[2] = 0;
-            n_idx[3] = 0;
-        }
-    }
-};
-
 template <typename Tm, typename Tv, typename Tf, typename R>
 void
-Mesh<Tm, Tv, Tf, R>::readFromObjFile(const char *filename)
+Mesh<Tm, Tv, Tf, R>::buildFromFileData(Aux::File::ObjData &data)
 {
-    debugl(1, "Mesh::readFromObjFile()");
-    debugTabInc();
-
     /* clear mesh */
     this->clear();
 
-    std::list<Vec3<R>>      vertices;
-    std::list<Vec3<R>>      normals;
-    std::list<obj_face>     faces;
-
-    std::string             line_string;
-    char                   *line;
-    std::ifstream           f;
-
-    f.open(filename, std::ifstream::in);
-    if ( !f.is_open() ) {
-        throw MeshEx(MESH_IO_ERROR, "Mesh::readFromObjFile(): can't open input file\n");
-    }
-
-    R           x, y, z;
-    uint32_t    v0, v1, v2, v3, n0, n1, n2, n3;
-
-    /* keep reading until eof */
-    while ( f.good() ) {
-        /* get line, convert to c string */
-        std::getline(f, line_string);
-        if (line_string.size() == 0) {
-            debugl(3, "empty line..\n");
-            continue;
-        }
-
-        line = new char [ line_string.size() + 1];
-        std::strcpy(line, line_string.c_str() );
-
-        /* parse line with sscanf, if not a comment */
-        if (line[0] == '#') {
-            //printf("comment: ");
-        }
-        /* object declaration */
-        else if (line[0] == 'o') {
-            //printf("comment: ");
-        }
-        /* dummy texture coordinate */
-        else if (line[0] == 'v' && line[1] == 't') {
-        }
-        else if ( sscanf(line, "v %lf %lf %lf", &x, &y, &z) == 3 ) {
-            //printf("vertex.");
-            vertices.push_back( Vec3<R>(x, y, z) );
-        }
-        else if ( sscanf(line, "vn %lf %lf %lf", &x, &y, &z) == 3) {
-            //printf("normal.");
-            normals.push_back( Vec3<R>(x, y, z) );
-        }
-        else if ( sscanf(line, "f %u %u %u", &v0, &v1, &v2) == 3) {
-            //printf("simple triangle.");
-            faces.push_back( obj_face(false, false, v0, v1, v2, 0) );
-        }
-        else if ( sscanf(line, "f %u %u %u %u", &v0, &v1, &v2, &v3) == 4) {
-            //printf("simple quad.");
-            throw("Mesh::readFromObjFile(): QUAD!\n");
-            //faces.push_back( obj_face(true, false, v0, v1, v2, v3) );
-        }
-        else if ( sscanf(line, "f %u//%u %u//%u %u//%u", &v0, &n0, &v1, &n1, &v2, &n2) == 6) {
-            //printf("triangle with normals.");
-            faces.push_back( obj_face(false, true, v0, v1, v2, 0, n0, n1, n2, 0) );
-        }
-        else if ( sscanf(line, "f %u//%u %u//%u %u//%u %u//%u", &v0, &n0, &v1, &n1, &v2, &n2, &v3, &n3) == 8) {
-            //printf("quad with normals.");
-            throw("Mesh::readFromObjFile(): QUAD!\n");
-            //faces.push_back( obj_face(true, true, v0, v1, v2, v3, n0, n1, n2, n3) );
-        }
-        else {
-            printf("Mesh::readFromObjFile(): unrecognized line: \"%s\".\n", line);
-            throw("Mesh::readFromObjFile(): unrecognized line.\n");
-        }
-
-        delete[] line;
-    }
-
     /* try to add all vertices and faces. */
     try {
-        /* NOTE: this relies upon the fact that adding n vertices to an empty mesh will number them 0...(n-1) */
-        debugl(2, "Adding %5d vertices\n", (uint32_t)vertices.size());
-        while (!vertices.empty()) {
-            this->vertices.insert(vertices.front());
-            vertices.pop_front();
+        /* since the mesh is empty, vertices are numbered 0...(n-1) in order, which is what the face indices refer to.
+         * all ids are handed out at once and inserted with hint end() in amortized constant time. */
+        debugl(2, "Adding %5d vertices\n", (uint32_t)data.vertices.size());
+
+        uint32_t        v_first;
+        bool const      v_range = this->V_idq.getIdRange(data.vertices.size(), v_first);
+        for (auto &x : data.vertices) {
+            uint32_t const  new_id  = v_range ? v_first++ : this->V_idq.getId();
+            Vertex         *v       = new Vertex(this, Vec3<R>(x[0], x[1], x[2]));
+
+            v->m_vit = this->V.insert(this->V.end(), { new_id, VertexPointerType(v) });
         }
+        std::vector<std::array<double, 3>>().swap(data.vertices);
+        std::vector<std::array<double, 3>>().swap(data.normals);
         debugl(2, "done adding vertices.\n");
 
-        debugl(2, "adding %5d faces..\n", (uint32_t)faces.size());
-        obj_face *f;
-        while (!faces.empty()) {
-            f = &(faces.front());
-            if (f->quad) {
-                this->faces.insert(
-                        f->v_idx[0],
-                        f->v_idx[1],
-                        f->v_idx[2],
-                        f->v_idx[3]
-                    );
+        debugl(2, "adding %5d faces..\n", (uint32_t)data.faces.size());
+        for (auto &f : data.faces) {
+            if (f[3] != UINT32_MAX) {
+                this->faces.insert(f[0], f[1], f[2], f[3]);
             }
-            /* obj reader only supports quads and triangles, so !f->quad <=> f is triangle */
             else {
-                this->faces.insert(
-                        f->v_idx[0],
-                        f->v_idx[1],
-                        f->v_idx[2]
-                    );
+                this->faces.insert(f[0], f[1], f[2]);
             }
-
-            /* pop_front added face */
-            faces.pop_front();
         }
         debugl(2, "done adding faces.\n");
     }
@@ -4748,20 +4888,82 @@ Mesh<Tm, Tv, Tf, R>::readFromObjFile(const char *filename)
         printf("caught exception: \"%s\".\n", err.error_msg.c_str() );
     }
 
+    this->bvhDropTracking();
+}
+
+template <typename Tm, typename Tv, typename Tf, typename R>
+void
+Mesh<Tm, Tv, Tf, R>::readFromObjFile(
+    const char     *filename,
+    uint32_t        nthreads)
+{
+    debugl(1, "Mesh::readFromObjFile()");
+    debugTabInc();
+
+    /* clear mesh */
+    this->clear();
+
+    /* parse entire file into flat arrays first */
+    Aux::File::ObjData obj;
+    try {
+        if (!Aux::File::readObjFile(filename, obj, nthreads)) {
+            throw MeshEx(MESH_IO_ERROR, "Mesh::readFromObjFile(): can't open input file\n");
+        }
+    }
+    catch (...) {
+        debugTabDec();
+        throw;
+    }
+
+    /* add all vertices and faces */
+    this->buildFromFileData(obj);
+
     debugTabDec();
     debugl(1, "Mesh::readFromObjFile(): done reading mesh from obj: numVertices(): %d, numFaces(): %d, numEdges(): %d\n", this->numVertices(), this->numFaces(), this->numEdges() );
 }
 
 template <typename Tm, typename Tv, typename Tf, typename R>
 void
-Mesh<Tm, Tv, Tf, R>::writeObjFile(const char *jobname)
+Mesh<Tm, Tv, Tf, R>::writeObjFile(
+    const char     *jobname,
+    uint32_t        nthreads,
+    uint32_t        precision)
 {
+    using Aux::File::formatSci;
+    using Aux::File::formatUInt;
+
     debugl(4, "Mesh::writeObjFile(): writing mesh as obj to outfile \"%s\".\n", jobname);
     debugTabInc();
 
     /* renumber vertices */
     this->renumberConsecutively();
 
+    /* collect vertices and face indices in order. all remaining work is read-only and can be distributed among
+     * threads by Aux::File::writeLines(). */
+    std::vector<Vertex *>                   vertices;
+    std::vector<std::array<uint32_t, 4>>    face_ids;
+
+    vertices.reserve(this->V.size());
+    for (auto &v : this->vertices) {
+        vertices.push_back(&v);
+    }
+
+    face_ids.reserve(this->F.size());
+    for (auto &f: this->faces) {
+        std::array<uint32_t, 4> ids;
+        if (f.isQuad()) {
+            f.getQuadIndices(ids[0], ids[1], ids[2], ids[3]);
+        }
+        else if (f.isTri()) {
+            f.getTriIndices(ids[0], ids[1], ids[2]);
+            ids[3] = UINT32_MAX;
+        }
+        else {
+            throw MeshEx(MESH_LOGIC_ERROR, "Mesh::writeObjFile(): discovered face that is neither triangle nor quad. internal logic error.");
+        }
+        face_ids.push_back(ids);
+    }
+
     char obj_filename[512];
     snprintf(obj_filename, 512, "%s.obj", jobname);
     FILE *outfile = fopen(obj_filename, "w");
@@ -4771,6 +4973,9 @@ Mesh<Tm, Tv, Tf, R>::writeObjFile(const char *jobname)
         throw("Mesh::writeObjFile(): can't open output file for writing.");
     }
 
+    /* large stdio buffer for the header lines, the bulk is written in blocks anyway */
+    setvbuf(outfile, NULL, _IOFBF, 1 << 20);
+
     fprintf(outfile, "# obj file automatically generated by AnaMorph for jobname: \"%s\".\n", jobname);
     fprintf(outfile, "o %s\n", jobname);
 
@@ -4778,95 +4983,322 @@ Mesh<Tm, Tv, Tf, R>::writeObjFile(const char *jobname)
     fprintf(outfile, "\n# %15ld vertices.\n", this->V.size());
 
     debugl(4, "writing %15ld vertices..\n", this->vertices.size());
+
+    try {
+        Aux::File::writeLines(outfile, vertices.size(), 96,
+            [&] (size_t i, char *buf) -> size_t
+            {
+                Vec3<R> const  &vpos    = vertices[i]->pos();
+                char           *s       = buf;
+
+                *s++ = 'v';
+                for (uint32_t k = 0; k < 3; k++) {
+                    *s++ = ' ';
+                    s += formatSci(s, vpos[k], precision);
+                }
+                *s++ = '\n';
+
+                return (s - buf);
+            },
+            nthreads);
+
+        /* write a dummy texture coordinate to increase compatability with the somewhat ill-defined
+         * wavefront format. some readers don't accept empty texture coordinates */
+        fprintf(outfile, "\n# dummy texture coordinate to increase compatibility with several programs importing .obj files.\n");
+        fprintf(outfile, "vt 0.0 0.0\n");
+
+        debugl(4, "writing %15ld vertex normals..\n", this->vertices.size());
+
+        // vertex normals, for whatever reason they may be needed
+        Aux::File::writeLines(outfile, vertices.size(), 96,
+            [&] (size_t i, char *buf) -> size_t
+            {
+                Vec3<R>     n;
+                char       *s = buf;
+
+                n.assign((R)0);
+                for (auto f : vertices[i]->getFaceStar()) {
+                    n += f->getNormal();
+                }
+                n.normalize();
+
+                *s++ = 'v';
+                *s++ = 'n';
+                for (uint32_t k = 0; k < 3; k++) {
+                    *s++ = ' ';
+                    s += formatSci(s, n[k], precision);
+                }
+                *s++ = '\n';
+
+                return (s - buf);
+            },
+            nthreads);
+
+        /* newline, comment and then all faces */
+        fprintf(outfile, "\n# %15ld faces.\n", this->F.size() );
+
+        debugl(4, "writing %15ld faces..\n", this->faces.size());
+
+        Aux::File::writeLines(outfile, face_ids.size(), 128,
+            [&] (size_t i, char *buf) -> size_t
+            {
+                std::array<uint32_t, 4> const  &ids     = face_ids[i];
+                uint32_t const                  nids    = (ids[3] == UINT32_MAX) ? 3 : 4;
+                char                           *s       = buf;
+
+                *s++ = 'f';
+                for (uint32_t k = 0; k < nids; k++) {
+                    *s++ = ' ';
+                    s += formatUInt(s, ids[k] + 1);
+                    *s++ = '/';
+                    *s++ = '/';
+                    s += formatUInt(s, ids[k] + 1);
+                }
+                *s++ = '\n';
+
+                return (s - buf);
+            },
+            nthreads);
+    }
+    catch (...) {
+        fclose(outfile);
+        debugTabDec();
+        throw;
+    }
+
+    fclose(outfile);
+
+    debugTabDec();
+    debugl(4, "Mesh::writeObjFile(): done.\n");
+}
+
+template <typename Tm, typename Tv, typename Tf, typename R>
+void
+Mesh<Tm, Tv, Tf, R>::readFromPlyFile(const char *filename)
+{
+    debugl(1, "Mesh::readFromPlyFile()");
     debugTabInc();
 
-    Vec3<R> vpos;
-    for (auto &v : this->vertices) {
-        vpos = v.pos();
-        debugl(5, "writing vertex %5d..\n", v.id());
-        vpos.print_debugl(5);
-        fprintf(outfile, "v %+.10e %+.10e %+.10e\n", vpos[0], vpos[1], vpos[2]);
+    this->clear();
+
+    Aux::File::ObjData ply;
+    try {
+        if (!Aux::File::readPlyFile(filename, ply)) {
+            throw MeshEx(MESH_IO_ERROR, "Mesh::readFromPlyFile(): can't open input file\n");
+        }
+    }
+    catch (...) {
+        debugTabDec();
+        throw;
     }
 
+    this->buildFromFileData(ply);
+
     debugTabDec();
+    debugl(1, "Mesh::readFromPlyFile(): done reading mesh from ply: numVertices(): %d, numFaces(): %d, numEdges(): %d\n", this->numVertices(), this->numFaces(), this->numEdges() );
+}
+
+template <typename Tm, typename Tv, typename Tf, typename R>
+void
+Mesh<Tm, Tv, Tf, R>::readFromStlFile(const char *filename)
+{
+    debugl(1, "Mesh::readFromStlFile()");
+    debugTabInc();
 
-    /* write a dummy texture coordinate to increase compatability with the somewhat ill-defined
-     * wavefront format. some readers don't accept empty texture coordinates */
-    fprintf(outfile, "\n# dummy texture coordinate to increase compatibility with several programs importing .obj files.\n");
-    fprintf(outfile, "vt 0.0 0.0\n");
+    this->clear();
 
-    /* write in all the face normals, preceded by a comment */
-    //fprintf(outfile, "\n# %15ld face normals.\n", this->faces.size());
+    Aux::File::ObjData stl;
+    try {
+        if (!Aux::File::readStlFile(filename, stl)) {
+            throw MeshEx(MESH_IO_ERROR, "Mesh::readFromStlFile(): can't open input file\n");
+        }
+    }
+    catch (...) {
+        debugTabDec();
+        throw;
+    }
 
-    debugl(4, "writing %15ld face normals..\n", this->faces.size());
+    this->buildFromFileData(stl);
+
+    debugTabDec();
+    debugl(1, "Mesh::readFromStlFile(): done reading mesh from stl: numVertices(): %d, numFaces(): %d, numEdges(): %d\n", this->numVertices(), this->numFaces(), this->numEdges() );
+}
+
+template <typename Tm, typename Tv, typename Tf, typename R>
+void
+Mesh<Tm, Tv, Tf, R>::writePlyFile(
+    const char     *jobname,
+    uint32_t        nthreads)
+{
+    debugl(4, "Mesh::writePlyFile(): writing mesh as binary ply to outfile \"%s\".\n", jobname);
     debugTabInc();
 
-    // vertex normals, for whatever reason they may be needed
-    Vec3<R> n;
+    /* renumber vertices, so that mesh ids are ply vertex indices */
+    this->renumberConsecutively();
+
+    std::vector<Vertex *>                   vertices;
+    std::vector<std::array<uint32_t, 4>>    face_ids;
+
+    vertices.reserve(this->V.size());
     for (auto &v : this->vertices) {
-        debugl(5, "writing vertex normal %5d..\n", v.id());
-        const std::list<typename Mesh<Tm, Tv, Tf, R>::Face*>& faceStar = v.getFaceStar();
-        n.assign((R)0);
-        for (auto f : faceStar)
-            n += f->getNormal();
-        n.normalize();
-        fprintf(outfile, "vn %+.10e %+.10e %+.10e\n", n[0], n[1], n[2]);
+        vertices.push_back(&v);
     }
 
-    debugTabDec();
+    face_ids.reserve(this->F.size());
+    for (auto &f: this->faces) {
+        std::array<uint32_t, 4> ids;
+        if (f.isQuad()) {
+            f.getQuadIndices(ids[0], ids[1], ids[2], ids[3]);
+        }
+        else if (f.isTri()) {
+            f.getTriIndices(ids[0], ids[1], ids[2]);
+            ids[3] = UINT32_MAX;
+        }
+        else {
+            throw MeshEx(MESH_LOGIC_ERROR, "Mesh::writePlyFile(): discovered face that is neither triangle nor quad. internal logic error.");
+        }
+        face_ids.push_back(ids);
+    }
+
+    std::string const   ply_filename    = std::string(jobname) + ".ply";
+    FILE               *outfile         = fopen(ply_filename.c_str(), "wb");
+
+    if (!outfile) {
+        debugl(1, "Mesh::writePlyFile(): can't open file \'%s\' for writing.\n", ply_filename.c_str());
+        debugTabDec();
+        throw("Mesh::writePlyFile(): can't open output file for writing.");
+    }
+
+    try {
+        Aux::File::writePlyHeader(outfile, vertices.size(), face_ids.size());
 
-    /* newline, comment and then all faces */
-    fprintf(outfile, "\n# %15ld faces.\n", this->F.size() );
+        /* binary records are fixed-size "lines" for Aux::File::writeLines() */
+        Aux::File::writeLines(outfile, vertices.size(), Aux::File::plyVertexMaxLength,
+            [&] (size_t i, char *buf) -> size_t
+            {
+                Vec3<R> const &vpos = vertices[i]->pos();
+                return Aux::File::formatPlyVertex(buf, vpos[0], vpos[1], vpos[2]);
+            },
+            nthreads);
+
+        Aux::File::writeLines(outfile, face_ids.size(), Aux::File::plyFaceMaxLength,
+            [&] (size_t i, char *buf) -> size_t
+            {
+                return Aux::File::formatPlyFace(buf, face_ids[i]);
+            },
+            nthreads);
+    }
+    catch (...) {
+        fclose(outfile);
+        debugTabDec();
+        throw;
+    }
+
+    fclose(outfile);
+
+    debugTabDec();
+    debugl(4, "Mesh::writePlyFile(): done.\n");
+}
 
-    debugl(4, "writing %15ld faces..\n", this->faces.size());
+template <typename Tm, typename Tv, typename Tf, typename R>
+void
+Mesh<Tm, Tv, Tf, R>::writeStlFile(
+    const char     *jobname,
+    uint32_t        nthreads)
+{
+    debugl(4, "Mesh::writeStlFile(): writing mesh as binary stl to outfile \"%s\".\n", jobname);
     debugTabInc();
 
-    uint32_t v0_id, v1_id, v2_id, v3_id;
+    /* collect triangles as vertex pointer triples, splitting quads */
+    std::vector<std::array<Vertex *, 3>> triangles;
+    triangles.reserve(this->F.size());
     for (auto &f: this->faces) {
+        Vertex *v0, *v1, *v2, *v3;
         if (f.isQuad()) {
-            f.getQuadIndices(v0_id, v1_id, v2_id, v3_id);
-            fprintf(outfile, "f %u//%u %u//%u %u//%u %u//%u\n",
-                    v0_id + 1, 
-                    v0_id + 1, 
-                    v1_id + 1,
-                    v1_id + 1,
-                    v2_id + 1,
-                    v2_id + 1,
-                    v3_id + 1,
-                    v3_id + 1);
-
-            debugl(5, "quad  %u/%u/%u/%u\n",
-                    v0_id, 
-                    v1_id,
-                    v2_id,
-                    v3_id);
+            f.getQuadVertices(v0, v1, v2, v3);
+            triangles.push_back({{ v0, v1, v2 }});
+            triangles.push_back({{ v0, v2, v3 }});
         }
         else if (f.isTri()) {
-            f.getTriIndices(v0_id, v1_id, v2_id);
-            fprintf(outfile, "f %u//%u %u//%u %u//%u\n",
-                    v0_id + 1, 
-                    v0_id + 1, 
-                    v1_id + 1,
-                    v1_id + 1,
-                    v2_id + 1,
-                    v2_id + 1);
-
-            debugl(5, "tri  %u/%u/%u/\n",
-                    v0_id, 
-                    v1_id,
-                    v2_id);
+            f.getTriVertices(v0, v1, v2);
+            triangles.push_back({{ v0, v1, v2 }});
         }
         else {
-            fclose(outfile);
-            throw MeshEx(MESH_LOGIC_ERROR, "Mesh::writeObjFile(): discovered face that is neither triangle nor quad. internal logic error.");
+            throw MeshEx(MESH_LOGIC_ERROR, "Mesh::writeStlFile(): discovered face that is neither triangle nor quad. internal logic error.");
         }
     }
-    debugTabDec();
+
+    std::string const   stl_filename    = std::string(jobname) + ".stl";
+    FILE               *outfile         = fopen(stl_filename.c_str(), "wb");
+
+    if (!outfile) {
+        debugl(1, "Mesh::writeStlFile(): can't open file \'%s\' for writing.\n", stl_filename.c_str());
+        debugTabDec();
+        throw("Mesh::writeStlFile(): can't open output file for writing.");
+    }
+
+    try {
+        Aux::File::writeStlHeader(outfile, triangles.size());
+        Aux::File::writeLines(outfile, triangles.size(), Aux::File::stlTriangleLength,
+            [&] (size_t i, char *buf) -> size_t
+            {
+                std::array<Vertex *, 3> const &t = triangles[i];
+                return Aux::File::formatStlTriangle(buf, t[0]->pos(), t[1]->pos(), t[2]->pos());
+            },
+            nthreads);
+    }
+    catch (...) {
+        fclose(outfile);
+        debugTabDec();
+        throw;
+    }
 
     fclose(outfile);
 
     debugTabDec();
-    debugl(4, "Mesh::writeObjFile(): done.\n");
+    debugl(4, "Mesh::writeStlFile(): done.\n");
+}
+
+template <typename Tm, typename Tv, typename Tf, typename R>
+void
+Mesh<Tm, Tv, Tf, R>::readFromFile(
+    const char     *jobname,
+    MeshFileFormat  format,
+    uint32_t        nthreads)
+{
+    std::string const filename = std::string(jobname) + "." + meshFileExtension(format);
+
+    switch (format) {
+        case MESH_FILE_PLY:
+            this->readFromPlyFile(filename.c_str());
+            break;
+        case MESH_FILE_STL:
+            this->readFromStlFile(filename.c_str());
+            break;
+        default:
+            this->readFromObjFile(filename.c_str(), nthreads);
+            break;
+    }
+}
+
+template <typename Tm, typename Tv, typename Tf, typename R>
+void
+Mesh<Tm, Tv, Tf, R>::writeFile(
+    const char     *jobname,
+    MeshFileFormat  format,
+    uint32_t        nthreads)
+{
+    switch (format) {
+        case MESH_FILE_PLY:
+            this->writePlyFile(jobname, nthreads);
+            break;
+        case MESH_FILE_STL:
+            this->writeStlFile(jobname, nthreads);
+            break;
+        default:
+            this->writeObjFile(jobname, nthreads);
+            break;
+    }
 }
 
 template <typename Tm, typename Tv, typename Tf, typename R>
@@ -4961,9 +5393,10 @@ Mesh<Tm, Tv, Tf, R>::VertexAccessor::insert(const Vec3<R> &vpos)
          * vertex into a consistent state. */
         vit                         = pair.first;
         v->m_vit                    = vit;
+        this->mesh.journalInsertedVertex(v);
 
-        /* mesh octree needs update */
-        this->mesh.octree_updated   = false;
+        /* mesh spatial index needs update */
+        this->mesh.spatial_index_updated = false;
 
         /* return iterator */
         return (vit->second->iterator());
@@ -5001,11 +5434,13 @@ Mesh<Tm, Tv, Tf, R>::VertexAccessor::erase(vertex_iterator it)
     this->mesh.V_idq.freeId(it->id());
 
     debugl(4, "deleting (deallocating) vertex object..\n");
-    /* delete allocated vertex object */
-    delete &(*it);
+    /* delete allocated vertex object, unless it has to be kept alive for Mesh::rollback() */
+    if (!this->mesh.journalRetainVertex(&(*it))) {
+        delete &(*it);
+    }
 
-    /* mesh octree needs update */
-    this->mesh.octree_updated = false;
+    /* mesh spatial index needs update */
+    this->mesh.spatial_index_updated = false;
 
     debugTabDec();
     debugl(3, "Mesh::VertexAccessor::erase(). erase()ing and returning vertex_iterator to next vertex.\n");
@@ -5190,6 +5625,8 @@ Mesh<Tm, Tv, Tf, R>::FaceAccessor::insert(
     /* set Face::m_fit iterator, which is required for Face to be in a consistent state and has not
      * been set by the (private) Face ctor, just as for Mesh::Vertex */
     tri->m_fit  = rpair.first;
+    this->mesh.journalInsertedFace(tri);
+    this->mesh.bvhFaceChanged(tri);
 
     /* vertex ids can be in adjacent_vertices multiple times, for two vertices can be an edge of two
      * incident faces. when getAdjacentIndices/Vertices() is called, the unique() list is computed.
@@ -5209,7 +5646,7 @@ Mesh<Tm, Tv, Tf, R>::FaceAccessor::insert(
     v2->insertAdjacentVertex(v1);
     v2->insertIncidentFace(tri);
 
-    this->mesh.octree_updated = false;
+    this->mesh.spatial_index_updated = false;
 
     /* return iterator to newly inserted tri */
     return (tri->iterator());
@@ -5282,6 +5719,8 @@ Mesh<Tm, Tv, Tf, R>::FaceAccessor::insert(
     /* set Face::m_fit iterator, which is required for Face to be in a consistent state and has not
      * been set by the (private) Face ctor, just as for Mesh::Vertex */
     quad->m_fit = rpair.first;
+    this->mesh.journalInsertedFace(quad);
+    this->mesh.bvhFaceChanged(quad);
 
     /* topology information update */
     v0->insertAdjacentVertex(v3);
@@ -5300,8 +5739,8 @@ Mesh<Tm, Tv, Tf, R>::FaceAccessor::insert(
     v3->insertAdjacentVertex(v0);
     v3->insertIncidentFace(quad);
 
-    /* mesh octree needs update */
-    this->mesh.octree_updated = false;
+    /* mesh spatial index needs update */
+    this->mesh.spatial_index_updated = false;
 
     /* return iterator to newly inserted quad */
     return ( quad->iterator() );
@@ -5344,6 +5783,7 @@ Mesh<Tm, Tv, Tf, R>::FaceAccessor::erase(face_iterator it)
 
     /* get pointer to face */
     Face *f = &(*it);
+    this->mesh.journalFace(f);
 
     /* quads */
     if ( f->isQuad() ) {
@@ -5417,11 +5857,14 @@ Mesh<Tm, Tv, Tf, R>::FaceAccessor::erase(face_iterator it)
     /* free face_id */
     this->mesh.F_idq.freeId( it->id() );
 
-    /* delete allocated face object */
-    delete &(*it);
+    /* delete allocated face object, unless it has to be kept alive for Mesh::rollback() */
+    this->mesh.bvhFaceErased(f);
+    if (!this->mesh.journalRetainFace(f)) {
+        delete f;
+    }
 
-    /* mesh octree needs update */
-    this->mesh.octree_updated = false;
+    /* mesh spatial index needs update */
+    this->mesh.spatial_index_updated = false;
 
     debugTabDec();
 
@@ -569,6 +569,64 @@ namespace NLM {
         throw("NeuritePath::findPermissibleRenderVector(). no permissible render vector found.");
     }
 
+    template<typename R>
+    void
+    NeuritePath<R>::computeMeshFrames(
+        uint32_t                                                n_phi_segments,
+        R                                                       triangle_height_factor,
+        R const                                                &arclen_dt,
+        bool                                                    preserve_crease_edges,
+        NeuritePathMeshFrames<R>                               &frames,
+        R                                                       mu) const
+    {
+        using Aux::Numbers::inf;
+
+        /* check if geometry has been updated */
+        if (!this->geometry_updated) {
+            throw("NeuritePath::computeMeshFrames(): geometry has not been updated. can't compute mesh frames.\n");
+        }
+
+        frames.valid = false;
+        frames.canal_segment_frames.clear();
+
+        /* only the educated guess of findPermissibleRenderVector() is deterministic. if it fails, the render vector must
+         * be found by random search, which has to be done by the caller in the original order of random draws. */
+        Vec3<R> candidate   = Aux::VecMat::zbase<R>();
+        R       r_min       = inf<R>();
+        for (auto &C : this->canal_segments_magnified) {
+            r_min = std::min(r_min, C->checkRenderVector(candidate));
+        }
+
+        if (!(r_min > mu)) {
+            return;
+        }
+        frames.render_vector = candidate;
+
+        /* frames for the initial cylinder of root paths. a missing neurite root edge is reported by
+         * generateInitialSegmentMesh(). */
+        if (this->root_path) {
+            typename NLM_CellNetwork<R>::neurite_const_iterator         v0 = this->neurite_segments[0]->getSourceVertex();
+            std::list<typename NLM_CellNetwork<R>::NeuriteRootEdge *>   v0_nres;
+
+            v0->template getFilteredInEdges<typename NLM_CellNetwork<R>::NeuriteRootEdge>(v0_nres);
+            if (v0_nres.size() == 1) {
+                v0_nres.front()->neurite_root_edge_data.initial_cylinder.computeMeshFrames(
+                        n_phi_segments, triangle_height_factor, candidate, arclen_dt, preserve_crease_edges,
+                        frames.initial_cylinder_frames);
+            }
+        }
+
+        /* frames for all canal segments, skipping the radius-reduced canal segment 0 of non-root paths */
+        frames.canal_segment_frames.resize(this->canal_segments_magnified.size());
+        for (uint32_t i = (this->root_path ? 0 : 1); i < this->canal_segments_magnified.size(); i++) {
+            this->canal_segments_magnified[i]->computeMeshFrames(
+                    n_phi_segments, triangle_height_factor, candidate, arclen_dt, preserve_crease_edges,
+                    frames.canal_segment_frames[i]);
+        }
+
+        frames.valid = true;
+    }
+
     template <typename R>
     template <typename Tm, typename Tv, typename Tf>
     void
@@ -585,7 +643,8 @@ namespace NLM {
             >                                                  &end_circle_its,
         typename Mesh<Tm, Tv, Tf, R>::vertex_iterator          &closing_vertex_it,
         R const                                                &radius_reduction_factor,
-		bool                                                    preserve_crease_edges) const
+		bool                                                    preserve_crease_edges,
+        NeuritePathMeshFrames<R> const                         *frames) const
     {
         debugl(1, "NeuritePath::generateInitialSegmentMesh().\n");
         debugTabInc();
@@ -664,7 +723,8 @@ namespace NLM {
                     &end_circle_offset,
                     &end_circle_its,
                     &closing_vertex_it,
-					preserve_crease_edges);
+					preserve_crease_edges,
+                    (frames && frames->valid) ? &frames->initial_cylinder_frames : NULL);
 
                 /* erase the closing vertex to reopen the mesh */
                 M.vertices.erase(closing_vertex_it);
@@ -690,7 +750,8 @@ namespace NLM {
                     &end_circle_its,
                     /* save iterator to closing vertex */
                     &closing_vertex_it,
-					preserve_crease_edges);
+					preserve_crease_edges,
+                    (frames && frames->valid) ? &frames->canal_segment_frames[0] : NULL);
             }
             else {
                 throw("NeuritePath::generateMesh(): (this) is a neurite root path whose first vertex not incident to "\
@@ -726,7 +787,8 @@ namespace NLM {
         bool& circle_offset_inOut,
         std::vector<typename Mesh<Tm, Tv, Tf, R>::vertex_iterator>& circle_its_inOut,
         typename Mesh<Tm, Tv, Tf, R>::vertex_iterator& circle_closing_vertex_it_inOut,
-        bool preserve_crease_edges
+        bool preserve_crease_edges,
+        NeuritePathMeshFrames<R> const* frames
     ) const
     {
         debugl(2, "generating mesh for neurite canal segment %d\n", segmentIndex);
@@ -748,7 +810,8 @@ namespace NLM {
             &circle_offset_inOut,
             &circle_its_inOut,
             &circle_closing_vertex_it_inOut,
-            preserve_crease_edges
+            preserve_crease_edges,
+            (frames && frames->valid) ? &frames->canal_segment_frames[segmentIndex] : NULL
         );
 
         debugl(2, "done with mesh for neurite canal segment %d\n", segmentIndex);
@@ -776,7 +839,8 @@ namespace NLM {
                 typename Mesh<Tm, Tv, Tf, R>::vertex_iterator
             >                                                  *end_circle_its,
         typename Mesh<Tm, Tv, Tf, R>::vertex_iterator          *closing_vertex_it,
-		bool                                                    preserve_crease_edges) const
+		bool                                                    preserve_crease_edges,
+        NeuritePathMeshFrames<R> const                         *frames) const
     {
         debugl(1, "NeuritePath::appendTailMesh().\n");
         debugTabInc();
@@ -827,7 +891,8 @@ namespace NLM {
                 &segment_i_start_circle_its,
                 /* same scheme to update iterator to closing vertex */
                 &segment_i_start_circle_closing_vertex_it,
-				preserve_crease_edges);
+				preserve_crease_edges,
+                (frames && frames->valid) ? &frames->canal_segment_frames[i] : NULL);
 
             debugl(2, "done with mesh for neurite canal segment %d\n", i);
         }
@@ -893,8 +958,15 @@ NLM_CellNetwork<R>::NLM_CellNetwork(std::string network_name)
 
     this->parametrization_algo                      = this->parametrization_chord_length();
 
+    this->meshing_mesh_format                       = MESH_FILE_OBJ;
     this->meshing_flush                             = true;
     this->meshing_flush_face_limit                  = 100000;
+    this->meshing_flush_mem_limit                   = 0;
+    this->meshing_write_seams                       = false;
+
+    this->meshing_nthreads                          = 1;
+    this->meshing_parallel_trees                    = false;
+    this->meshing_parallel_cells                    = false;
 
     this->meshing_n_soma_refs                       = 3;
     this->meshing_canal_segment_n_phi_segments      = 12;
@@ -928,8 +1000,15 @@ NLM_CellNetwork<R>::getSettings() const
     s.partition_algo                            = this->partition_algo;
     s.parametrization_algo                      = this->parametrization_algo;;
 
+    s.meshing_mesh_format                       = this->meshing_mesh_format;
     s.meshing_flush                             = this->meshing_flush;
     s.meshing_flush_face_limit                  = this->meshing_flush_face_limit;
+    s.meshing_flush_mem_limit                   = this->meshing_flush_mem_limit;
+    s.meshing_write_seams                       = this->meshing_write_seams;
+
+    s.meshing_nthreads                          = this->meshing_nthreads;
+    s.meshing_parallel_trees                    = this->meshing_parallel_trees;
+    s.meshing_parallel_cells                    = this->meshing_parallel_cells;
 
     s.meshing_n_soma_refs                       = this->meshing_n_soma_refs;
     s.meshing_canal_segment_n_phi_segments      = this->meshing_canal_segment_n_phi_segments;
@@ -956,8 +1035,15 @@ NLM_CellNetwork<R>::updateSettings(Settings const &s)
     this->partition_algo                            = s.partition_algo;
     this->parametrization_algo                      = s.parametrization_algo;
 
+    this->meshing_mesh_format                       = s.meshing_mesh_format;
     this->meshing_flush                             = s.meshing_flush;
     this->meshing_flush_face_limit                  = s.meshing_flush_face_limit;
+    this->meshing_flush_mem_limit                   = s.meshing_flush_mem_limit;
+    this->meshing_write_seams                       = s.meshing_write_seams;
+
+    this->meshing_nthreads                          = s.meshing_nthreads;
+    this->meshing_parallel_trees                    = s.meshing_parallel_trees;
+    this->meshing_parallel_cells                    = s.meshing_parallel_cells;
 
     this->meshing_n_soma_refs                       = s.meshing_n_soma_refs;
     this->meshing_canal_segment_n_phi_segments      = s.meshing_canal_segment_n_phi_segments;
@@ -975,8 +1061,13 @@ NLM_CellNetwork<R>::updateSettings(Settings const &s)
         "\t analysis_nthreads:                      %5d\n"\
         "\t analysis_univar_solver_eps:             %5.4e\n"\
         "\t analysis_bivar_solver_eps:              %5.4e\n"\
+        "\t meshing_mesh_format:                    %s\n"\
         "\t meshing_flush:                          %5d\n"\
         "\t meshing_flush_face_limit:               %5d\n"\
+        "\t meshing_flush_mem_limit:                %5d MB\n"\
+        "\t meshing_nthreads:                       %5d\n"\
+        "\t meshing_parallel_trees:                 %s\n"\
+        "\t meshing_parallel_cells:                 %s\n"\
         "\t meshing_n_soma_refs:                    %5d\n"\
         "\t meshing_canal_segment_n_phi_segments:   %5d\n"\
         "\t meshing_outer_loop_maxiter:             %5d\n"\
@@ -987,8 +1078,13 @@ NLM_CellNetwork<R>::updateSettings(Settings const &s)
         this->analysis_nthreads,
         this->analysis_univar_solver_eps,
         this->analysis_bivar_solver_eps,
+        meshFileExtension(this->meshing_mesh_format),
         this->meshing_flush,
         this->meshing_flush_face_limit,
+        this->meshing_flush_mem_limit,
+        this->meshing_nthreads,
+        this->meshing_parallel_trees ? "true" : "false",
+        this->meshing_parallel_cells ? "true" : "false",
         this->meshing_n_soma_refs,
         this->meshing_canal_segment_n_phi_segments,
         this->meshing_cansurf_triangle_height_factor,
@@ -3257,19 +3353,118 @@ NLM_CellNetwork<R>::performFullAnalysis()
  * ----------------------------------------------------------------------------------------------------------------- */
 #include "MeshAlgorithms.hh"
 
+template <typename R>
+std::vector<std::vector<uint32_t>>
+NLM_CellNetwork<R>::getBoundingBoxClusters(std::vector<BoundingBox<R>> const &bbs)
+{
+    uint32_t const  n = bbs.size();
+
+    /* union-find forest over all boxes, find with path halving */
+    std::vector<uint32_t> parent(n);
+    std::iota(parent.begin(), parent.end(), 0);
+
+    auto find = [&parent] (uint32_t i) -> uint32_t
+    {
+        while (parent[i] != i) {
+            parent[i]   = parent[parent[i]];
+            i           = parent[i];
+        }
+        return i;
+    };
+
+    /* sweep along the x axis: with all boxes sorted by their lower x coordinate, every box only has to be tested
+     * against the subsequent boxes starting before it ends in x. */
+    std::vector<uint32_t> order(n);
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(),
+        [&bbs] (uint32_t a, uint32_t b) -> bool { return (bbs[a].min()[0] < bbs[b].min()[0]); });
+
+    for (uint32_t a = 0; a < n; a++) {
+        for (uint32_t b = a + 1; b < n && bbs[order[b]].min()[0] <= bbs[order[a]].max()[0]; b++) {
+            if (bbs[order[a]] && bbs[order[b]]) {
+                uint32_t ra = find(order[a]), rb = find(order[b]);
+                parent[std::max(ra, rb)] = std::min(ra, rb);
+            }
+        }
+    }
+
+    /* assemble clusters, ordered by their smallest box index, each listing its box indices in ascending order */
+    std::vector<std::vector<uint32_t>>  clusters;
+    std::vector<int64_t>                cluster_idx(n, -1);
+    for (uint32_t i = 0; i < n; i++) {
+        uint32_t r = find(i);
+        if (cluster_idx[r] < 0) {
+            cluster_idx[r] = clusters.size();
+            clusters.push_back({});
+        }
+        clusters[cluster_idx[r]].push_back(i);
+    }
+
+    return clusters;
+}
+
 template <typename R>
 template <typename Tm, typename Tv, typename Tf>
 void
-NLM_CellNetwork<R>::renderCellNetwork(std::string filename)
+NLM_CellNetwork<R>::splitComplexEdges(
+    Mesh<Tm, Tv, Tf, R>                    &M_red,
+    Mesh<Tm, Tv, Tf, R>                    &M_blue,
+    RedBlue_Ex_ComplexEdges<R> const       &complex_ex)
 {
-    debugl(1, "NLM_CellNetwork<R>::renderCellNetwork(): \"%s\".\n", filename.c_str());
-    debugTabInc();
+    for (auto e_info : complex_ex.edge_isec_info) {
+        debugl(2, "complex edge: e = (%d, %d)\n", e_info.u_id, e_info.v_id);
 
-    using namespace RedBlue_ExCodes;
+        /* sort and check lambdas */
+        std::vector<R>& lambdas = e_info.edge_lambdas;
+        const uint32_t n = lambdas.size();
 
-    std::list<typename NeuritePathTree::vertex_iterator>    npt_vertices_bfs_ordered;
+        debugl(2, "sorting complex exception edge lambdas. size(): %zu..\n", lambdas.size() );
+        std::sort(lambdas.begin(), lambdas.end(), std::less<R>() );
+        if (lambdas[0] <= 0 || lambdas[n-1] >= 1)
+        {
+            throw("NLM_CellNetwork::splitComplexEdges(): got exceptino about complex edge indicating fractional edge intersection value lambda outside ]0, 1[."\
+                " internal logic error.");
+        }
 
-    Mesh<Tm, Tv, Tf, R>                                     M_cell, M_cell_backup, M_S, M_P;
+        /* compute split points */
+        std::vector<R> e_split_points(n-1);
+
+        debugl(3, "split_points[0] = %5.4f\n", e_split_points[0]);
+        for (uint32_t i = 1; i < n; i++) {
+            e_split_points[i-1] = (lambdas[i] + lambdas[i-1]) / 2.0;
+            debugl(3, "split_points[%d] = %5.4f\n", i, e_split_points[i]);
+        }
+        debugl(3, "split_points[%d] = %5.4f\n", n, e_split_points[n]);
+
+        /* split in red or blue mesh */
+        Mesh<Tm, Tv, Tf, R> &M  = e_info.red ? M_red : M_blue;
+        auto u_it               = M.vertices.find(e_info.u_id);
+        auto v_it               = M.vertices.find(e_info.v_id);
+
+        if (u_it != M.vertices.end() && v_it != M.vertices.end()) {
+            M.splitEdge(u_it, v_it, e_split_points);
+        }
+        else {
+            throw("NLM_CellNetwork::splitComplexEdges(): discovered invalid vertex id contained "\
+                " in complex edge information of RedBlue_Ex_ComplexEdges (id not found). internal"\
+                " logic error.");
+        }
+    }
+}
+
+template <typename R>
+template <typename Tm, typename Tv, typename Tf>
+void
+NLM_CellNetwork<R>::meshNeuritePath(
+    Mesh<Tm, Tv, Tf, R>                    &M,
+    NLM::NeuritePath<R> const              &P,
+    NLM::NeuritePathMeshFrames<R> const    *P_frames,
+    bool                                    seed,
+    uint32_t                                rb_nthreads) const
+{
+    using namespace RedBlue_ExCodes;
+
+    Mesh<Tm, Tv, Tf, R>                                     M_P;
 
     bool                                                    end_circle_offset;
     std::vector<
@@ -3278,15 +3473,476 @@ NLM_CellNetwork<R>::renderCellNetwork(std::string filename)
                                                             circle_its_update_original;
     typename Mesh<Tm, Tv, Tf, R>::vertex_iterator           closing_vertex_it;
 
-    /* initialize the cell mesh to consist of all soma spheres. while iterating over all somas, get breadth-first
-     * ordering of neurite paths for all neurites and append to global list */
-    debugl(1, "initializing soma sphere meshes and computing BFS ordering among neurite paths.\n");
+    /* find permissible render vector for neurite path */
+    Vec3<R> render_vector;
+    render_vector = P_frames ? P_frames->render_vector : P.findPermissibleRenderVector();
+
+    /* variables for angular offset */
+    R           phi_0;
+
+    /* merge neurite path initial mesh segment with RedBlueUnion, catch exceptions, re-randomize / decrease radius
+     * factor / handle errors as required */
+    uint32_t    outer_loop_iter             = 0;
+    uint32_t    inner_loop_iter             = 0;
+    bool        done                        = false;
+    bool        restore_M                   = false;
+    bool        new_outer_iteration         = false;
+    bool        break_inner_meshing_loop    = true;
+
+    R           complex_edge_growth_factor  = 0.0;
+    uint32_t    complex_edge_initial_count  = 0;
+
+    // compute a good initial guess for the radius reduction factor of the initial segment:
+    // to that end, compute the radius of the in-circle of the cross-section polygon of the
+    // parent section
+    R radius_factor = cos(M_PI / meshing_canal_segment_n_phi_segments);
+
+    /* compute a radius factor the corresponds to a generous lower bound on a safe radius, which can be obtained
+     * by analysing the local neighbourhood of P's start vertex. */
+    NeuriteVertex const &P_vstart       = *(P.neurite_segments[0]->getSourceVertex());
+    R           P_vstart_radius         = P_vstart.getRadius();
+    auto        P_vstart_vertex_nbs     = P_vstart.template getFilteredNeighbours<NeuriteVertex>();
+    R           radius_factor_safe_lb   = 0.5;
+
+    for (auto &x : P_vstart_vertex_nbs) {
+        radius_factor_safe_lb = std::min(radius_factor_safe_lb, x->getRadius() / (2.0 * P_vstart_radius));
+    }
+    debugl(1, "radius_factor_safe_lb = %5.4f\n", radius_factor_safe_lb);
+
+    uint32_t segment_index = 1;
+
+    /* seed: P's initial segment becomes the first part of the (empty) mesh M, nothing to merge. */
+    if (seed) {
+        debugl(1, "seeding mesh with initial segment of root path.\n");
+
+        phi_0 = Aux::Numbers::frand(0.0, (2*(R)M_PI) / (R)this->meshing_canal_segment_n_phi_segments);
+        P.template generateInitialSegmentMesh<Tm, Tv, Tf>(
+            M,
+            this->meshing_canal_segment_n_phi_segments,
+            meshing_cansurf_triangle_height_factor,
+            render_vector,
+            phi_0,
+            1E-3,
+            end_circle_offset,
+            end_circle_its,
+            closing_vertex_it,
+            radius_factor,
+            this->meshing_preserve_crease_edges,
+            P_frames);
+
+        done = true;
+    }
+    /* otherwise set checkpoint on M. all modifications of M performed by the merging attempts below are journaled
+     * and can be undone with M.rollback(). */
+    else {
+        M.checkpoint();
+    }
+
+    /*
+    tmp = M;
+    tmp.writeObjFile("M_cell_before_merge");
+    */
+
+    debugl(1, "entering outer meshing loop.\n");
+    debugTabInc();
+    while (!done) {
+        /* if necessary, roll back M to the checkpoint set before the first RedBlueUnion call. this is the case
+         * iff the exception that lead to the necessity of another run indicated R_intact == false (M has been
+         * used as the red mesh).
+         *
+         * NOTE: the mesh flush info struct of the caller contains _pointers_ to boundary vertices of M. rollback()
+         * re-attaches the very same Vertex objects that existed at the checkpoint under their original ids, so these
+         * pointers remain valid and need not be updated. */
+        if (restore_M) {
+            debugl(1, "rolling back M to checkpoint.\n");
+            M.rollback();
+            debugl(1, "M restored.\n");
+        }
+
+        new_outer_iteration         = false;
+        restore_M                   = false;
+        outer_loop_iter++;
+
+        if (outer_loop_iter % this->meshing_outer_loop_maxiter == 0) {
+            radius_factor = std::max(radius_factor_safe_lb, radius_factor - this->meshing_radius_factor_decrement);
+        }
+
+        debugl(1, "outer meshing loop: iteration %d. radius factor: %5.4f\n", outer_loop_iter, radius_factor);
+        debugl(1, "choosing random phi_0 and generating initial mesh segment..\n");
+
+        /* compute random angular offset phi_0 */
+        phi_0 = Aux::Numbers::frand(0.0, (2*(R)M_PI) / (R)this->meshing_canal_segment_n_phi_segments);
+
+        /* clear path mesh */
+        M_P.clear();
+
+        /* generate P's initial segment mesh and append to M */
+        try
+        {
+            P.template generateInitialSegmentMesh<Tm, Tv, Tf>(
+                /* append to mesh M_P for path P*/
+                M_P,
+                /* n_phi_segments default to 16 for testing */
+                this->meshing_canal_segment_n_phi_segments,
+                meshing_cansurf_triangle_height_factor,
+                /* render vector */
+                render_vector,
+                /* phi_0, arclen_dt = 1E-3 */
+                phi_0,
+                1E-3,
+                /* end circle info */
+                end_circle_offset,
+                end_circle_its,
+                closing_vertex_it,
+                /* radius factor, which is being ignored for neurite root paths. */
+                radius_factor,
+                this->meshing_preserve_crease_edges,
+                P_frames);
+        }
+        catch (...) {debugTabDec(); throw;}
+
+        // add more segments if joining has failed before due to intersection of the end circle
+        for (uint32_t i = 1; i < segment_index; ++i)
+        {
+            try
+            {
+                P.template appendTailSegment<Tm, Tv, Tf>
+                (
+                    M_P,
+                    i,
+                    this->meshing_canal_segment_n_phi_segments,
+                    meshing_cansurf_triangle_height_factor,
+                    render_vector,
+                    phi_0,
+                    1e-3,
+                    end_circle_offset,
+                    end_circle_its,
+                    closing_vertex_it,
+                    this->meshing_preserve_crease_edges,
+                    P_frames
+                );
+            }
+            catch (...) {debugTabDec(); throw;}
+        }
+
+        /* triangulate M_P for RedBlueAlgorithm */
+        M_P.triangulateQuads();
+
+        /*
+        tmp = M_P;
+        tmp.writeObjFile("M_P_before_merge");
+        */
+
+        /* merge initial path mesh segment into M with RedBlueUnion. to append the tail of the path mesh, it
+         * is required to know the end circle and closing vertex iterators AFTER merging, so these are assembled
+         * into the update iterator vector circle_its_update for the RedBlueUnion call. */
+        circle_its_update_original = end_circle_its;
+        circle_its_update_original.push_back(closing_vertex_it);
+
+        /* inner meshing loop: while the initial mesh segment generated above might still be usable (e.g. by
+         * splitting complex edges), try to use it. as soon as exception handling sets new_outer_iteration or
+         * break_inner_meshing_loop is set to false at the end of the try {..} block, the inner loop breaks.
+         * directly after the body of the inner meshing loop, it is checked whether new_outer_iteration == true. */
+        break_inner_meshing_loop    = false;
+        inner_loop_iter             = 0;
+        complex_edge_growth_factor  = 0.0;
+        complex_edge_initial_count  = 0;
+
+        debugl(1, "entering inner meshing loop..\n");
+        debugTabInc();
+        while (!new_outer_iteration && !break_inner_meshing_loop && inner_loop_iter < this->meshing_inner_loop_maxiter) {
+            /* copy circle_its_update_original into circle_its_update for current meshing run */
+            circle_its_update = circle_its_update_original;
+            inner_loop_iter++;
+
+            debugl(2, "calling RedBlueUnion algorithm to merge initial mesh segment into partially completed mesh.\n");
+
+            Aux::Timing::tick(14);
+
+            try {
+                MeshAlg::RedBlueUnion<Tm, Tv, Tf, R>(
+                    /* R = M, which is to be union mesh afterwards */
+                    M,
+                    /* B = M_P, the mesh for the initial segment of P */
+                    M_P,
+                    /* list of end circle iterators from M_P which are updated to reflect the corresponding vertices in
+                     * the union mesh */
+                   &circle_its_update,
+                    rb_nthreads);
+
+                /* RedBlueUnion call has been succcessful. break inner meshing loop */
+                break_inner_meshing_loop = true;
+            }
+            catch (RedBlue_Ex_InternalLogic& logic_ex) {
+                debugTabDec(); debugTabDec();
+                throw;
+            }
+            catch (RedBlue_Ex_Disjoint& disjoint_ex) {
+                debugTabDec(); debugTabDec();
+                throw;
+            }
+            catch (RedBlue_Ex_ComplexEdges<R>& complex_ex) {
+                debugl(0, "NLM_CellNetwork::meshNeuritePath(): RedBlueAlgorithm returned exception: %d complexly intersecting edges.. splitting.\n", complex_ex.edge_isec_info.size());
+                debugTabInc();
+
+                uint32_t const nce = complex_ex.edge_isec_info.size();
+
+                /* if this is the first complex edge exception, set initial complex edge count */
+                if (complex_edge_growth_factor == 0.0) {
+                    complex_edge_initial_count  = nce;
+                    complex_edge_growth_factor  = 1.0;
+                    debugl(1, "setting complex edge initial count to %d, factor to %5.4f\n", nce, complex_edge_growth_factor);
+                }
+                /* otherwise calculate "growth factor". in certain situations, splitting all complex edges creates
+                 * even more complex edges. this process can amplify itself exponentially. to prevent this, check
+                 * if the growth factor exceeds a certain limit */
+                else {
+                    complex_edge_growth_factor  = (R)nce / (R)complex_edge_initial_count;
+                    debugl(1, "setting complex edge growth factor to %5.4f\n", complex_edge_growth_factor);
+                }
+
+                /* if complex edge growth factor is too large, start new outer meshing iteration */
+                if (complex_edge_growth_factor > this->meshing_complex_edge_max_growth_factor) {
+                    debugl(0, "Complex edge growth factor too large.\n");
+                    radius_factor   = std::max(radius_factor_safe_lb, radius_factor - this->meshing_radius_factor_decrement);
+                    new_outer_iteration = true;
+                    restore_M           = true;
+                }
+                /* split in red mesh, i.e. M, and blue mesh, i.e. M_P */
+                else {
+                    try {splitComplexEdges(M, M_P, complex_ex);}
+                    catch (...) {debugTabDec(); debugTabDec(); debugTabDec(); throw;}
+                }
+                debugTabDec();
+
+                /* all splits performed. at this point, new_outer_iteration == false, break_inner_meshing_loop == false =>
+                 * another iteration of the inner meshing loop is performed, which issues another RedBlueUnion call
+                 * on the same initial mesh segment after splitting complex edges. */
+                /*
+                Mesh<Tm, Tv, Tf, R> tmp = M;
+                std::ostringstream oss1;
+                oss1 << "M_cell_split_" << outer_loop_iter << "_" << inner_loop_iter;
+                tmp.writeObjFile(oss1.str().c_str());
+
+                tmp = M_P;
+                std::ostringstream oss2;
+                oss2 << "M_P_split_" << outer_loop_iter << "_" << inner_loop_iter;
+                tmp.writeObjFile(oss2.str().c_str());
+                */
+            }
+            catch (RedBlue_Ex_NumericalEdgeCase& numerical_ex) {
+                debugl(0, "NLM_CellNetwork::meshNeuritePath(): RedBlueAlgorithm returned exception: numerical edge case => retry..\n");
+                new_outer_iteration = true;
+                restore_M           = !numerical_ex.R_intact;
+            }
+            catch (RedBlue_Ex_Triangulation<R>& tri_ex) {
+                debugl(0, "NLM_CellNetwork::meshNeuritePath(): RedBlueAlgorithm returned exception: error during triangulation of outside / inside polygons. => retry..\n");
+
+                /* decrease radius factor, but lower bound by radius_factor_safe_lb. */
+                radius_factor       = std::max(radius_factor_safe_lb, radius_factor - this->meshing_radius_factor_decrement);
+                new_outer_iteration = true;
+                restore_M           = !tri_ex.R_intact;
+            }
+            catch (RedBlue_Ex_NumIsecPoly& isecpoly_ex) {
+                debugl(0, "NLM_CellNetwork::meshNeuritePath(): RedBlueAlgorithm returned exception: number of intersection polygons != 1.\n");
+                radius_factor       = std::max(radius_factor_safe_lb, radius_factor - this->meshing_radius_factor_decrement);
+                new_outer_iteration = true;
+                restore_M           = !isecpoly_ex.R_intact;
+            }
+            catch (RedBlue_Ex_AffectedCircleTrivial<R>& trivcircle_ex){
+                debugl(0, "NLM_CellNetwork::meshNeuritePath(): RedBlueAlgorithm returned exception: affected circle trivial.\n");
+
+                // split the single triangle with a center vertex at the pre-computed position
+                if (trivcircle_ex.red)
+                    M.split_face_with_center(trivcircle_ex.face_id, trivcircle_ex.splitPos);
+                else
+                    M_P.split_face_with_center(trivcircle_ex.face_id, trivcircle_ex.splitPos);
+            }
+            debugl(1, "inner meshing loop time: %5.4f\n\n", Aux::Timing::tack(14));
+        }
+        debugTabDec();
+        debugl(1, "inner meshing loop left..\n");
+
+        /* if maximum number of inner meshing loop iterations has been reached, restart outer meshing loop. */
+        if (inner_loop_iter == this->meshing_inner_loop_maxiter) {
+            debugl(0, "inner meshing loop broken because maximum number of iterations has been reached => restart outer meshing loop.\n");
+            radius_factor   = std::max(radius_factor_safe_lb, radius_factor - this->meshing_radius_factor_decrement);
+            new_outer_iteration = true;
+            restore_M           = true;
+        }
+
+        // check that the complete end circle of P is not merged with M
+        // this is not allowed, as we need it to connect the rest of the neurite
+        for (auto &it : circle_its_update)
+        {
+            if (it.explicitlyInvalid())
+            {
+                debugl(0, "Neurite end circle intersects cell grid to connect to.\n"
+                          "Adding another segment to initial neurite stump and trying to connect again.\n");
+
+                // if P has no more segments left to append, then this is an error
+                if (P.numEdges() <= segment_index)
+                {
+                    debugTabDec();
+                    throw("NLM_CellNetwork::meshNeuritePath(): RedBlueUnion algorithm has explicitly invalidated an "\
+                      "end circle iterator or the closing vertex iterator of the current path P's initial mesh "
+                      "segment. This means the tip of the initial segment intersects with the rest of the geometry."
+                      " This degenerate case cannot be dealt with at the moment. In a clean network, this should be "
+                      "impossible. numerical edge case due to tight PMDV / SMDV constants?");
+                }
+
+                // otherwise send R-B in another outer iteration
+                // and tell it to append one further segment to P
+                ++segment_index;
+                new_outer_iteration = true;
+                restore_M           = true;
+                break;
+            }
+        }
+
+        /* start fresh iteration of outer meshing loop if required */
+        if (new_outer_iteration) {
+            debugl(1, "re-iteration of outer meshing loop necessary..\n");
+            /* if radius_factor has reached radius_factor_safe_lb, throw exception, since a definitely safe radius
+             * should already have been reached. */
+            if (radius_factor == radius_factor_safe_lb) {
+
+                Mesh<Tm, Tv, Tf, R> tmp = M;
+                std::ostringstream oss1;
+                oss1 << "M_cell_split_" << outer_loop_iter << "_" << inner_loop_iter;
+                tmp.writeObjFile(oss1.str().c_str());
+
+                tmp = M_P;
+                std::ostringstream oss2;
+                oss2 << "M_P_split_" << outer_loop_iter << "_" << inner_loop_iter;
+                tmp.writeObjFile(oss2.str().c_str());
+
+                debugTabDec();
+                throw("NLM_CellNetwork::meshNeuritePath(): Reached safe lower bound radius factor for current "
+                    "neurite path. This must not happen for clean cell networks and indicates that the initial "
+                    "segment of the neurite currently being connected, apart from the connection point, has a "
+                    "second intersection with the rest of the geometry.");
+            }
+            /* otherwise start another meshing run */
+            else {
+                continue;
+            }
+        }
+
+        // security check
+        for (auto &it : circle_its_update) {
+            if (!it.checkContainer(M)) {
+                debugl(1, "it.container: %p, M (ptr): %p, M_P (ptr): %p.\n", it.getContainer(), &M, &M_P);
+                debugTabDec();
+                throw("NLM_CellNetwork::meshNeuritePath(): RedBlueUnion algorithm has returned an "\
+                    "updated end circle iterator that does not refer to the partially completed mesh. "\
+                    "internal logic error.");
+            }
+        }
+
+        debugl(2, "initial mesh segment successfully merged.\n");
+
+        /* no more rollbacks for P: accept all changes to M and stop journaling */
+        M.releaseCheckpoint();
+
+        /* unpack updated iterators referring to M. */
+        closing_vertex_it   = circle_its_update.back();
+        circle_its_update.pop_back();
+        end_circle_its      = circle_its_update;
+
+        /* initial segment of P done */
+        done = true;
+    }
+    debugTabDec();
+
+    debugl(2, "appending path tail mesh..\n");
+
+    /* append P's tail mesh (for neurite canal segments 1, .., m) to M */
+    P.template appendTailMesh<Tm, Tv, Tf>(
+        M,
+        segment_index,
+        this->meshing_canal_segment_n_phi_segments,
+        meshing_cansurf_triangle_height_factor,
+        render_vector,
+        phi_0,
+        1E-3,
+        /* end circle information from RedBlue merged initial segment as start circle information for tail */
+        end_circle_offset,
+        end_circle_its,
+        closing_vertex_it,
+        /* store return iterators for subsequent generation of terminal half-sphere */
+       &end_circle_offset,
+       &end_circle_its,
+       &closing_vertex_it,
+        this->meshing_preserve_crease_edges,
+        P_frames);
+
+    debugl(2, "tail path mesh appended. appending terminal half-sphere.\n");
+
+    /* append a terminal "half-sphere" at the end neurite point of P */
+    BLRCanalSurface<3u, R> &C_end   = *(P.canal_segments_magnified.back());
+    Vec3<R> start               = C_end.spineCurveEval(1.0);
+    Vec3<R> direction           = C_end.spineCurveEval_d(1.0);
+    R       radius              = C_end.radiusEval(1.0);
+
+    MeshAlg::appendHalfSphereToCanalSurfaceMesh<Tm, Tv, Tf, R>(
+            M,
+            render_vector,
+            start,
+            radius,
+            direction,
+            this->meshing_canal_segment_n_phi_segments,
+            phi_0,
+            end_circle_its,
+            closing_vertex_it);
+
+    debugl(2, "half-sphere appended. triangulating quads..\n");
+
+    /* triangulate quads in M */
+    M.triangulateQuads();
+}
+
+template <typename R>
+template <typename Tm, typename Tv, typename Tf>
+void
+NLM_CellNetwork<R>::renderCellNetwork(std::string filename)
+{
+    debugl(1, "NLM_CellNetwork<R>::renderCellNetwork(): \"%s\".\n", filename.c_str());
+    debugTabInc();
+
+    using namespace RedBlue_ExCodes;
+
+    typedef std::list<typename NeuritePathTree::vertex_iterator>    NPTVertexList;
+
+    NPTVertexList                                           npt_vertices_bfs_ordered;
+
+    Mesh<Tm, Tv, Tf, R>                                     M_cell, M_S;
+
+    /* neurite path trees as contiguous ranges of npt_vertices_bfs_ordered. a tree can be meshed on its own iff it
+     * has a single source vertex, i.e. its root path is the only path connecting it to the soma. */
+    struct NeuriteMeshingTree {
+        typename NPTVertexList::iterator    first;
+        uint32_t                            npaths;
+        bool                                standalone;
+    };
+    std::vector<NeuriteMeshingTree>                         npt_ranges;
+
+    /* cells, i.e. somas with all their neurite paths, as contiguous ranges of npt_vertices_bfs_ordered, along with a
+     * generously extended bounding box of the entire cell geometry. */
+    struct CellMeshingInfo {
+        NLM::SomaInfo<R> const             *s_info;
+        typename NPTVertexList::iterator    first;
+        uint32_t                            npaths;
+        BoundingBox<R>                      bb;
+    };
+    std::vector<CellMeshingInfo>                            cells;
+
+    /* for all somas, get breadth-first ordering of neurite paths for all neurites and append to global list */
+    debugl(1, "computing BFS ordering among neurite paths.\n");
     for (auto &s : this->soma_vertices) {
         NLM::SomaInfo<R> &s_info  = s.soma_data;
 
-        s_info.soma_sphere.template generateMesh<Tm, Tv, Tf>(M_S, meshing_n_soma_refs);
-
-        M_cell.moveAppend(M_S);
+        size_t const s_offset = npt_vertices_bfs_ordered.size();
 
         /* iterate over all neurite path trees, i.e. all neurites, of the soma. */
         for (NeuritePathTree &npt : s_info.neurite_path_trees) {
@@ -3297,10 +3953,12 @@ NLM_CellNetwork<R>::renderCellNetwork(std::string filename)
                 }
             }
 
+            size_t const npt_offset = npt_vertices_bfs_ordered.size();
+
             for (auto &sv : source_vertices) {
                 /* get connected component of source vertex in breadth-first order and append corresponding
                  * NeuritePath pointers to neurite path list. */
-                std::list<typename NeuritePathTree::Vertex *> sv_cc;  
+                std::list<typename NeuritePathTree::Vertex *> sv_cc;
 
                 uint32_t tid = npt.getFreshTraversalId();
 
@@ -3314,72 +3972,114 @@ NLM_CellNetwork<R>::renderCellNetwork(std::string filename)
                     npt_vertices_bfs_ordered.push_back(u->iterator());
                 }
             }
+
+            if (npt_vertices_bfs_ordered.size() > npt_offset) {
+                npt_ranges.push_back({
+                        std::next(npt_vertices_bfs_ordered.begin(), npt_offset),
+                        (uint32_t)(npt_vertices_bfs_ordered.size() - npt_offset),
+                        source_vertices.size() == 1 });
+            }
+        }
+
+        Vec3<R> const   &c  = s_info.soma_sphere.centre();
+        R const          r  = s_info.soma_sphere.radius();
+        CellMeshingInfo  s_cell = {
+            &s_info,
+            std::next(npt_vertices_bfs_ordered.begin(), s_offset),
+            (uint32_t)(npt_vertices_bfs_ordered.size() - s_offset),
+            BoundingBox<R>(c - Vec3<R>(r, r, r), c + Vec3<R>(r, r, r))
+        };
+        for (auto npt_vit = s_cell.first; npt_vit != npt_vertices_bfs_ordered.end(); ++npt_vit) {
+            for (auto &Gamma : (*npt_vit)->vertex_data.canal_segments_magnified) {
+                s_cell.bb.update(Gamma->getBoundingBox());
+            }
         }
+        s_cell.bb.extend(0.1, Vec3<R>(1E-2, 1E-2, 1E-2));
+        cells.push_back(s_cell);
     }
 
+    /* cell-parallel mode: group cells into clusters of transitively intersecting bounding boxes. different clusters
+     * can't interact during merging, so they are meshed independently. */
+    std::vector<std::vector<uint32_t>>                      cell_clusters;
+    if (this->meshing_parallel_cells) {
+        std::vector<BoundingBox<R>> cell_bbs;
+        for (auto &s_cell : cells) {
+            cell_bbs.push_back(s_cell.bb);
+        }
+        cell_clusters = NLM_CellNetwork<R>::getBoundingBoxClusters(cell_bbs);
+    }
+    bool const  cells_parallel = (cell_clusters.size() > 1);
+
+    /* cell-parallel mode takes precedence: the clusters are meshed path by path, not tree by tree. */
+    if (cells_parallel && this->meshing_parallel_trees) {
+        printf("\t WARNING: %zu independent cell clusters found. cell-parallel meshing takes precedence over "\
+               "-meshing-parallel-trees, which is ignored.\n", cell_clusters.size());
+    }
+
+    /* otherwise, initialize the cell mesh to consist of all soma spheres. */
+    if (!cells_parallel) {
+        debugl(1, "initializing soma sphere meshes.\n");
+        for (auto &s_cell : cells) {
+            s_cell.s_info->soma_sphere.template generateMesh<Tm, Tv, Tf>(M_S, meshing_n_soma_refs);
+            M_cell.moveAppend(M_S);
+        }
+    }
+
+    /* M_cell is only queried by the main thread, so its spatial index may be rebuilt on meshing_nthreads threads.
+     * meshes built on the worker threads below keep the default of one thread to avoid oversubscription. */
+    M_cell.setSpatialIndexThreads(this->meshing_nthreads);
+
     /* initialize flush info */
-    MeshAlg::MeshObjFlushInfo<Tm, Tv, Tf, R>    M_cell_flushinfo(filename);
-    std::list<uint32_t>                         M_cell_flush_last_boundary_vertices_ids_backup;                          
+    MeshAlg::MeshFlushInfo<Tm, Tv, Tf, R>       M_cell_flushinfo(filename, this->meshing_mesh_format);
+    M_cell_flushinfo.nthreads = this->meshing_nthreads;
+    M_cell_flushinfo.write_seams = this->meshing_write_seams;
+
+    /* format and write flushed mesh parts on a background thread, while meshing continues */
+    M_cell_flushinfo.startWriter();
+
+    /* if mesh has more than meshing_flush_face_limit faces, flush all vertices and faces to disk which
+     * definitely don't participate in any merging operation that remains to be done. the set of respective
+     * faces is computed as follows: for every remaining neurite path, starting from npt_vit, and all neurite canal
+     * segments of this path, get the bounding box, extend it generously and locate all faces of M_cell that properly
+     * intersect that bounding box. compute the union of all such sets of faces (over all neurite canal segments yet
+     * to be meshed) and invert the set of resulting faces.
+     *
+     * all faces in the obtained set (list) will never be affected during a merging operation and can safely be
+     * flushed to disk. */
+    /* flushing is triggered by the face count of M_cell or, if meshing_flush_mem_limit is set, by the estimated heap
+     * footprint in MB of M_cell (see Mesh::memoryFootprint()) plus the flushed batches still queued for the
+     * background writer. if the limit is exceeded while batches are queued, the writer is drained first and M_cell
+     * is only flushed if it exceeds the limit on its own. */
+    auto flushDue = [&] () -> bool
+    {
+        if (!this->meshing_flush) {
+            return false;
+        }
+        else if (this->meshing_flush_mem_limit > 0) {
+            size_t const limit  = (size_t)this->meshing_flush_mem_limit << 20;
+            size_t const bytes  = M_cell.memoryFootprint();
 
-    /* in the computed bread-first ordering, inductively append neurite path meshes */
-    debugl(1, "processing neurite paths in BFS order.\n");
-    debugTabInc();
-    uint32_t np_idx = 1;
-    for (auto npt_vit = npt_vertices_bfs_ordered.begin(); npt_vit != npt_vertices_bfs_ordered.end(); ++npt_vit) {
-        debugl(2, "processing neurite path %d\n", (*npt_vit)->id());
-        printf("\t meshing neurite path %5u of %5zu.\n", np_idx, npt_vertices_bfs_ordered.size() );
-
-        /* get reference to neurite path */
-        NLM::NeuritePath<R> const &P    = (*npt_vit)->vertex_data;
-
-        /* find permissible render vector for neurite path */
-        Vec3<R> render_vector;
-        render_vector = P.findPermissibleRenderVector();
-
-        /* variables for angular offset */
-        R           phi_0;
-
-        /* merge neurite path initial mesh segment with RedBlueUnion, catch exceptions, re-randomize / decrease radius
-         * factor / handle errors as required */
-        uint32_t    outer_loop_iter             = 0;
-        uint32_t    inner_loop_iter             = 0;
-        bool        done                        = false;
-        bool        restore_M_cell              = false;
-        bool        new_outer_iteration         = false;
-        bool        break_inner_meshing_loop    = true;
-
-        R           complex_edge_growth_factor  = 0.0;
-        uint32_t    complex_edge_initial_count  = 0;
-
-        // compute a good initial guess for the radius reduction factor of the initial segment:
-        // to that end, compute the radius of the in-circle of the cross-section polygon of the
-        // parent section
-        R radius_factor = cos(M_PI / meshing_canal_segment_n_phi_segments);
-
-        /* compute a radius factor the corresponds to a generous lower bound on a safe radius, which can be obtained
-         * by analysing the local neighbourhood of P's start vertex. */
-        NeuriteVertex const &P_vstart       = *(P.neurite_segments[0]->getSourceVertex());
-        R           P_vstart_radius         = P_vstart.getRadius();
-        auto        P_vstart_vertex_nbs     = P_vstart.template getFilteredNeighbours<NeuriteVertex>();
-        R           radius_factor_safe_lb   = 0.5;
-
-        for (auto &x : P_vstart_vertex_nbs) {
-            radius_factor_safe_lb = std::min(radius_factor_safe_lb, x->getRadius() / (2.0 * P_vstart_radius));
+            if (bytes + M_cell_flushinfo.pendingBytes() > limit) {
+                M_cell_flushinfo.waitForWriter();
+            }
+            if (bytes > limit) {
+                printf("\t Partial cell mesh occupies %7.1f MB > %5d MB (flush memory limit). ",
+                        bytes / 1048576.0, this->meshing_flush_mem_limit);
+                return true;
+            }
         }
-        debugl(1, "radius_factor_safe_lb = %5.4f\n", radius_factor_safe_lb);
-
-        /* if mesh has more than meshing_flush_face_limit faces, flush all vertices and faces to disk which
-         * definitely don't participate in any merging operation that remains to be done. the set of respective
-         * faces is computed as follows: for every remaining neurite path and all neurite canal segments of this
-         * path, get the bounding box, extend it generously and locate all faces of M_cell that properly intersect
-         * that bounding box. compute the union of all such sets of faces (over all neurite canal segments yet to be
-         * meshed) and invert the set of resulting faces.
-         *
-         * all faces in the obtained set (list) will never be affected during a merging operation and can safely be
-         * flushed to disk. */
-        if (this->meshing_flush && M_cell.numFaces() > this->meshing_flush_face_limit) {
-            printf("\t Partial cell mesh has %5d > %5d (flush face limit)) faces. Flushing definitely no longer needed parts off to disk.. ",
+        else if (M_cell.numFaces() > this->meshing_flush_face_limit) {
+            printf("\t Partial cell mesh has %5d > %5d (flush face limit)) faces. ",
                     M_cell.numFaces(), this->meshing_flush_face_limit);
+            return true;
+        }
+        return false;
+    };
+
+    auto flushM_cell = [&] (typename NPTVertexList::iterator npt_vit) -> void
+    {
+        if (flushDue()) {
+            printf("Flushing definitely no longer needed parts off to disk.. ");
             fflush(stdout);
 
             std::list<typename Mesh<Tm, Tv, Tf, R>::Face *>  flush_faces, tmp;
@@ -3402,478 +4102,499 @@ NLM_CellNetwork<R>::renderCellNetwork(std::string filename)
             M_cell.invertFaceSelection(flush_faces);
 
             /* .. and perform the flush */
-            try {MeshAlg::partialFlushToObjFile(M_cell, M_cell_flushinfo, flush_faces);}
-            catch (...) {debugTabDec(); debugTabDec(); throw;}
+            MeshAlg::partialFlushToFile(M_cell, M_cell_flushinfo, flush_faces);
 
             printf("done.\n");
         }
+    };
 
-        /* backup (potentially just partially flushed) cell mesh */
-        M_cell_backup                   = M_cell;
+    /* stops and joins worker threads when leaving this scope, in particular if an exception is thrown */
+    struct WorkerJoiner {
+        std::atomic<bool>          &abort;
+        std::vector<std::thread>   &workers;
 
-        /* backup ids of all boundary_vertices (referring to M_cell) from M_cell_flushinfo */
-        M_cell_flush_last_boundary_vertices_ids_backup.clear();
-        for (auto &vp : M_cell_flushinfo.last_boundary_vertices) {
-            M_cell_flush_last_boundary_vertices_ids_backup.push_back(vp.first->id());
+        ~WorkerJoiner()
+        {
+            abort = true;
+            for (auto &t : workers) {
+                if (t.joinable()) {
+                    t.join();
+                }
+            }
         }
+    };
+
+    /* cell-parallel mode: meshing_nthreads worker threads mesh the cell clusters independently, each into its own
+     * mesh consisting of the cluster's soma spheres, into which all neurite paths of the cluster are merged in BFS
+     * order as in sequential mode. the main thread concatenates the finished cluster meshes to M_cell in order. since
+     * no remaining cluster can interact with M_cell, M_cell can be flushed entirely whenever it exceeds the flush face
+     * limit. every cluster draws its random numbers from a separate stream seeded with its index, so the generated
+     * mesh is reproducible and independent of meshing_nthreads. */
+    if (cells_parallel) {
+        uint32_t const                      nclusters = cell_clusters.size();
+        std::vector<Mesh<Tm, Tv, Tf, R>>    cc_meshes(nclusters);
+        std::vector<bool>                   cc_ready(nclusters, false);
+        std::vector<std::exception_ptr>     cc_errors(nclusters);
+        std::mutex                          cc_mutex;
+        std::condition_variable             cc_cv;
+        std::atomic<uint32_t>               cc_next(0);
+        std::atomic<bool>                   cc_abort(false);
+        std::vector<std::thread>            cc_workers;
+
+        WorkerJoiner cc_joiner = { cc_abort, cc_workers };
+
+        auto cc_worker = [&] () -> void {
+            uint32_t k;
+            while (!cc_abort && (k = cc_next++) < nclusters) {
+                Mesh<Tm, Tv, Tf, R>    &M_C = cc_meshes[k];
+                Mesh<Tm, Tv, Tf, R>     M_CS;
+                std::exception_ptr      C_error;
+
+                uint32_t C_npaths = 0;
+                for (auto i : cell_clusters[k]) {
+                    C_npaths += cells[i].npaths;
+                }
+                printf("\t meshing cell cluster %5u of %5u (%zu cells, %u neurite paths).\n",
+                        k + 1, nclusters, cell_clusters[k].size(), C_npaths);
 
-        /*
-        tmp = M_cell;
-        tmp.writeObjFile("M_cell_before_merge");
-        */
-
-        uint32_t segment_index = 1;
-
-        debugl(1, "entering outer meshing loop for path %d.\n", (*npt_vit)->id());
-        debugTabInc();
-        while (!done) {
-            /* if necessary, use back M_cell_backup to restore original M_cell before the RedBlueUnion call if
-             * necessary. this is the case iff the exception that lead to the necessity of another run indicated
-             * R_intact == true (M_cell has been used as the red mesh). */
-            if (restore_M_cell) {
-                /* NOTE: the mesh flush info struct contains _pointers_ to boundary vertices of the old M_cell. once the
-                 * backup is used to restore, the current M_cell is effectively clear()ed and overwritten with the
-                 * backup copy by Mesh::operator=(). this process frees all vertices and faces of the mesh to which the
-                 * backup copy is assigned, which in turn causes dangling invalid pointers inside M_cell_flushinfo. it
-                 * therefore becomes necessary to update all last_boundary_vertices pointer to point to the correct
-                 * vertices of M_cell after the restore. however, mesh assignment with Mesh::operator=() preserves
-                 * integer ids, and so the update can be achieved as follows:
-                 *
-                 * 1. restore M_cell from M_cell_backup with assignment.
-                 *
-                 * 2. locate all boundary vertex ids in the restored M_cell and update pointers in M_cell_flushinfo. the
-                 * reference to M_cell stays intact, since the object itself is never deleted but only overwritten by
-                 * assignment. the integer ids of all boundary vertices are stored in the list
-                 * M_cell_boundary_vertex_ids_backup.
-                 *
-                 * */
-                debugl(1, "restoring M_cell from backup via assignment.\n");
-                M_cell = M_cell_backup;
-
-                debugl(1, "updating pointers in M_flush_info.last_boundary_vertices via id lookup..\n");
-                auto fp_it = M_cell_flushinfo.last_boundary_vertices.begin();
-                for (auto &v_id : M_cell_flush_last_boundary_vertices_ids_backup) {
-                    auto v_it = M_cell.vertices.find(v_id);
-                    if (v_it != M_cell.vertices.end()) {
-                        fp_it->first = &(*v_it);
-                        ++fp_it; 
+                /* errors are passed on to the main thread, which rethrows them in cluster order */
+                Aux::Numbers::frandSetThreadStream(k);
+                try {
+                    for (auto i : cell_clusters[k]) {
+                        cells[i].s_info->soma_sphere.template generateMesh<Tm, Tv, Tf>(M_CS, meshing_n_soma_refs);
+                        M_C.moveAppend(M_CS);
                     }
-                    else {
-                        debugTabDec(); debugTabDec(); debugTabDec();
-                        throw("NLM_CellNetwork::renderCellNetwork(): failed to locate flush boundary vertex via id during cell mesh backup.");
+
+                    for (auto i : cell_clusters[k]) {
+                        auto npt_vit = cells[i].first;
+                        for (uint32_t j = 0; j < cells[i].npaths && !cc_abort; j++, ++npt_vit) {
+                            this->template meshNeuritePath<Tm, Tv, Tf>(M_C, (*npt_vit)->vertex_data, NULL, false);
+                        }
                     }
                 }
+                catch (...) {
+                    C_error = std::current_exception();
+                    M_C.clear();
+                }
+                Aux::Numbers::frandUnsetThreadStream();
 
-                if (fp_it != M_cell_flushinfo.last_boundary_vertices.end()) {
-                    debugTabDec(); debugTabDec(); debugTabDec();
-                    throw("NLM_CellNetwork::renderCellNetwork(): iterator to MeshObjFlushInfo::last_boundary_vertices has not reached end() after cell mesh backup. internal logic error.");
+                {
+                    std::lock_guard<std::mutex> lock(cc_mutex);
+                    cc_errors[k]    = C_error;
+                    cc_ready[k]     = true;
                 }
+                cc_cv.notify_all();
+            }
+        };
 
-                debugl(1, "M_cell and flush info fully restored.\n");
+        debugl(1, "cell-parallel mode: launching %d worker threads meshing %d cell clusters.\n", this->meshing_nthreads, nclusters);
+        for (uint32_t i = 0; i < this->meshing_nthreads; i++) {
+            try {
+                cc_workers.push_back(std::thread(cc_worker));
             }
+            catch (std::system_error &ex) {
+                debugTabDec();
+                throw("NLM_CellNetwork::renderCellNetwork(): caught std::system-error from thread() constructor => system could not spawn thread.");
+            }
+        }
 
-            new_outer_iteration         = false;
-            restore_M_cell              = false;
-            outer_loop_iter++;
+        for (uint32_t k = 0; k < nclusters; k++) {
+            {
+                std::unique_lock<std::mutex> lock(cc_mutex);
+                cc_cv.wait(lock, [&] () -> bool { return cc_ready[k]; });
+            }
 
-            if (outer_loop_iter % this->meshing_outer_loop_maxiter == 0) {
-                radius_factor = std::max(radius_factor_safe_lb, radius_factor - this->meshing_radius_factor_decrement);
+            if (cc_errors[k]) {
+                debugTabDec();
+                std::rethrow_exception(cc_errors[k]);
             }
 
-            debugl(1, "outer meshing loop: iteration %d. radius factor: %5.4f\n", outer_loop_iter, radius_factor);
-            debugl(1, "choosing random phi_0 and generating initial mesh segment..\n");
+            M_cell.moveAppend(cc_meshes[k]);
+            debugl(1, "cell cluster %d appended. M_cell.numVertices(): %d\n", k, M_cell.numVertices());
 
-            /* compute random angular offset phi_0 */
-            phi_0 = Aux::Numbers::frand(0.0, (2*(R)M_PI) / (R)this->meshing_canal_segment_n_phi_segments);
+            if (flushDue()) {
+                printf("Flushing completed cell clusters off to disk.. ");
+                fflush(stdout);
 
-            /* clear path mesh */
-            M_P.clear();
+                std::list<typename Mesh<Tm, Tv, Tf, R>::Face *> flush_faces = {};
+                M_cell.invertFaceSelection(flush_faces);
+                try {MeshAlg::partialFlushToFile(M_cell, M_cell_flushinfo, flush_faces);}
+                catch (...) {debugTabDec(); throw;}
 
-            /* generate P's initial segment mesh and append to M */
-            try
-            {
-                P.template generateInitialSegmentMesh<Tm, Tv, Tf>(
-                    /* append to mesh M_P for path P*/
-                    M_P,
-                    /* n_phi_segments default to 16 for testing */
-                    this->meshing_canal_segment_n_phi_segments,
-                    meshing_cansurf_triangle_height_factor,
-                    /* render vector */
-                    render_vector,
-                    /* phi_0, arclen_dt = 1E-3 */
-                    phi_0,
-                    1E-3,
-                    /* end circle info */
-                    end_circle_offset,
-                    end_circle_its,
-                    closing_vertex_it,
-                    /* radius factor, which is being ignored for neurite root paths. */
-                    radius_factor,
-                    this->meshing_preserve_crease_edges);
+                printf("done.\n");
             }
-            catch (...) {debugTabDec(); debugTabDec(); debugTabDec(); throw;}
-
-            // add more segments if joining has failed before due to intersection of the end circle
-            for (uint32_t i = 1; i < segment_index; ++i)
-            {
-                try
-                {
-                    P.template appendTailSegment<Tm, Tv, Tf>
-                    (
-                        M_P,
-                        i,
-                        this->meshing_canal_segment_n_phi_segments,
-                        meshing_cansurf_triangle_height_factor,
-                        render_vector,
-                        phi_0,
-                        1e-3,
-                        end_circle_offset,
-                        end_circle_its,
-                        closing_vertex_it,
-                        this->meshing_preserve_crease_edges
-                    );
+        }
+    }
+    else if (this->meshing_parallel_trees) {
+        /* tree-parallel mode: the neurite path trees are meshed by a reduction over their paths. every path is seeded
+         * into a mesh of its own with its initial segment, as the root path of a tree would be, and the finished
+         * meshes of its child paths' subtrees are merged into it with a single RedBlueUnion call each, in BFS order.
+         * meshing_nthreads worker threads start at the leaf paths of all trees. whichever thread finishes the last
+         * child of a path goes on to reduce the path itself, so sibling subtrees of a single large neurite are meshed
+         * concurrently without any thread waiting for another one. the main thread joins the finished tree meshes
+         * into M_cell in the original order.
+         *
+         * if a subtree mesh can't be merged into its parent path's mesh (e.g. because it touches another subtree or
+         * the parent path away from its initial segment), the parent's mesh is rolled back and the paths of the
+         * subtree are merged into it one by one as in sequential mode. the same holds for joining a tree to M_cell,
+         * and trees that touch the soma with more than their root path are meshed sequentially right away. only the
+         * recoverable RedBlue exceptions trigger these fallbacks, all other errors are passed on to the main thread,
+         * which rethrows them in tree order. every path draws its random numbers from a separate stream seeded with
+         * its BFS index, so the generated mesh is reproducible and independent of meshing_nthreads. */
+        uint32_t const                              ntrees      = npt_ranges.size();
+        uint32_t const                              npaths      = npt_vertices_bfs_ordered.size();
+        uint32_t const                              no_parent   = std::numeric_limits<uint32_t>::max();
+
+        /* per path: neurite path, parent and child paths in the reduction tree, the tree it belongs to, its subtree
+         * mesh, the error raised while meshing its subtree and the number of child subtrees not yet meshed. */
+        std::vector<NLM::NeuritePath<R> const *>    np_paths(npaths, NULL);
+        std::vector<uint32_t>                       np_parent(npaths, no_parent);
+        std::vector<std::vector<uint32_t>>          np_children(npaths);
+        std::vector<uint32_t>                       np_tree(npaths);
+        std::vector<Mesh<Tm, Tv, Tf, R>>            np_meshes(npaths);
+        std::vector<std::exception_ptr>             np_errors(npaths);
+        std::unique_ptr<std::atomic<uint32_t>[]>    np_pending(new std::atomic<uint32_t>[npaths]);
+        std::vector<uint32_t>                       np_leaves;
+
+        /* per tree: BFS index of the root path, whether it is meshed by the worker threads and whether its mesh is
+         * ready to be joined into M_cell. */
+        std::vector<uint32_t>                       npt_root(ntrees);
+        std::vector<bool>                           npt_reduced(ntrees, false), npt_ready(ntrees, false);
+        std::mutex                                  npt_mutex;
+        std::condition_variable                     npt_cv;
+        std::atomic<uint32_t>                       npt_next(0);
+        std::atomic<bool>                           npt_abort(false);
+        std::vector<std::thread>                    npt_workers;
+
+        WorkerJoiner npt_joiner = { npt_abort, npt_workers };
+
+        debugl(1, "tree-parallel mode: setting up reduction trees.\n");
+        auto npt_vit = npt_vertices_bfs_ordered.begin();
+        for (uint32_t k = 0, g = 0; k < ntrees; k++) {
+            NeuriteMeshingTree const                               &T = npt_ranges[k];
+            std::map<typename NeuritePathTree::Vertex const *, uint32_t> T_index;
+
+            npt_root[k]     = g;
+            npt_reduced[k]  = T.standalone;
+            for (uint32_t i = 0; i < T.npaths; i++, g++, ++npt_vit) {
+                auto &u         = **npt_vit;
+
+                np_paths[g]     = &(u.vertex_data);
+                np_tree[g]      = k;
+                T_index[&u]     = g;
+
+                /* BFS order lists parents first. a path with more than one parent path can't be reduced. */
+                if (i > 0 && npt_reduced[k]) {
+                    auto p_it = (u.indeg() == 1) ? T_index.find(&(*(u.inEdges()[0]->getSourceVertex()))) : T_index.end();
+                    if (p_it != T_index.end()) {
+                        np_parent[g] = p_it->second;
+                        np_children[p_it->second].push_back(g);
+                    }
+                    else {
+                        npt_reduced[k] = false;
+                    }
                 }
-                catch (...) {debugTabDec(); debugTabDec(); debugTabDec(); throw;}
             }
 
-            /* triangulate M_P for RedBlueAlgorithm */
-            M_P.triangulateQuads();
-
-            /*
-            tmp = M_P;
-            tmp.writeObjFile("M_P_before_merge");
-            */
+            for (uint32_t h = npt_root[k]; h < g; h++) {
+                np_pending[h] = np_children[h].size();
+                if (npt_reduced[k] && np_children[h].empty()) {
+                    np_leaves.push_back(h);
+                }
+            }
+        }
 
-            /* merge initial path mesh segment into cell mesh with RedBlueUnion. to append the tail of the path mesh, it
-             * is required to know the end circle and closing vertex iterators AFTER merging, so these are assembled
-             * into the update iterator vector circle_its_update for the RedBlueUnion call. */
-            circle_its_update_original = end_circle_its;
-            circle_its_update_original.push_back(closing_vertex_it);
-
-            /* inner meshing loop: while the initial mesh segment generated above might still be usable (e.g. by
-             * splitting complex edges), try to use it. as soon as exception handling sets new_outer_iteration or
-             * break_inner_meshing_loop is set to false at the end of the try {..} block, the inner loop breaks.
-             * directly after the body of the inner meshing loop, it is checked whether new_outer_iteration == true. */
-            break_inner_meshing_loop    = false;
-            inner_loop_iter             = 0;
-            complex_edge_growth_factor  = 0.0;
-            complex_edge_initial_count  = 0;
-
-            debugl(1, "entering inner meshing loop..\n");
-            debugTabInc();
-            while (!new_outer_iteration && !break_inner_meshing_loop && inner_loop_iter < this->meshing_inner_loop_maxiter) {
-                /* copy circle_its_update_original into circle_its_update for current meshing run */
-                circle_its_update = circle_its_update_original;
-                inner_loop_iter++;
+        /* merge M_B into M with RedBlueUnion. complex edges and trivial affected circles are repaired and the union is
+         * retried. if the union still fails with a recoverable RedBlue exception, M is rolled back and false is
+         * returned. all other exceptions, in particular internal logic errors, are passed on as in meshNeuritePath(). */
+        auto joinMeshes = [&] (Mesh<Tm, Tv, Tf, R> &M, Mesh<Tm, Tv, Tf, R> &M_B) -> bool
+        {
+            bool joined = false;
+
+            M.checkpoint();
+            try {
+                for (uint32_t iter = 0; !joined && iter < this->meshing_inner_loop_maxiter; iter++) {
+                    try {
+                        MeshAlg::RedBlueUnion<Tm, Tv, Tf, R>(M, M_B);
+                        joined = true;
+                    }
+                    catch (RedBlue_Ex_ComplexEdges<R>& complex_ex) {
+                        debugl(0, "NLM_CellNetwork::renderCellNetwork(): joining meshes: %d complexly intersecting edges.. splitting.\n", complex_ex.edge_isec_info.size());
+                        splitComplexEdges(M, M_B, complex_ex);
+                    }
+                    catch (RedBlue_Ex_AffectedCircleTrivial<R>& trivcircle_ex) {
+                        debugl(0, "NLM_CellNetwork::renderCellNetwork(): joining meshes: affected circle trivial.\n");
+                        if (trivcircle_ex.red)
+                            M.split_face_with_center(trivcircle_ex.face_id, trivcircle_ex.splitPos);
+                        else
+                            M_B.split_face_with_center(trivcircle_ex.face_id, trivcircle_ex.splitPos);
+                    }
+                }
+            }
+            catch (RedBlue_Ex_NumericalEdgeCase& numerical_ex) {
+                debugl(0, "NLM_CellNetwork::renderCellNetwork(): joining meshes: numerical edge case.\n");
+            }
+            catch (RedBlue_Ex_Triangulation<R>& tri_ex) {
+                debugl(0, "NLM_CellNetwork::renderCellNetwork(): joining meshes: error during triangulation of outside / inside polygons.\n");
+            }
+            catch (RedBlue_Ex_NumIsecPoly& isecpoly_ex) {
+                debugl(0, "NLM_CellNetwork::renderCellNetwork(): joining meshes: number of intersection polygons != 1.\n");
+            }
 
-                debugl(2, "calling RedBlueUnion algorithm to merge initial mesh segment into partially completed cell mesh.\n");
+            if (!joined) {
+                M.rollback();
+            }
+            M.releaseCheckpoint();
 
-                Aux::Timing::tick(14);
+            return joined;
+        };
 
-                try {
-                    MeshAlg::RedBlueUnion<Tm, Tv, Tf, R>(
-                        /* R = M_cell, which is to be union mesh afterwards */
-                        M_cell,
-                        /* B = M_P, the mesh for the initial segment of P */
-                        M_P,
-                        /* list of end circle iterators from M_P which are updated to reflect the corresponding vertices in
-                         * the union mesh */
-                       &circle_its_update);
-
-                    /* RedBlueUnion call has been succcessful. break inner meshing loop */
-                    break_inner_meshing_loop = true;
-                }
-                catch (RedBlue_Ex_InternalLogic& logic_ex) {
-                    debugTabDec(); debugTabDec(); debugTabDec(); debugTabDec();
-                    throw;
-                }
-                catch (RedBlue_Ex_Disjoint& disjoint_ex) {
-                    debugTabDec(); debugTabDec(); debugTabDec(); debugTabDec();
-                    throw;
-                }
-                catch (RedBlue_Ex_ComplexEdges<R>& complex_ex) {
-                    debugl(0, "NLM_CellNetwork::renderCellNetwork(): RedBlueAlgorithm returned exception: %d complexly intersecting edges.. splitting.\n", complex_ex.edge_isec_info.size());
-                    debugTabInc();
+        /* mesh the subtree of path g into np_meshes[g], given the finished subtree meshes of all its child paths */
+        auto npt_reduce = [&] (uint32_t g) -> void
+        {
+            Mesh<Tm, Tv, Tf, R> &M_g = np_meshes[g];
 
-                    uint32_t const nce = complex_ex.edge_isec_info.size();
+            if (npt_abort) {
+                return;
+            }
 
-                    /* if this is the first complex edge exception, set initial complex edge count */
-                    if (complex_edge_growth_factor == 0.0) {
-                        complex_edge_initial_count  = nce;
-                        complex_edge_growth_factor  = 1.0;
-                        debugl(1, "setting complex edge initial count to %d, factor to %5.4f\n", nce, complex_edge_growth_factor);
-                    }
-                    /* otherwise calculate "growth factor". in certain situations, splitting all complex edges creates
-                     * even more complex edges. this process can amplify itself exponentially. to prevent this, check
-                     * if the growth factor exceeds a certain limit */
-                    else {
-                        complex_edge_growth_factor  = (R)nce / (R)complex_edge_initial_count;
-                        debugl(1, "setting complex edge growth factor to %5.4f\n", complex_edge_growth_factor);
+            Aux::Numbers::frandSetThreadStream(g);
+            try {
+                for (auto c : np_children[g]) {
+                    if (np_errors[c]) {
+                        std::rethrow_exception(np_errors[c]);
                     }
+                }
 
-                    /* if complex edge growth factor is too large, start new outer meshing iteration */
-                    if (complex_edge_growth_factor > this->meshing_complex_edge_max_growth_factor) {
-                        debugl(0, "Complex edge growth factor too large.\n");
-                        radius_factor   = std::max(radius_factor_safe_lb, radius_factor - this->meshing_radius_factor_decrement);
-                        new_outer_iteration = true;
-                        restore_M_cell      = true;
-                    }
-                    else for (auto e_info : complex_ex.edge_isec_info) {
-                        debugl(2, "complex edge: e = (%d, %d)\n", e_info.u_id, e_info.v_id);
+                this->template meshNeuritePath<Tm, Tv, Tf>(M_g, *np_paths[g], NULL, true);
 
-                        /* sort and check lambdas */
-                        std::vector<R>& lambdas = e_info.edge_lambdas;
-                        const uint32_t n = lambdas.size();
+                for (auto c : np_children[g]) {
+                    if (!joinMeshes(M_g, np_meshes[c])) {
+                        debugl(0, "NLM_CellNetwork::renderCellNetwork(): merging subtree of path %d into path %d failed => meshing it sequentially.\n", c, g);
 
-                        debugl(2, "sorting complex exception edge lambdas. size(): %zu..\n", lambdas.size() );
-                        std::sort(lambdas.begin(), lambdas.end(), std::less<R>() );
-                        if (lambdas[0] <= 0 || lambdas[n-1] >= 1)
-                        {
-                            debugTabDec(); debugTabDec(); debugTabDec(); debugTabDec(); debugTabDec();
-                            throw("NLM_CellNetwork::renderCellNetwork(): got exceptino about complex edge indicating fractional edge intersection value lambda outside ]0, 1[."\
-                                " internal logic error.");
+                        /* BFS indices are increasing along every path of the tree, so sorting them yields a valid
+                         * merging order for the subtree. */
+                        std::vector<uint32_t> c_subtree = { c };
+                        for (size_t i = 0; i < c_subtree.size(); i++) {
+                            auto &h_children = np_children[c_subtree[i]];
+                            c_subtree.insert(c_subtree.end(), h_children.begin(), h_children.end());
                         }
+                        std::sort(c_subtree.begin(), c_subtree.end());
 
-                        /* compute split points */
-                        std::vector<R> e_split_points(n-1);
-
-                        debugl(3, "split_points[0] = %5.4f\n", e_split_points[0]);
-                        for (uint32_t i = 1; i < n; i++) {
-                            e_split_points[i-1] = (lambdas[i] + lambdas[i-1]) / 2.0;
-                            debugl(3, "split_points[%d] = %5.4f\n", i, e_split_points[i]);
+                        for (auto h : c_subtree) {
+                            this->template meshNeuritePath<Tm, Tv, Tf>(M_g, *np_paths[h], NULL, false);
                         }
-                        debugl(3, "split_points[%d] = %5.4f\n", n, e_split_points[n]);
+                    }
+                    np_meshes[c].clear();
+                }
+            }
+            catch (...) {
+                np_errors[g] = std::current_exception();
+                M_g.clear();
+            }
+            Aux::Numbers::frandUnsetThreadStream();
 
-                        /* split in red mesh, i.e. M_cell */
-                        if (e_info.red) {
-                            auto u_it = M_cell.vertices.find(e_info.u_id);
-                            auto v_it = M_cell.vertices.find(e_info.v_id);
+            for (auto c : np_children[g]) {
+                np_meshes[c].clear();
+            }
+        };
 
-                            if (u_it != M_cell.vertices.end() && v_it != M_cell.vertices.end()) {
-                                M_cell.splitEdge(u_it, v_it, e_split_points);
-                            }
-                            else {
-                                debugTabDec(); debugTabDec(); debugTabDec(); debugTabDec(); debugTabDec();
-                                throw("NLM_CellNetwork::renderCellNetwork(): discovered invalid vertex id contained "\
-                                    " in complex edge information of RedBlue_Ex_ComplexEdges (id not found). internal"\
-                                    " logic error.");
-                            }
-                        }
-                        /* split in blue mesh, i.e. M_P */
-                        else {
-                            auto u_it = M_P.vertices.find(e_info.u_id);
-                            auto v_it = M_P.vertices.find(e_info.v_id);
+        auto npt_worker = [&] () -> void {
+            uint32_t l;
+            while (!npt_abort && (l = npt_next++) < np_leaves.size()) {
+                uint32_t g = np_leaves[l];
+                while (true) {
+                    npt_reduce(g);
 
-                            if (u_it != M_P.vertices.end() && v_it != M_P.vertices.end()) {
-                                M_P.splitEdge(u_it, v_it, e_split_points);
-                            }
-                            else {
-                                debugTabDec(); debugTabDec(); debugTabDec(); debugTabDec(); debugTabDec();
-                                throw("NLM_CellNetwork::renderCellNetwork(): discovered invalid vertex id contained "\
-                                    " in complex edge information of RedBlue_Ex_ComplexEdges (id not found). internal"\
-                                    " logic error.");
-                            }
+                    uint32_t const p = np_parent[g];
+                    if (p == no_parent) {
+                        {
+                            std::lock_guard<std::mutex> lock(npt_mutex);
+                            npt_ready[np_tree[g]] = true;
                         }
+                        npt_cv.notify_all();
+                        break;
                     }
-                    debugTabDec();
-
-                    /* all splits performed. at this point, new_outer_iteration == false, break_inner_meshing_loop == false =>
-                     * another iteration of the inner meshing loop is performed, which issues another RedBlueUnion call
-                     * on the same initial mesh segment after splitting complex edges. */
-                    /*
-                    Mesh<Tm, Tv, Tf, R> tmp = M_cell;
-                    std::ostringstream oss1;
-                    oss1 << "M_cell_split_" << outer_loop_iter << "_" << inner_loop_iter;
-                    tmp.writeObjFile(oss1.str().c_str());
-
-                    tmp = M_P;
-                    std::ostringstream oss2;
-                    oss2 << "M_P_split_" << outer_loop_iter << "_" << inner_loop_iter;
-                    tmp.writeObjFile(oss2.str().c_str());
-                    */
-                }
-                catch (RedBlue_Ex_NumericalEdgeCase& numerical_ex) {
-                    debugl(0, "NLM_CellNetwork::renderCellNetwork(): RedBlueAlgorithm returned exception: numerical edge case => retry..\n");
-                    new_outer_iteration = true;
-                    restore_M_cell      = !numerical_ex.R_intact;
+                    /* the thread finishing the last child of p reduces p. */
+                    else if (--np_pending[p] > 0) {
+                        break;
+                    }
+                    g = p;
                 }
-                catch (RedBlue_Ex_Triangulation<R>& tri_ex) {
-                    debugl(0, "NLM_CellNetwork::renderCellNetwork(): RedBlueAlgorithm returned exception: error during triangulation of outside / inside polygons. => retry..\n");
+            }
+        };
 
-                    /* decrease radius factor, but lower bound by radius_factor_safe_lb. */
-                    radius_factor       = std::max(radius_factor_safe_lb, radius_factor - this->meshing_radius_factor_decrement);
-                    new_outer_iteration = true;
-                    restore_M_cell      = !tri_ex.R_intact;
+        debugl(1, "tree-parallel mode: launching %d worker threads meshing %d neurite paths.\n", this->meshing_nthreads, npaths);
+        for (uint32_t i = 0; i < this->meshing_nthreads; i++) {
+            try {
+                npt_workers.push_back(std::thread(npt_worker));
+            }
+            catch (std::system_error &ex) {
+                debugTabDec();
+                throw("NLM_CellNetwork::renderCellNetwork(): caught std::system-error from thread() constructor => system could not spawn thread.");
+            }
+        }
+
+        debugl(1, "joining neurite path tree meshes in order.\n");
+        debugTabInc();
+        for (uint32_t k = 0; k < ntrees; k++) {
+            NeuriteMeshingTree const   &T      = npt_ranges[k];
+            Mesh<Tm, Tv, Tf, R>        &M_T    = np_meshes[npt_root[k]];
+            bool                        joined = false;
+
+            if (npt_reduced[k]) {
+                {
+                    std::unique_lock<std::mutex> lock(npt_mutex);
+                    npt_cv.wait(lock, [&] () -> bool { return npt_ready[k]; });
                 }
-                catch (RedBlue_Ex_NumIsecPoly& isecpoly_ex) {
-                    debugl(0, "NLM_CellNetwork::renderCellNetwork(): RedBlueAlgorithm returned exception: number of intersection polygons != 1.\n");
-                    radius_factor       = std::max(radius_factor_safe_lb, radius_factor - this->meshing_radius_factor_decrement);
-                    new_outer_iteration = true;
-                    restore_M_cell      = !isecpoly_ex.R_intact;
+
+                if (np_errors[npt_root[k]]) {
+                    debugTabDec(); debugTabDec();
+                    std::rethrow_exception(np_errors[npt_root[k]]);
                 }
-                catch (RedBlue_Ex_AffectedCircleTrivial<R>& trivcircle_ex){
-                    debugl(0, "NLM_CellNetwork::renderCellNetwork(): RedBlueAlgorithm returned exception: affected circle trivial.\n");
-
-                    // split the single triangle with a center vertex at the pre-computed position
-                    if (trivcircle_ex.red)
-                        M_cell.split_face_with_center(trivcircle_ex.face_id, trivcircle_ex.splitPos);
-                    else
-                        M_P.split_face_with_center(trivcircle_ex.face_id, trivcircle_ex.splitPos);
+            }
+
+            try {flushM_cell(T.first);}
+            catch (...) {debugTabDec(); debugTabDec(); throw;}
+
+            /* join tree mesh into M_cell */
+            if (npt_reduced[k]) {
+                printf("\t joining neurite tree %5u of %5u (%u neurite paths).\n", k + 1, ntrees, T.npaths);
+
+                try {joined = joinMeshes(M_cell, M_T);}
+                catch (...) {debugTabDec(); debugTabDec(); throw;}
+
+                if (!joined) {
+                    debugl(0, "NLM_CellNetwork::renderCellNetwork(): joining tree %d failed => meshing it sequentially.\n", k);
                 }
-                debugl(1, "inner meshing loop time: %5.4f\n\n", Aux::Timing::tack(14));
+                M_T.clear();
             }
-            debugTabDec();
-            debugl(1, "inner meshing loop left..\n");
 
-            /* if maximum number of inner meshing loop iterations has been reached, restart outer meshing loop. */
-            if (inner_loop_iter == this->meshing_inner_loop_maxiter) {
-                debugl(0, "inner meshing loop broken because maximum number of iterations has been reached => restart outer meshing loop.\n");
-                radius_factor   = std::max(radius_factor_safe_lb, radius_factor - this->meshing_radius_factor_decrement);
-                new_outer_iteration = true;
-                restore_M_cell      = true;
+            /* fallback: merge the paths of the tree one by one into M_cell */
+            if (!joined) {
+                auto npt_wit = T.first;
+                for (uint32_t i = 0; i < T.npaths; i++, ++npt_wit) {
+                    printf("\t meshing neurite path %5u of %5u of neurite tree %5u sequentially.\n", i + 1, T.npaths, k + 1);
+                    try {
+                        flushM_cell(npt_wit);
+                        this->template meshNeuritePath<Tm, Tv, Tf>(M_cell, (*npt_wit)->vertex_data, NULL, false);
+                    }
+                    catch (...) {debugTabDec(); debugTabDec(); throw;}
+                }
+            }
+            debugl(1, "neurite tree %d processed. M_cell.numVertices(): %d\n", k, M_cell.numVertices());
+        }
+        debugTabDec();
+    }
+    else {
+        /* pipelined mode: if meshing_nthreads > 1, meshing_nthreads - 1 worker threads precompute the mesh frames
+         * (render vector and spine curve samples, see NLM::NeuritePathMeshFrames) of all neurite paths in BFS order,
+         * while the main thread merges the current path into M_cell and only waits for the frames of the current path.
+         * computing the frames does not draw any random numbers, so the generated mesh is identical to the sequential
+         * one. */
+        std::vector<NLM::NeuritePath<R> const *>    np_paths;
+        std::vector<NLM::NeuritePathMeshFrames<R>>  np_frames(npt_vertices_bfs_ordered.size());
+        std::vector<bool>                           np_frames_ready(npt_vertices_bfs_ordered.size(), false);
+        std::mutex                                  np_frames_mutex;
+        std::condition_variable                     np_frames_cv;
+        std::atomic<uint32_t>                       np_frames_next(0);
+        std::atomic<bool>                           np_frames_abort(false);
+        std::vector<std::thread>                    np_frames_workers;
+
+        WorkerJoiner np_frames_joiner = { np_frames_abort, np_frames_workers };
+
+        if (this->meshing_nthreads > 1) {
+            for (auto &npt_v_it : npt_vertices_bfs_ordered) {
+                np_paths.push_back(&(npt_v_it->vertex_data));
             }
 
-            // check that the complete end circle of P is not merged with M_cell
-            // this is not allowed, as we need it to connect the rest of the neurite
-            for (auto &it : circle_its_update)
-            {
-                if (it.explicitlyInvalid())
-                {
-                    debugl(0, "Neurite end circle intersects cell grid to connect to.\n"
-                              "Adding another segment to initial neurite stump and trying to connect again.\n");
+            auto np_frames_worker = [&] () -> void {
+                uint32_t k;
+                while (!np_frames_abort && (k = np_frames_next++) < np_paths.size()) {
+                    NLM::NeuritePathMeshFrames<R> frames;
+
+                    /* on error, frames remain invalid and the main thread computes everything itself, reporting the
+                     * error in the process. */
+                    try {
+                        np_paths[k]->computeMeshFrames(
+                            this->meshing_canal_segment_n_phi_segments,
+                            this->meshing_cansurf_triangle_height_factor,
+                            1E-3,
+                            this->meshing_preserve_crease_edges,
+                            frames);
+                    }
+                    catch (...) {
+                        frames.valid = false;
+                    }
 
-                    // if P has no more segments left to append, then this is an error
-                    if (P.numEdges() <= segment_index)
                     {
-                        debugTabDec(); debugTabDec(); debugTabDec();
-                        throw("NLM_CellNetwork::renderCellNetwork(): RedBlueUnion algorithm has explicitly invalidated an "\
-                          "end circle iterator or the closing vertex iterator of the current path P's initial mesh "
-                          "segment. This means the tip of the initial segment intersects with the rest of the geometry."
-                          " This degenerate case cannot be dealt with at the moment. In a clean network, this should be "
-                          "impossible. numerical edge case due to tight PMDV / SMDV constants?");
+                        std::lock_guard<std::mutex> lock(np_frames_mutex);
+                        np_frames[k]        = std::move(frames);
+                        np_frames_ready[k]  = true;
                     }
-
-                    // otherwise send R-B in another outer iteration
-                    // and tell it to append one further segment to P
-                    ++segment_index;
-                    new_outer_iteration = true;
-                    restore_M_cell      = true;
-                    break;
+                    np_frames_cv.notify_all();
                 }
-            }
+            };
 
-            /* start fresh iteration of outer meshing loop if required */
-            if (new_outer_iteration) {
-                debugl(1, "re-iteration of outer meshing loop necessary..\n");
-                /* if radius_factor has reached radius_factor_safe_lb, throw exception, since a definitely safe radius
-                 * should already have been reached. */
-                if (radius_factor == radius_factor_safe_lb) {
-
-                    Mesh<Tm, Tv, Tf, R> tmp = M_cell;
-                    std::ostringstream oss1;
-                    oss1 << "M_cell_split_" << outer_loop_iter << "_" << inner_loop_iter;
-                    tmp.writeObjFile(oss1.str().c_str());
-
-                    tmp = M_P;
-                    std::ostringstream oss2;
-                    oss2 << "M_P_split_" << outer_loop_iter << "_" << inner_loop_iter;
-                    tmp.writeObjFile(oss2.str().c_str());
-
-                    debugTabDec(); debugTabDec(); debugTabDec();
-                    throw("NLM_CellNetwork::renderCellNetwork(): Reached safe lower bound radius factor for current "
-                        "neurite path. This must not happen for clean cell networks and indicates that the initial "
-                        "segment of the neurite currently being connected, apart from the connection point, has a "
-                        "second intersection with the rest of the geometry.");
+            debugl(1, "pipelined mode: launching %d worker threads precomputing neurite path mesh frames.\n", this->meshing_nthreads - 1);
+            for (uint32_t i = 0; i + 1 < this->meshing_nthreads; i++) {
+                try {
+                    np_frames_workers.push_back(std::thread(np_frames_worker));
                 }
-                /* otherwise start another meshing run */
-                else {
-                    continue;
+                catch (std::system_error &ex) {
+                    debugTabDec();
+                    throw("NLM_CellNetwork::renderCellNetwork(): caught std::system-error from thread() constructor => system could not spawn thread.");
                 }
             }
+        }
 
-            // security check
-            for (auto &it : circle_its_update) {
-                if (!it.checkContainer(M_cell)) {
-                    debugl(1, "it.container: %p, M_cell (ptr): %p, M_P (ptr): %p.\n", it.getContainer(), &M_cell, &M_P);
-                    debugTabDec(); debugTabDec(); debugTabDec();
-                    throw("NLM_CellNetwork::renderCellNetwork(): RedBlueUnion algorithm has returned an "\
-                        "updated end circle iterator that does not refer to the partially completed cell mesh. "\
-                        "internal logic error.");
+        /* in the computed bread-first ordering, inductively append neurite path meshes */
+        debugl(1, "processing neurite paths in BFS order.\n");
+        debugTabInc();
+        uint32_t np_idx = 1;
+        for (auto npt_vit = npt_vertices_bfs_ordered.begin(); npt_vit != npt_vertices_bfs_ordered.end(); ++npt_vit) {
+            debugl(2, "processing neurite path %d\n", (*npt_vit)->id());
+            printf("\t meshing neurite path %5u of %5zu.\n", np_idx, npt_vertices_bfs_ordered.size() );
+
+            /* in pipelined mode, wait for the precomputed mesh frames of P */
+            NLM::NeuritePathMeshFrames<R> const *P_frames = NULL;
+            if (!np_frames_workers.empty()) {
+                std::unique_lock<std::mutex> lock(np_frames_mutex);
+                np_frames_cv.wait(lock, [&] () -> bool { return np_frames_ready[np_idx - 1]; });
+                if (np_frames[np_idx - 1].valid) {
+                    P_frames = &np_frames[np_idx - 1];
                 }
             }
 
-            debugl(2, "initial mesh segment successfully merged. appending path tail mesh..\n");
-
-            /* unpack updated iterators referring to M_cell. */
-            closing_vertex_it   = circle_its_update.back();
-            circle_its_update.pop_back();
-            end_circle_its      = circle_its_update;
-
-            /* append P's tail mesh (for neurite canal segments 1, .., m) to M */
-            try
-            {
-                P.template appendTailMesh<Tm, Tv, Tf>(
-                    M_cell,
-                    segment_index,
-                    this->meshing_canal_segment_n_phi_segments,
-                    meshing_cansurf_triangle_height_factor,
-                    render_vector,
-                    phi_0,
-                    1E-3,
-                    /* end circle information from RedBlue merged initial segment as start circle information for tail */
-                    end_circle_offset,
-                    end_circle_its,
-                    closing_vertex_it,
-                    /* store return iterators for subsequent generation of terminal half-sphere */
-                   &end_circle_offset,
-                   &end_circle_its,
-                   &closing_vertex_it,
-                    this->meshing_preserve_crease_edges);
+            /* flush no longer needed parts of M_cell and merge P into the remainder */
+            try {
+                flushM_cell(npt_vit);
+                this->template meshNeuritePath<Tm, Tv, Tf>(M_cell, (*npt_vit)->vertex_data, P_frames, false, this->meshing_nthreads);
             }
-            catch (...) {debugTabDec(); debugTabDec(); debugTabDec(); throw;}
-
-            debugl(2, "tail path mesh appended. appending terminal half-sphere.\n");
-
-            /* append a terminal "half-sphere" at the end neurite point of P */
-            BLRCanalSurface<3u, R> &C_end   = *(P.canal_segments_magnified.back());
-            Vec3<R> start               = C_end.spineCurveEval(1.0);
-            Vec3<R> direction           = C_end.spineCurveEval_d(1.0);
-            R       radius              = C_end.radiusEval(1.0);
-
-            MeshAlg::appendHalfSphereToCanalSurfaceMesh<Tm, Tv, Tf, R>(
-                    M_cell,
-                    render_vector,
-                    start,
-                    radius,
-                    direction,
-                    this->meshing_canal_segment_n_phi_segments,
-                    phi_0,
-                    end_circle_its,
-                    closing_vertex_it);
-
-            debugl(2, "half-sphere appended. triangulating quads..\n");
-
-            /* triangulate quads in M_cell */
-            M_cell.triangulateQuads();
+            catch (...) {debugTabDec(); debugTabDec(); throw;}
 
             debugl(1, "path %d completely processed. M_cell.numVertices(): %d\n", (*npt_vit)->id(), M_cell.numVertices());
 
-            /* done for path P */
-            done = true;
+            /* release precomputed mesh frames of P */
+            if (!np_frames_workers.empty()) {
+                np_frames[np_idx - 1] = NLM::NeuritePathMeshFrames<R>();
+            }
+            np_idx++;
         }
         debugTabDec();
-        np_idx++;
     }
-    debugTabDec();
-    debugl(1, "all neurite paths processed. finalizing obj file..\n");
+    debugl(1, "all neurite paths processed. finalizing mesh file..\n");
 
     /* select all faces from cell mesh and flush them .. if no flush has been performed before, this is semantically
-     * equivalent to writeObjFile(), otherwise it completes partially flushed cell meshes that are yet incomplete in the
-     * flush obj file. */
+     * equivalent to writeFile(), otherwise it completes partially flushed cell meshes that are yet incomplete in the
+     * flush file. */
     std::list<typename Mesh<Tm, Tv, Tf, R>::Face *> remaining_faces = {};
     M_cell.invertFaceSelection(remaining_faces);
-    try {MeshAlg::partialFlushToObjFile(M_cell, M_cell_flushinfo, remaining_faces);}
-    catch (...) {debugTabDec(); debugTabDec(); throw;}
+    try {
+        MeshAlg::partialFlushToFile(M_cell, M_cell_flushinfo, remaining_faces);
+        M_cell_flushinfo.finalize();
+    }
+    catch (...) {debugTabDec(); throw;}
 
     debugTabDec();
     debugl(1, "NLM_CellNetwork<R>::renderCellNetwork(): done.\n");
@@ -3961,7 +4682,7 @@ NLM_CellNetwork<R>::renderModellingMeshesIndividually(std::string filename) cons
 
     /* output M */
     M_cell.triangulateQuads();
-    M_cell.writeObjFile(filename.c_str());
+    M_cell.writeFile(filename.c_str(), this->meshing_mesh_format, this->meshing_nthreads);
 }
 
 template <typename R>